@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System.hpp>
+
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Print the usage of the program
+///
+////////////////////////////////////////////////////////////
+void printUsage()
+{
+    std::cout << "Usage:\n"
+              << "  pack_file build <directory> <pack file> [--store]  Pack all the files of a directory\n"
+              << "  pack_file list <pack file>                        List the entries of a pack file\n"
+              << "  pack_file compare <pack file> <directory>         Compare reading the entries from the pack\n"
+              << "                                                    file and from the directory" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Read a stream until its end
+///
+/// \param stream Stream to read
+/// \param buffer Buffer to read into
+///
+/// \return Number of bytes read
+///
+////////////////////////////////////////////////////////////
+std::size_t readAll(sf::InputStream& stream, std::vector<char>& buffer)
+{
+    std::size_t total = 0;
+    while (const std::optional<std::size_t> count = stream.read(buffer.data(), buffer.size()))
+    {
+        if (*count == 0)
+            break;
+
+        total += *count;
+    }
+
+    return total;
+}
+
+
+////////////////////////////////////////////////////////////
+/// List the entries of a pack file
+///
+/// \param filename Path of the pack file
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int list(const std::filesystem::path& filename)
+{
+    sf::PackFile packFile;
+    if (!packFile.open(filename))
+        return EXIT_FAILURE;
+
+    for (const std::string& path : packFile.getEntryPaths())
+    {
+        const std::unique_ptr<sf::InputStream> stream = packFile.openStream(path);
+        std::cout << (stream ? stream->getSize().value_or(0) : 0) << '\t' << path << '\n';
+    }
+
+    std::cout << packFile.getEntryCount() << " entries" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Read every entry of a pack file, then the same files from a directory
+///
+/// \param filename  Path of the pack file
+/// \param directory Directory the pack file was built from
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int compare(const std::filesystem::path& filename, const std::filesystem::path& directory)
+{
+    std::vector<char> buffer(64 * 1024);
+    std::size_t       packBytes = 0;
+    std::size_t       fileBytes = 0;
+
+    const sf::Clock    packClock;
+    const sf::PackFile packFile(filename);
+    for (const std::string& path : packFile.getEntryPaths())
+    {
+        if (const std::unique_ptr<sf::InputStream> stream = packFile.openStream(path))
+            packBytes += readAll(*stream, buffer);
+    }
+    const sf::Time packTime = packClock.getElapsedTime();
+
+    const sf::Clock fileClock;
+    for (const std::string& path : packFile.getEntryPaths())
+    {
+        sf::FileInputStream stream;
+        if (stream.open(directory / std::filesystem::u8path(path)))
+            fileBytes += readAll(stream, buffer);
+    }
+    const sf::Time fileTime = fileClock.getElapsedTime();
+
+    std::cout << "Read " << packFile.getEntryCount() << " entries\n"
+              << "  from the pack file: " << packBytes << " bytes in " << packTime.asMilliseconds() << " ms\n"
+              << "  from the directory: " << fileBytes << " bytes in " << fileTime.asMilliseconds() << " ms"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    const std::vector<std::string_view> arguments(argv + 1, argv + argc);
+
+    try
+    {
+        if ((arguments.size() >= 3) && (arguments[0] == "build"))
+        {
+            const bool store = (arguments.size() == 4) && (arguments[3] == "--store");
+            if (!sf::PackFile::build(arguments[2],
+                                     arguments[1],
+                                     store ? sf::PackFile::Compression::None : sf::PackFile::Compression::Lz4))
+                return EXIT_FAILURE;
+
+            return list(arguments[2]);
+        }
+
+        if ((arguments.size() == 2) && (arguments[0] == "list"))
+            return list(arguments[1]);
+
+        if ((arguments.size() == 3) && (arguments[0] == "compare"))
+            return compare(arguments[1], arguments[2]);
+    }
+    catch (const sf::Exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    printUsage();
+    return EXIT_FAILURE;
+}
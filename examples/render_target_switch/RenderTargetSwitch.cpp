@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+
+#include <iostream>
+#include <vector>
+
+#include <cstdint>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Benchmark parameters
+////////////////////////////////////////////////////////////
+constexpr std::size_t  targetCount = 64;
+constexpr unsigned int roundCount  = 200;
+constexpr sf::Vector2u targetSize{64, 64};
+
+
+////////////////////////////////////////////////////////////
+/// Draw the previous target into each target, in round-robin order
+///
+/// \param targets  Render textures to draw into
+/// \param switched Draw into a different target for each draw call?
+///
+/// \return Average time spent per draw call
+///
+////////////////////////////////////////////////////////////
+sf::Time pingPong(std::vector<sf::RenderTexture>& targets, bool switched)
+{
+    sf::RectangleShape rectangle(sf::Vector2f(targetSize) / 2.f);
+    rectangle.setFillColor(sf::Color(255, 255, 255, 128));
+
+    const sf::Clock clock;
+
+    for (unsigned int round = 0; round < roundCount; ++round)
+    {
+        for (std::size_t i = 0; i < targets.size(); ++i)
+        {
+            // Never sample the texture of the target being drawn into
+            sf::RenderTexture& target = switched ? targets[i] : targets.front();
+            const sf::Texture& source = switched ? targets[(i + 1) % targets.size()].getTexture()
+                                                 : targets[1 + i % (targets.size() - 1)].getTexture();
+
+            target.draw(sf::Sprite(source));
+            target.draw(rectangle);
+            target.display();
+        }
+    }
+
+    return clock.getElapsedTime() / static_cast<float>(roundCount * targets.size());
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    // Create the render targets
+    std::vector<sf::RenderTexture> targets;
+    targets.reserve(targetCount);
+
+    for (std::size_t i = 0; i < targetCount; ++i)
+    {
+        try
+        {
+            targets.emplace_back(targetSize);
+        }
+        catch (const sf::Exception& exception)
+        {
+            std::cerr << exception.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        targets.back().clear(sf::Color(static_cast<std::uint8_t>(i * 4), 0, 0));
+        targets.back().display();
+    }
+
+    // Warm up the driver, so that the first measure isn't penalized
+    pingPong(targets, true);
+
+    // Measure the same workload with and without switching the render target between draw calls
+    sf::RenderTarget::resetStateChangeStatistics();
+    const sf::Time                                sameTarget     = pingPong(targets, false);
+    const sf::RenderTarget::StateChangeStatistics sameStatistics = sf::RenderTarget::getStateChangeStatistics();
+
+    sf::RenderTarget::resetStateChangeStatistics();
+    const sf::Time                                switchedTarget     = pingPong(targets, true);
+    const sf::RenderTarget::StateChangeStatistics switchedStatistics = sf::RenderTarget::getStateChangeStatistics();
+
+    std::cout << "Render target switch benchmark (" << targetCount << " targets, " << roundCount << " rounds)\n"
+              << "  same target:     " << sameTarget.asMicroseconds() << " us per draw, " << sameStatistics.issued
+              << " state changes issued, " << sameStatistics.skipped << " skipped\n"
+              << "  switched target: " << switchedTarget.asMicroseconds() << " us per draw, "
+              << switchedStatistics.issued << " state changes issued, " << switchedStatistics.skipped << " skipped\n"
+              << "  switch overhead: " << (switchedTarget - sameTarget).asMicroseconds() << " us per switch" << std::endl;
+
+    return EXIT_SUCCESS;
+}
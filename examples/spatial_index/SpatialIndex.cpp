@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Benchmark parameters
+////////////////////////////////////////////////////////////
+constexpr std::size_t  itemCount    = 50'000;
+constexpr unsigned int queryCount   = 1'000;
+constexpr std::size_t  nearestCount = 8;
+constexpr float        worldSize    = 20'000.f;
+constexpr float        itemSize     = 32.f;
+const sf::Vector2f     viewSize{1920.f, 1080.f};
+
+
+////////////////////////////////////////////////////////////
+/// Brute force reference: scan all the items for each query
+///
+////////////////////////////////////////////////////////////
+struct LinearScan
+{
+    std::vector<sf::FloatRect> bounds;
+
+    std::size_t query(const sf::FloatRect& area) const
+    {
+        std::size_t found = 0;
+        for (const sf::FloatRect& rect : bounds)
+        {
+            if (rect.findIntersection(area).has_value())
+                ++found;
+        }
+        return found;
+    }
+
+    std::size_t queryNearest(sf::Vector2f point, std::size_t count) const
+    {
+        std::vector<std::pair<float, std::size_t>> distances;
+        distances.reserve(bounds.size());
+
+        for (std::size_t i = 0; i < bounds.size(); ++i)
+        {
+            const sf::FloatRect& rect = bounds[i];
+            const float dx = std::max({rect.position.x - point.x, 0.f, point.x - (rect.position.x + rect.size.x)});
+            const float dy = std::max({rect.position.y - point.y, 0.f, point.y - (rect.position.y + rect.size.y)});
+            distances.emplace_back(dx * dx + dy * dy, i);
+        }
+
+        std::partial_sort(distances.begin(), distances.begin() + static_cast<std::ptrdiff_t>(count), distances.end());
+        return count;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+/// Run a query for each of the given points and measure it
+///
+/// \param points Positions to run the queries at
+/// \param query  Function running a query at a position, and returning the number of items found
+///
+/// \return Average time spent per query
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+sf::Time measure(const std::vector<sf::Vector2f>& points, F query)
+{
+    std::size_t found = 0;
+
+    const sf::Clock clock;
+
+    for (const sf::Vector2f point : points)
+        found += query(point);
+
+    const sf::Time elapsed = clock.getElapsedTime();
+
+    // Use the results so that the queries can't be optimized away
+    if (found == 0)
+        std::cout << "(nothing found)\n";
+
+    return elapsed / static_cast<float>(points.size());
+}
+
+
+////////////////////////////////////////////////////////////
+/// Print the timings of a kind of query
+///
+/// \param name    Name of the query
+/// \param linear  Average time of the linear scan
+/// \param indexed Average time of the spatial index
+///
+////////////////////////////////////////////////////////////
+void report(const char* name, sf::Time linear, sf::Time indexed)
+{
+    const float speedup = linear / std::max(indexed, sf::microseconds(1));
+
+    std::cout << "  " << name << linear.asMicroseconds() << " us linear, " << indexed.asMicroseconds()
+              << " us indexed (x" << std::fixed << std::setprecision(1) << speedup << ")\n";
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::mt19937                          generator(42);
+    std::uniform_real_distribution<float> position(0.f, worldSize);
+    std::uniform_real_distribution<float> size(itemSize / 2.f, itemSize * 2.f);
+
+    // Scatter the items across the world
+    LinearScan                                     linear;
+    sf::SpatialIndex<std::size_t>                  index(itemSize * 2.f);
+    std::vector<sf::SpatialIndex<std::size_t>::Id> ids;
+
+    const sf::Clock insertClock;
+    for (std::size_t i = 0; i < itemCount; ++i)
+    {
+        const sf::FloatRect bounds({position(generator), position(generator)}, {size(generator), size(generator)});
+        linear.bounds.push_back(bounds);
+        ids.push_back(index.insert(i, bounds));
+    }
+    const sf::Time insertTime = insertClock.getElapsedTime();
+
+    // Move all the items by a few units, as a typical frame of a game would do
+    const sf::Clock updateClock;
+    for (std::size_t i = 0; i < itemCount; ++i)
+    {
+        linear.bounds[i].position += {1.f, 2.f};
+        index.update(ids[i], linear.bounds[i]);
+    }
+    const sf::Time updateTime = updateClock.getElapsedTime();
+
+    std::vector<sf::Vector2f> points(queryCount);
+    for (sf::Vector2f& point : points)
+        point = {position(generator), position(generator)};
+
+    // Fetch the items visible through a full HD view
+    const auto linearView  = [&](sf::Vector2f point)
+    { return linear.query(sf::FloatRect(point - viewSize / 2.f, viewSize)); };
+    const auto indexedView = [&](sf::Vector2f point) { return index.query(sf::View(point, viewSize)).size(); };
+
+    // Pick the items under a point, like a mouse cursor
+    const auto linearPoint  = [&](sf::Vector2f point) { return linear.query(sf::FloatRect(point, {1.f, 1.f})); };
+    const auto indexedPoint = [&](sf::Vector2f point) { return index.query(point).size(); };
+
+    // Find the closest items
+    const auto linearNearest  = [&](sf::Vector2f point) { return linear.queryNearest(point, nearestCount); };
+    const auto indexedNearest = [&](sf::Vector2f point) { return index.queryNearest(point, nearestCount).size(); };
+
+    std::cout << "Spatial index benchmark (" << itemCount << " items, " << queryCount << " queries)\n"
+              << "  insert:  " << insertTime.asMilliseconds() << " ms for all items\n"
+              << "  update:  " << updateTime.asMilliseconds() << " ms for all items\n";
+    report("view:    ", measure(points, linearView), measure(points, indexedView));
+    report("point:   ", measure(points, linearPoint), measure(points, indexedPoint));
+    report("nearest: ", measure(points, linearNearest), measure(points, indexedNearest));
+    std::cout << std::flush;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System.hpp>
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Benchmark parameters
+////////////////////////////////////////////////////////////
+constexpr std::size_t  corpusSize = 1024 * 1024;
+constexpr unsigned int roundCount = 20;
+
+
+////////////////////////////////////////////////////////////
+/// Build a corpus of about `corpusSize` UTF-8 bytes by repeating a sample text
+///
+/// \param sample Text to repeat
+///
+/// \return Corpus, as UTF-32
+///
+////////////////////////////////////////////////////////////
+std::u32string makeCorpus(const std::u32string& sample)
+{
+    const std::size_t sampleSize = sf::String(sample).toUtf8().size();
+
+    std::u32string corpus;
+    for (std::size_t size = 0; size < corpusSize; size += sampleSize)
+        corpus += sample;
+
+    return corpus;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Measure the throughput of a conversion
+///
+/// \param conversion Function performing the conversion once, returning the converted size
+/// \param bytes      Size of the UTF-8 version of the corpus, used to compute the throughput
+///
+/// \return Throughput, in megabytes of UTF-8 text per second
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+float measure(F conversion, std::size_t bytes)
+{
+    // Accumulate the converted sizes so that the conversions can't be optimized away
+    std::size_t checksum = 0;
+
+    const sf::Clock clock;
+    for (unsigned int round = 0; round < roundCount; ++round)
+        checksum += conversion();
+
+    const float seconds = clock.getElapsedTime().asSeconds();
+    if (checksum == 0)
+        std::cerr << "Empty conversion" << std::endl;
+
+    return static_cast<float>(bytes) * roundCount / (1024.f * 1024.f) / seconds;
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    // Corpora of chat-like text in different scripts, from pure ASCII to mostly 3 and 4-byte sequences
+    const std::array<std::pair<const char*, std::u32string>, 5> corpora = {{
+        {"English", makeCorpus(U"[12:04] <player42> anyone up for a quick match on the new map? gg last round\n")},
+        {"French", makeCorpus(U"[12:05] <élodie> déjà prête, on se retrouve à côté du château\n")},
+        {"Russian", makeCorpus(U"[12:06] <Иван> привет, кто играет сегодня?\n")},
+        {"Japanese", makeCorpus(U"[12:07] <ゆき> 今日は一緒に遊びましょう！新しいマップ\n")},
+        {"Emoji", makeCorpus(U"[12:08] <kai> \U0001F600\U0001F389\U0001F525 gg \U0001F44D\U0001F3C6\n")},
+    }};
+
+    std::cout << "UTF transcoding benchmark (" << corpusSize / 1024 << " KiB corpora, " << roundCount
+              << " rounds, MB of UTF-8 per second, per-character / bulk)\n"
+              << std::fixed << std::setprecision(0);
+
+    for (const auto& [name, corpus] : corpora)
+    {
+        const sf::String     string(corpus);
+        const sf::U8String   utf8  = string.toUtf8();
+        const std::u16string utf16 = string.toUtf16();
+
+        // Reference conversions, one code point at a time through sf::Utf
+        const float fromUtf8PerCharacter = measure(
+            [&] { return sf::String::fromUtf8(utf8.begin(), utf8.end()).getSize(); },
+            utf8.size());
+        const float toUtf8PerCharacter = measure(
+            [&]
+            {
+                sf::U8String output;
+                sf::Utf32::toUtf8(corpus.begin(), corpus.end(), std::back_inserter(output));
+                return output.size();
+            },
+            utf8.size());
+        const float fromUtf16PerCharacter = measure(
+            [&] { return sf::String::fromUtf16(utf16.begin(), utf16.end()).getSize(); },
+            utf8.size());
+
+        // Bulk conversions
+        const float fromUtf8Bulk  = measure([&] { return sf::String::fromUtf8(utf8).getSize(); }, utf8.size());
+        const float toUtf8Bulk    = measure([&] { return string.toUtf8().size(); }, utf8.size());
+        const float fromUtf16Bulk = measure([&] { return sf::String::fromUtf16(utf16).getSize(); }, utf8.size());
+        const float validation    = measure([&] { return std::size_t{sf::String::isValidUtf8(utf8)}; }, utf8.size());
+
+        std::cout << "  " << std::left << std::setw(9) << name << std::right << "  fromUtf8: " << std::setw(5)
+                  << fromUtf8PerCharacter << " / " << std::setw(5) << fromUtf8Bulk << "  toUtf8: " << std::setw(5)
+                  << toUtf8PerCharacter << " / " << std::setw(5) << toUtf8Bulk << "  fromUtf16: " << std::setw(5)
+                  << fromUtf16PerCharacter << " / " << std::setw(5) << fromUtf16Bulk
+                  << "  isValidUtf8: " << std::setw(5) << validation << '\n';
+    }
+
+    std::cout << std::flush;
+
+    return EXIT_SUCCESS;
+}
@@ -29,6 +29,10 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 
+#include <SFML/Graphics/Rect.hpp>
+
+#include <optional>
+
 
 namespace sf
 {
@@ -64,6 +68,25 @@ protected:
     ///
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the object
+    ///
+    /// When culling is enabled on a render target, objects
+    /// whose culling bounds are outside of the current view
+    /// are not drawn (see `RenderTarget::setCullingEnabled`).
+    ///
+    /// The bounds must contain everything the object draws,
+    /// expressed in the coordinate system of the render states
+    /// received by `draw` (i.e. with the object's own transform
+    /// applied, if any). Returning `std::nullopt`, which is
+    /// what the default implementation does, means that the
+    /// object is never culled.
+    ///
+    /// \return Culling bounds, or `std::nullopt` if the object must not be culled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::optional<FloatRect> getCullingBounds() const;
 };
 
 } // namespace sf
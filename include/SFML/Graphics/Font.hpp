@@ -45,13 +45,6 @@
 #include <cstdint>
 
 
-#ifdef SFML_SYSTEM_ANDROID
-namespace sf::priv
-{
-class ResourceStream;
-}
-#endif
-
 namespace sf
 {
 class InputStream;
@@ -457,9 +450,7 @@ private:
     Info                         m_info;           //!< Information about the font
     mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
-#ifdef SFML_SYSTEM_ANDROID
-    std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
-#endif
+    std::shared_ptr<InputStream>      m_stream;    //!< Stream owned by the font (mounted pack file entry or Android asset)
 };
 
 } // namespace sf
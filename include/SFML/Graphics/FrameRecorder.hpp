@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <filesystem>
+#include <memory>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Image;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Records frames to image sequences in the background
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API FrameRecorder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Image formats the frames can be written in
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        Png, //!< PNG images, small but slow to encode
+        Qoi, //!< QOI images, nearly as small as PNG and much faster to encode
+        Raw  //!< Raw RGBA pixels, 4 bytes per pixel, rows from top to bottom
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief What to do with a frame when the encoding queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class OverflowPolicy
+    {
+        Drop, //!< Drop the frame, the render loop never waits for the encoders
+        Block //!< Wait for the encoders to make room, no frame is ever lost
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Settings of a recording
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Settings
+    {
+        Format         format{Format::Png};                  //!< Format of the written images
+        unsigned int   encoderCount{2};                      //!< Number of encoding threads, 0 is treated as 1
+        std::size_t    queueCapacity{8};                     //!< Maximum number of frames waiting to be encoded
+        OverflowPolicy overflowPolicy{OverflowPolicy::Drop}; //!< What to do with a frame when the queue is full
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics of the current or last recording
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t capturedFrames{};    //!< Number of frames passed to `capture`
+        std::size_t writtenFrames{};     //!< Number of frames encoded and written to disk
+        std::size_t droppedFrames{};     //!< Number of frames dropped because the queue was full
+        std::size_t failedFrames{};      //!< Number of frames which couldn't be written
+        std::size_t pendingFrames{};     //!< Number of frames being read back, queued or encoded
+        Time        averageEncodingTime; //!< Average time taken to encode and write a frame
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Stops the recording, see `stop`.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FrameRecorder();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder(const FrameRecorder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder(FrameRecorder&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameRecorder& operator=(FrameRecorder&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording frames to a directory
+    ///
+    /// Frames are written as "frame_000000.png", "frame_000001.png"
+    /// and so on (with the extension of the chosen format), numbered
+    /// in the order they are captured. Dropped frames leave a gap
+    /// in the numbering.
+    ///
+    /// Any recording in progress is stopped first. The directory
+    /// is created if it doesn't exist.
+    ///
+    /// \param directory Directory to write the frames to
+    /// \param settings  Settings of the recording
+    ///
+    /// \return `true` if the recording started, `false` if the directory can't be created
+    ///
+    /// \see `stop`, `isRecording`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool start(const std::filesystem::path& directory, const Settings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recording frames to a directory, with the default settings
+    ///
+    /// \param directory Directory to write the frames to
+    ///
+    /// \return `true` if the recording started, `false` if the directory can't be created
+    ///
+    /// \see `stop`, `isRecording`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool start(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop recording
+    ///
+    /// This function blocks until all the frames captured so far
+    /// are written to disk. It does nothing if no recording is
+    /// in progress.
+    ///
+    /// \see `start`
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a recording is in progress
+    ///
+    /// \return `true` between `start` and `stop`, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isRecording() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture what has been drawn to a render target so far
+    ///
+    /// Call this function after drawing a frame, and before calling
+    /// `display()` on a render window. The pixels are copied to
+    /// video memory asynchronously and only read back a couple of
+    /// frames later, so the render loop doesn't wait for the
+    /// graphics card. Where pixel buffers aren't supported, the
+    /// pixels are read back immediately.
+    ///
+    /// Frames read back asynchronously may still be dropped when
+    /// they reach the encoding queue; `getStatistics` counts them.
+    /// Anti-aliased render textures can't be read directly,
+    /// capture an image of their texture instead.
+    ///
+    /// \param target Render target to capture
+    ///
+    /// \return `true` if the frame was captured, `false` if it was dropped or no recording is in progress
+    ///
+    ////////////////////////////////////////////////////////////
+    bool capture(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture a frame stored in an image
+    ///
+    /// \param image Image containing the frame
+    ///
+    /// \return `true` if the frame was accepted, `false` if it was dropped or no recording is in progress
+    ///
+    ////////////////////////////////////////////////////////////
+    bool capture(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the current or last recording
+    ///
+    /// \return Recording statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FrameRecorder
+/// \ingroup graphics
+///
+/// `sf::FrameRecorder` writes the frames of a render target to
+/// a sequence of images, for example to record gameplay footage
+/// or to compare replays frame by frame.
+///
+/// The render loop only pays for starting the copy of the
+/// frame: the pixels are read back from the graphics card a
+/// couple of frames later, then handed to a pool of encoding
+/// threads through a bounded queue. When the encoders can't keep
+/// up, new frames are either dropped or wait for room in the
+/// queue, depending on `Settings::overflowPolicy`. The errors
+/// of the encoders are reported to `sf::err()` by the thread
+/// calling `capture` or `stop`.
+///
+/// Usage example:
+/// \code
+/// sf::RenderWindow window(sf::VideoMode({1280, 720}), "SFML window");
+///
+/// sf::FrameRecorder recorder;
+/// if (!recorder.start("capture", {sf::FrameRecorder::Format::Qoi}))
+///     return -1;
+///
+/// while (window.isOpen())
+/// {
+///     // Process events and draw the frame...
+///
+///     recorder.capture(window);
+///     window.display();
+/// }
+///
+/// recorder.stop();
+/// std::cout << recorder.getStatistics().droppedFrames << " frames were dropped\n";
+/// \endcode
+///
+/// \see `sf::Image`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,412 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Large set of short-lived moving quads
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty particle system
+    ///
+    /// All the memory needed by the simulation is allocated
+    /// here, once and for all.
+    ///
+    /// \param capacity Maximum number of live particles
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ParticleSystem(std::size_t capacity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Spawn a new particle
+    ///
+    /// The particle is visible right away, and moves from the
+    /// next call to `update`.
+    ///
+    /// \param position Initial position of the particle, in local coordinates
+    /// \param velocity Initial velocity of the particle, in units per second
+    /// \param color    Color of the particle
+    /// \param lifetime Time after which the particle disappears
+    ///
+    /// \return True if the particle was spawned, false if the system is full or \a lifetime isn't positive
+    ///
+    ////////////////////////////////////////////////////////////
+    bool emit(Vector2f position, Vector2f velocity, Color color, Time lifetime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Advance the simulation
+    ///
+    /// Expired particles are removed, then the others are
+    /// accelerated and moved in a single pass over the particles.
+    /// If the system was last drawn from its vertex buffer, the
+    /// same pass writes their quads straight into the buffer's
+    /// memory; an OpenGL context is then activated if none is
+    /// active in the calling thread. This pass is split across
+    /// threads if more than one thread is allowed.
+    ///
+    /// \param elapsed Time elapsed since the last update
+    ///
+    /// \see `setThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time elapsed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of live particles
+    ///
+    /// \return Number of live particles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of live particles
+    ///
+    /// \return Capacity of the particle system
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a particle
+    ///
+    /// Particles are stored in no particular order, and their
+    /// indices change when other particles expire.
+    ///
+    /// \param index Index of the particle, in [0, `getParticleCount()`)
+    ///
+    /// \return Position of the particle, in local coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getParticlePosition(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the particles
+    ///
+    /// The `texture` argument refers to a texture that must
+    /// exist as long as the particle system uses it. Indeed, the
+    /// particle system doesn't store its own copy of the texture,
+    /// but rather keeps a pointer to the one that you passed to
+    /// this function.
+    /// `texture` can be a null pointer to disable texturing.
+    /// If `resetRect` is `true`, the `TextureRect` property of
+    /// the particles is automatically adjusted to the size of the
+    /// new texture. If it is `false`, the texture rect is left unchanged.
+    ///
+    /// \param texture   New texture
+    /// \param resetRect Should the texture rect be reset to the size of the new texture?
+    ///
+    /// \see `getTexture`, `setTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture* texture, bool resetRect = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture that each particle will display
+    ///
+    /// \param rect Rectangle defining the region of the texture to display
+    ///
+    /// \see `getTextureRect`, `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the particles
+    ///
+    /// Particles are quads centered on their position.
+    /// The new size applies to all the particles, including
+    /// the live ones.
+    /// By default, particles are 1x1.
+    ///
+    /// \param size New size of the particles, in local units
+    ///
+    /// \see `getParticleSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setParticleSize(Vector2f size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to all the particles
+    ///
+    /// This is typically used for gravity or wind.
+    /// By default, the acceleration is (0, 0).
+    ///
+    /// \param acceleration New acceleration, in units per second squared
+    ///
+    /// \see `getAcceleration`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcceleration(Vector2f acceleration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable fading out of the particles
+    ///
+    /// When enabled, the alpha of each particle decreases
+    /// linearly with its remaining lifetime.
+    /// By default, fading out is disabled.
+    ///
+    /// \param enabled True to enable fading out, false to disable it
+    ///
+    /// \see `isFadeOutEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFadeOutEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of threads used by `update`
+    ///
+    /// The calling thread is always one of them, the others are
+    /// the workers of `sf::TaskScheduler::getDefault()`. Small
+    /// particle counts are never split, as dispatching them
+    /// would cost more than it saves.
+    /// By default, a single thread is used.
+    ///
+    /// \param count Maximum number of threads, 0 is treated as 1
+    ///
+    /// \see `getThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the particles
+    ///
+    /// \return Pointer to the texture, or `nullptr` if there is none
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by each particle
+    ///
+    /// \return Texture rectangle of the particles
+    ///
+    /// \see `setTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the particles
+    ///
+    /// \return Size of the particles, in local units
+    ///
+    /// \see `setParticleSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getParticleSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to all the particles
+    ///
+    /// \return Acceleration, in units per second squared
+    ///
+    /// \see `setAcceleration`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getAcceleration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether particles fade out
+    ///
+    /// \return True if fading out is enabled
+    ///
+    /// \see `setFadeOutEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isFadeOutEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of threads used by `update`
+    ///
+    /// \return Maximum number of threads
+    ///
+    /// \see `setThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particles to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the quads of the particles in system memory
+    ///
+    /// They are written to the staging array if it isn't current.
+    ///
+    /// \return Pointer to the vertices of the quads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Vertex* getStagedVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move a range of particles and write their quads
+    ///
+    /// \param begin    Index of the first particle
+    /// \param end      Index past the last particle
+    /// \param elapsed  Time elapsed since the last update, in seconds
+    /// \param vertices Quads of all the particles, or a null pointer to only move them
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateRange(std::size_t begin, std::size_t end, float elapsed, Vertex* vertices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the quads of a range of particles
+    ///
+    /// \param begin    Index of the first particle
+    /// \param end      Index past the last particle
+    /// \param vertices Quads of all the particles, only written to
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeVertices(std::size_t begin, std::size_t end, Vertex* vertices) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t                         m_capacity;               //!< Maximum number of live particles
+    std::size_t                         m_count{};                //!< Number of live particles
+    std::vector<float>                  m_positionsX;             //!< Horizontal positions of the particles
+    std::vector<float>                  m_positionsY;             //!< Vertical positions of the particles
+    std::vector<float>                  m_velocitiesX;            //!< Horizontal velocities of the particles
+    std::vector<float>                  m_velocitiesY;            //!< Vertical velocities of the particles
+    std::vector<float>                  m_lifetimes;              //!< Remaining lifetimes of the particles, in seconds
+    std::vector<float>                  m_durations;              //!< Initial lifetimes of the particles, in seconds
+    std::vector<Color>                  m_colors;                 //!< Colors of the particles
+    mutable std::vector<Vertex>         m_vertices;               //!< Quads staged in system memory when they can't be streamed
+    std::vector<std::uint32_t>          m_indices;                //!< Triangles of the quads, 6 indices each
+    mutable std::optional<VertexBuffer> m_vertexBuffer;           //!< Quads streamed to the graphics card, 4 vertices each
+    mutable std::optional<IndexBuffer>  m_indexBuffer;            //!< Indices uploaded once to the graphics card
+    mutable bool                        m_bufferCurrent{};        //!< Does the vertex buffer hold the current quads?
+    mutable bool                        m_stagingCurrent{};       //!< Does the staging array hold the current quads?
+    mutable bool                        m_drawnFromBuffer{};      //!< Was the system last drawn from the vertex buffer?
+    const Texture*                      m_texture{};              //!< Texture of the particles
+    IntRect                             m_textureRect;            //!< Region of the texture displayed by each particle
+    Vector2f                            m_particleSize{1.f, 1.f}; //!< Size of the particles
+    Vector2f                            m_acceleration;           //!< Acceleration applied to all the particles
+    bool                                m_fadeOut{};              //!< Do particles fade out with their lifetime?
+    unsigned int                        m_threadCount{1};         //!< Maximum number of threads used by update
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// `sf::ParticleSystem` simulates and draws a large number of
+/// particles: small quads, optionally textured, which move with
+/// their own velocity under a common acceleration, and disappear
+/// once their lifetime has elapsed.
+///
+/// The state of the particles is stored as a structure of
+/// arrays (one array per attribute) so that `update` runs tight
+/// loops which compilers can vectorize, and its storage is
+/// allocated once by the constructor. The quads are written
+/// straight into the mapped memory of a single streaming
+/// `sf::VertexBuffer`, in the same pass as the simulation once
+/// the system has been drawn from it, and drawing then costs a
+/// single draw call. Render targets drawn on the CPU, such as
+/// `sf::SoftwareRenderTexture`, and systems without vertex
+/// buffer support write the quads to system memory instead,
+/// when they are drawn.
+///
+/// Large systems can spread `update` across several threads
+/// with `setThreadCount`.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem particles(100'000);
+/// particles.setParticleSize({2.f, 2.f});
+/// particles.setAcceleration({0.f, 98.f});
+/// particles.setFadeOutEnabled(true);
+/// particles.setThreadCount(std::thread::hardware_concurrency());
+///
+/// while (window.isOpen())
+/// {
+///     // Spawn new particles...
+///     for (int i = 0; i < 1000; ++i)
+///         particles.emit(emitterPosition, randomVelocity(), sf::Color::Yellow, sf::seconds(2.f));
+///
+///     // ...update all of them...
+///     particles.update(clock.restart());
+///
+///     // ...and draw them
+///     window.clear();
+///     window.draw(particles);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::VertexArray`
+///
+////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 
 namespace sf
 {
+class Image;
 class Shader;
 class Texture;
 
@@ -57,6 +58,7 @@ struct SFML_GRAPHICS_API RenderStates
     /// \li the identity transform
     /// \li a `nullptr` texture
     /// \li a `nullptr` shader
+    /// \li a `nullptr` image
     ///
     ////////////////////////////////////////////////////////////
     RenderStates() = default;
@@ -134,6 +136,7 @@ struct SFML_GRAPHICS_API RenderStates
     CoordinateType coordinateType{CoordinateType::Pixels}; //!< Texture coordinate type
     const Texture* texture{};                              //!< Texture
     const Shader*  shader{};                               //!< Shader
+    const Image*   image{};                                //!< Pixels of the texture, for targets drawn on the CPU
 };
 
 } // namespace sf
@@ -152,6 +155,15 @@ struct SFML_GRAPHICS_API RenderStates
 /// \li the texture: what image is mapped to the object
 /// \li the shader: what custom effect is applied to the object
 ///
+/// Render targets drawn on the CPU, such as `sf::SoftwareRenderTexture`,
+/// also accept an `sf::Image` in place of the texture. When `image`
+/// is set, these targets sample its pixels instead of reading the
+/// texture back from video memory, which lets textured geometry be
+/// drawn on machines without OpenGL. The image is sampled with
+/// nearest filtering and clamped coordinates, unless `texture` is
+/// also set, in which case its smooth and repeated flags are used.
+/// OpenGL targets ignore `image`.
+///
 /// High-level objects such as sprites or text force some of
 /// these states when they are drawn. For example, a sprite
 /// will set its own texture, so that you don't have to care
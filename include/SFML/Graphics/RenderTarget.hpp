@@ -42,6 +42,7 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <optional>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,10 +51,18 @@
 namespace sf
 {
 class Drawable;
+class IndexBuffer;
 class Shader;
 class Texture;
 class Transform;
 class VertexBuffer;
+struct VertexLayout;
+
+namespace priv
+{
+class SoftwareRasterizer;
+struct StatesCache;
+} // namespace priv
 
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
@@ -298,6 +307,59 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Vector2i mapCoordsToPixel(Vector2f point, const View& view) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable view culling
+    ///
+    /// When culling is enabled, drawing a `sf::Drawable` first
+    /// checks its culling bounds (see `Drawable::getCullingBounds`),
+    /// transformed by the render states, against the area of the
+    /// world visible through the current view, its viewport and
+    /// its scissor. Drawables entirely outside of that area are
+    /// skipped, and counted as culled.
+    ///
+    /// Only the bounds are tested: a shader moving vertices
+    /// outside of them may cause visible objects to be culled.
+    /// Primitives drawn directly from vertices or vertex buffers
+    /// are never culled.
+    ///
+    /// Culling is disabled by default.
+    ///
+    /// \param enabled `true` to enable culling, `false` to disable it
+    ///
+    /// \see `isCullingEnabled`, `getCulledDrawCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether view culling is enabled
+    ///
+    /// \return `true` if culling is enabled
+    ///
+    /// \see `setCullingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of draws skipped by view culling
+    ///
+    /// \return Number of drawables culled since the target was
+    ///         created or since the last call to `resetCulledDrawCount`
+    ///
+    /// \see `setCullingEnabled`, `resetCulledDrawCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getCulledDrawCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the number of draws skipped by view culling
+    ///
+    /// \see `getCulledDrawCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetCulledDrawCount();
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw a drawable object to the render target
     ///
@@ -321,6 +383,26 @@ public:
               PrimitiveType       type,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices of any layout
+    ///
+    /// This overload draws vertices that are not `sf::Vertex`,
+    /// such as `sf::CompactVertex` or `sf::PixelVertex`; the
+    /// layout describes how they are stored in memory.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param layout      Layout of the vertices
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const void*         vertices,
+              std::size_t         vertexCount,
+              const VertexLayout& layout,
+              PrimitiveType       type,
+              const RenderStates& states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -344,6 +426,159 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of 16-bit indices
+    ///
+    /// The primitives are made of the vertices referenced by the
+    /// indices, in order. Indices are not checked against the
+    /// number of vertices, out of range indices lead to undefined
+    /// behavior.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint16_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of 32-bit indices
+    ///
+    /// Nothing is drawn if 32-bit indices are not supported,
+    /// see `sf::IndexBuffer::isUint32Available`.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// The primitive type of the vertex buffer is used.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Index of the first index to use
+    /// \param indexCount   Number of indices to use
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of vertices encoding a single instance in the instance data of instanced draws
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t InstanceVertexCount{3};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw many copies of a mesh in a single draw call
+    ///
+    /// The mesh is drawn `instanceCount` times, each copy using
+    /// the attributes of an instance stored in `instanceData`.
+    /// Each instance is encoded into `InstanceVertexCount`
+    /// consecutive vertices, which are best filled with
+    /// `encodeInstance`. The attributes of an instance are:
+    /// \li a transform, applied to the mesh before `states.transform`
+    /// \li a color, which modulates the colors of the mesh vertices
+    /// \li a texture rectangle: the texture coordinates of the mesh
+    ///     are scaled by its size and offset by its position
+    ///
+    /// If `states.shader` is null, a built-in shader applies these
+    /// attributes. A custom shader must apply them itself, by
+    /// declaring (some of) the following vertex attributes:
+    /// \code
+    /// attribute vec2 sf_instanceTransform0;      // First column of the 2D transform
+    /// attribute vec2 sf_instanceTransform1;      // Second column of the 2D transform
+    /// attribute vec2 sf_instanceTransform2;      // Translation of the 2D transform
+    /// attribute vec4 sf_instanceColor;           // Color
+    /// attribute vec2 sf_instanceTexturePosition; // Position of the texture rectangle
+    /// attribute vec2 sf_instanceTextureSize;     // Size of the texture rectangle
+    ///
+    /// void main()
+    /// {
+    ///     vec2 position = sf_instanceTransform0 * gl_Vertex.x + sf_instanceTransform1 * gl_Vertex.y +
+    ///                     sf_instanceTransform2;
+    ///     gl_Position = gl_ModelViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    ///     ...
+    /// }
+    /// \endcode
+    ///
+    /// The instances are drawn with a single draw call if the
+    /// system supports hardware instancing, otherwise they are
+    /// drawn one after the other. Instanced drawing requires
+    /// support for vertex buffers and shaders, nothing is
+    /// drawn if they are not available.
+    ///
+    /// \param mesh          Vertex buffer containing the mesh to draw
+    /// \param instanceData  Vertex buffer containing the encoded instances
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    /// \see `encodeInstance`
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstanced(const VertexBuffer& mesh,
+                       const VertexBuffer& instanceData,
+                       std::size_t         instanceCount,
+                       const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode the attributes of an instance into vertices, for instanced draws
+    ///
+    /// Only the 2D part of `transform` is encoded. The default
+    /// texture rectangle leaves the texture coordinates of the
+    /// mesh untouched.
+    ///
+    /// \param transform   Transform of the instance
+    /// \param color       Color of the instance
+    /// \param textureRect Texture rectangle of the instance
+    ///
+    /// \return Vertices encoding the instance
+    ///
+    /// \see `drawInstanced`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::array<Vertex, InstanceVertexCount> encodeInstance(
+        const Transform& transform,
+        Color            color       = Color::White,
+        const FloatRect& textureRect = FloatRect({0, 0}, {1, 1}));
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -360,6 +595,20 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] virtual bool isSrgb() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell if the render target is drawn on the CPU
+    ///
+    /// Such targets, like `sf::SoftwareRenderTexture`, have no
+    /// OpenGL context: drawables should send them client-side
+    /// vertices rather than `sf::VertexBuffer`s, which they can't
+    /// draw, and may provide their textures as `sf::Image`s
+    /// through `RenderStates::image`.
+    ///
+    /// \return `true` if the target is drawn on the CPU, `false` if it is drawn by OpenGL
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSoftware() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the render target for rendering
     ///
@@ -450,6 +699,41 @@ public:
     ////////////////////////////////////////////////////////////
     void resetGLStates();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the OpenGL state changes of a context
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StateChangeStatistics
+    {
+        std::uint64_t issued{};  //!< Number of state changes sent to OpenGL
+        std::uint64_t skipped{}; //!< Number of state changes skipped because the state already had the requested value
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics about the OpenGL state changes of the active context
+    ///
+    /// SFML keeps a shadow copy of the OpenGL states of each
+    /// context, in order to skip the state changes that wouldn't
+    /// change anything. This function tells how many changes
+    /// were sent to OpenGL and how many were skipped in the
+    /// context active on the calling thread, since it was created
+    /// or since the last call to `resetStateChangeStatistics`.
+    ///
+    /// \return State change statistics, all zero if no context is active
+    ///
+    /// \see `resetStateChangeStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static StateChangeStatistics getStateChangeStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the statistics about the OpenGL state changes of the active context
+    ///
+    /// \see `getStateChangeStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resetStateChangeStatistics();
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
@@ -466,7 +750,21 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rasterizer of a target that is drawn on the CPU
+    ///
+    /// Targets returning a rasterizer have no OpenGL context:
+    /// clearing and drawing are forwarded to the rasterizer
+    /// instead of being issued to OpenGL.
+    ///
+    /// \return Pointer to the rasterizer, `nullptr` for OpenGL targets (the default)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual priv::SoftwareRasterizer* getSoftwareRasterizer();
+
 private:
+    friend class FrameRecorder;
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -523,6 +821,60 @@ private:
     ////////////////////////////////////////////////////////////
     void setupDraw(bool useVertexCache, const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a drawable is outside of the area visible through the current view
+    ///
+    /// \param drawable Drawable to test
+    /// \param states   Render states the drawable is drawn with
+    ///
+    /// \return `true` if the drawable can be skipped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isCulled(const Drawable& drawable, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Setup the vertex arrays for drawing vertices stored in system memory
+    ///
+    /// The vertices are pre-transformed into the vertex cache
+    /// if there are few enough of them.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupClientVertices(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set up the vertex arrays to read vertices of the given layout
+    ///
+    /// \param layout       Layout of the vertices
+    /// \param data         Address of the first vertex, or null for the bound vertex buffer
+    /// \param useTexCoords Whether texture coordinates are needed
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyVertexLayout(const VertexLayout& layout, const std::byte* data, bool useTexCoords);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by arrays of vertices and indices in system memory
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexSize   Size of a single index, in bytes (2 or 4)
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexed(const Vertex*       vertices,
+                     std::size_t         vertexCount,
+                     const void*         indices,
+                     std::size_t         indexSize,
+                     std::size_t         indexCount,
+                     PrimitiveType       type,
+                     const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the primitives
     ///
@@ -533,6 +885,17 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives, using indices
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param indices    Pointer to the indices, or offset in the bound index buffer
+    /// \param indexSize  Size of a single index, in bytes (2 or 4)
+    /// \param indexCount Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexSize, std::size_t indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -542,32 +905,36 @@ private:
     void cleanupDraw(const RenderStates& states);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Render states cache
+    /// \brief Check whether the render target is active in the current context
+    ///
+    /// Also updates the render states cache pointer to the
+    /// one of the current context.
+    ///
+    /// \return `true` if the render target is the active one of the current context
     ///
     ////////////////////////////////////////////////////////////
-    struct StatesCache
-    {
-        bool                  enable{};                //!< Is the cache enabled?
-        bool                  glStatesSet{};           //!< Are our internal GL states set yet?
-        bool                  viewChanged{};           //!< Has the current view changed since last draw?
-        bool                  scissorEnabled{};        //!< Is scissor testing enabled?
-        bool                  stencilEnabled{};        //!< Is stencil testing enabled?
-        BlendMode             lastBlendMode;           //!< Cached blending mode
-        StencilMode           lastStencilMode;         //!< Cached stencil
-        std::uint64_t         lastTextureId{};         //!< Cached texture
-        CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
-        bool                  texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
-        bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
-        std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
-    };
+    bool isActive();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate the render target if it isn't active in the current context
+    ///
+    /// \return `true` if the render target is active and OpenGL calls can be made
+    ///
+    ////////////////////////////////////////////////////////////
+    bool ensureActive();
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                         m_defaultView;       //!< Default view
+    View                         m_view;              //!< Current view
+    priv::StatesCache*           m_cache{};           //!< Render states cache of the context the target was last active in
+    std::uint64_t                m_id{};              //!< Unique number that identifies the RenderTarget
+    std::uint64_t                m_viewId{};          //!< Unique number that identifies the current view
+    bool                         m_cullingEnabled{};  //!< Is view culling enabled?
+    std::uint64_t                m_culledDrawCount{}; //!< Number of draws skipped by view culling
+    std::optional<std::uint64_t> m_cullingViewId;     //!< Identifier of the view the visible area was computed for
+    std::optional<FloatRect>     m_visibleArea;       //!< Area of the world visible through the view, empty if nothing is visible
 };
 
 } // namespace sf
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Recycles render-textures of recurring sizes and settings
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Constructs an empty pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys every render-texture owned by the pool,
+    /// including the ones that are still acquired.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(RenderTexturePool&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(RenderTexturePool&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Acquire a render-texture from the pool
+    ///
+    /// If an idle render-texture with exactly the same size and
+    /// attachment settings (depth, stencil, anti-aliasing and sRGB)
+    /// is available it is handed out again, otherwise a new one
+    /// is created. The returned render-texture is reset to its
+    /// default view and has smoothing and repeating disabled, but
+    /// its contents are undefined: call `RenderTexture::clear` first.
+    ///
+    /// The render-texture remains owned by the pool and stays
+    /// acquired until it is given back with `release` or `releaseAll`.
+    ///
+    /// \param size     Width and height of the render-texture
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return Pointer to the render-texture, or `nullptr` if creation failed
+    ///
+    /// \see `release`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(Vector2u size, const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a render-texture back to the pool
+    ///
+    /// This is typically called after `RenderTexture::display`,
+    /// once the resulting texture has been consumed (for example
+    /// by the next pass of a post-processing chain). The
+    /// render-texture must not be used anymore after this call,
+    /// since it may be handed out again by the next `acquire`.
+    ///
+    /// Releasing a render-texture which doesn't belong to
+    /// this pool has no effect.
+    ///
+    /// \param renderTexture Render-texture previously returned by `acquire`
+    ///
+    /// \see `acquire`, `releaseAll`
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(const RenderTexture& renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give all acquired render-textures back to the pool
+    ///
+    /// This is convenient to call once per frame, after all the
+    /// temporary targets of the frame have been consumed.
+    ///
+    /// \see `release`
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseAll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy idle render-textures that haven't been used recently
+    ///
+    /// Render-textures that are currently acquired are never destroyed.
+    /// Passing `Time::Zero` destroys all idle render-textures.
+    ///
+    /// \param maxIdleTime Idle render-textures released longer ago than this are destroyed
+    ///
+    /// \return Number of render-textures that were destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t trim(Time maxIdleTime = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render-textures currently acquired
+    ///
+    /// \return Number of acquired render-textures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getActiveCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of idle render-textures waiting to be reused
+    ///
+    /// \return Number of idle render-textures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIdleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an estimate of the video memory held by the pool
+    ///
+    /// The estimate accounts for the color texture and for the
+    /// optional multisample color and depth/stencil buffers of
+    /// every render-texture owned by the pool, acquired or idle.
+    ///
+    /// \return Estimated memory usage, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Render-texture owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::unique_ptr<RenderTexture> renderTexture; //!< Pooled render-texture
+        Vector2u                       size;          //!< Requested size
+        ContextSettings                settings;      //!< Requested settings
+        std::size_t                    memoryUsage{}; //!< Estimated memory usage, in bytes
+        Time                           releaseTime;   //!< Time of the last release, relative to the pool clock
+        bool                           acquired{};    //!< Is the render-texture currently handed out?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry> m_entries; //!< Render-textures owned by the pool
+    Clock              m_clock;   //!< Clock used to measure idle times
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Creating a `sf::RenderTexture` allocates a texture, one or
+/// more frame buffer objects and optional depth/stencil and
+/// multisample buffers. Effects that need temporary targets
+/// every frame (blur passes, bloom, post-processing chains, ...)
+/// should not pay that cost again and again.
+///
+/// `sf::RenderTexturePool` keeps the render-textures around and
+/// hands them out again when a target with the same size and
+/// settings is requested. Idle render-textures can be destroyed
+/// with `trim` to bound the memory that the pool holds, which
+/// can be monitored with `getMemoryUsage`.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// while (window.isOpen())
+/// {
+///     // ...
+///
+///     // First pass: render the scene into a temporary target
+///     sf::RenderTexture* scene = pool.acquire(window.getSize());
+///     scene->clear();
+///     scene->draw(world);
+///     scene->display();
+///
+///     // Second pass: apply an effect into another temporary target
+///     sf::RenderTexture* blurred = pool.acquire(window.getSize());
+///     blurred->clear();
+///     blurred->draw(sf::Sprite(scene->getTexture()), &blurShader);
+///     blurred->display();
+///     pool.release(*scene);
+///
+///     window.clear();
+///     window.draw(sf::Sprite(blurred->getTexture()));
+///     window.display();
+///
+///     // Everything acquired this frame can be reused by the next one
+///     pool.releaseAll();
+///
+///     // Forget about targets that haven't been needed for a while
+///     pool.trim(sf::seconds(5));
+/// }
+/// \endcode
+///
+/// \see `sf::RenderTexture`
+///
+////////////////////////////////////////////////////////////
@@ -33,18 +33,24 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class InputStream;
 class Texture;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +90,56 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Precompiled reference to a uniform variable
+    ///
+    /// A handle is retrieved once with `getUniform()`, and can
+    /// then be passed to the `setUniform()` and `setUniformArray()`
+    /// overloads instead of the uniform name, which skips the
+    /// lookup of the uniform location.
+    ///
+    /// A handle only refers to a uniform of the shader it was
+    /// retrieved from, and is invalidated when that shader is
+    /// loaded again.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API UniformHandle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid handle, which refers to no uniform.
+        /// Setting a value through an invalid handle does nothing.
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformHandle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to a uniform
+        ///
+        /// \return `true` if the uniform was found in the shader, `false` otherwise
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isValid() const;
+
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the handle from a uniform location
+        ///
+        /// \param location Location of the uniform, or -1 if not found
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit UniformHandle(int location);
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        int m_location{-1}; //!< Location of the uniform in the shader program
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -93,7 +149,7 @@ public:
     /// binding any shader.
     ///
     ////////////////////////////////////////////////////////////
-    Shader() = default;
+    Shader();
 
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
@@ -514,6 +570,133 @@ public:
                                       InputStream& geometryShaderStream,
                                       InputStream& fragmentShaderStream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex, geometry or fragment shader from a file
+    ///
+    /// This function works like `loadFromFile`, except that it
+    /// only submits the shader and returns without waiting for
+    /// it to be compiled and linked. The file is read before the
+    /// function returns.
+    ///
+    /// When the driver supports GL_KHR_parallel_shader_compile
+    /// (or its ARB equivalent) it compiles the program in the
+    /// background; otherwise the program is compiled by a single
+    /// background thread shared by all the shaders, in an OpenGL
+    /// context of its own.
+    ///
+    /// The shader keeps its previous program until `isReady()`
+    /// returns `true`, which must be checked before using it.
+    ///
+    /// \param filename Path of the vertex, geometry or fragment shader file to load
+    /// \param type     Type of shader (vertex, geometry or fragment)
+    ///
+    /// \return `true` if loading was started, `false` if it failed
+    ///
+    /// \see `loadFromMemoryAsync`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromFileAsync(const std::filesystem::path& filename, Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading both the vertex and fragment shaders from files
+    ///
+    /// \param vertexShaderFilename   Path of the vertex shader file to load
+    /// \param fragmentShaderFilename Path of the fragment shader file to load
+    ///
+    /// \return `true` if loading was started, `false` if it failed
+    ///
+    /// \see `loadFromMemoryAsync`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                         const std::filesystem::path& fragmentShaderFilename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex, geometry and fragment shaders from files
+    ///
+    /// \param vertexShaderFilename   Path of the vertex shader file to load
+    /// \param geometryShaderFilename Path of the geometry shader file to load
+    /// \param fragmentShaderFilename Path of the fragment shader file to load
+    ///
+    /// \return `true` if loading was started, `false` if it failed
+    ///
+    /// \see `loadFromMemoryAsync`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                         const std::filesystem::path& geometryShaderFilename,
+                                         const std::filesystem::path& fragmentShaderFilename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex, geometry or fragment shader from a source code in memory
+    ///
+    /// This function works like `loadFromMemory`, except that it
+    /// only submits the shader and returns without waiting for
+    /// it to be compiled and linked. The source code is copied,
+    /// it doesn't need to outlive the call.
+    ///
+    /// \param shader String containing the source code of the shader
+    /// \param type   Type of shader (vertex, geometry or fragment)
+    ///
+    /// \return `true` if loading was started, `false` if it failed
+    ///
+    /// \see `loadFromFileAsync`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromMemoryAsync(std::string_view shader, Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading both the vertex and fragment shaders from source codes in memory
+    ///
+    /// \param vertexShader   String containing the source code of the vertex shader
+    /// \param fragmentShader String containing the source code of the fragment shader
+    ///
+    /// \return `true` if loading was started, `false` if it failed
+    ///
+    /// \see `loadFromFileAsync`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromMemoryAsync(std::string_view vertexShader, std::string_view fragmentShader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading the vertex, geometry and fragment shaders from source codes in memory
+    ///
+    /// \param vertexShader   String containing the source code of the vertex shader
+    /// \param geometryShader String containing the source code of the geometry shader
+    /// \param fragmentShader String containing the source code of the fragment shader
+    ///
+    /// \return `true` if loading was started, `false` if it failed
+    ///
+    /// \see `loadFromFileAsync`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromMemoryAsync(std::string_view vertexShader,
+                                           std::string_view geometryShader,
+                                           std::string_view fragmentShader);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the shader has finished loading
+    ///
+    /// This function never blocks. Once an asynchronous load
+    /// has finished, the first call to this function installs
+    /// the new program, and returns `true`. If the compilation
+    /// failed, the errors are written to `sf::err()` and the
+    /// shader keeps its previous program.
+    ///
+    /// Uniforms must be set after the shader is ready, since
+    /// they belong to the new program.
+    ///
+    /// A shader that isn't being loaded asynchronously is
+    /// always ready. Starting a new load, synchronous or not,
+    /// discards the pending one.
+    ///
+    /// \return `true` if no asynchronous load is pending
+    ///
+    /// \see `loadFromFileAsync`, `loadFromMemoryAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady();
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
@@ -778,6 +961,317 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Use a uniform buffer for a uniform block
+    ///
+    /// \a name is the name of a uniform block declared with the
+    /// std140 layout in the shader. The values of the block are
+    /// then read from `buffer`, which can be shared by any number
+    /// of shaders:
+    /// \code
+    /// layout(std140) uniform Camera // this is the block in the shader
+    /// {
+    ///     mat4 viewProjection;
+    /// };
+    /// \endcode
+    /// \code
+    /// sf::UniformBuffer camera;
+    /// ...
+    /// if (!shader.bindUniformBlock("Camera", camera))
+    ///     shader.setUniform("viewProjection", viewProjection); // not supported, fall back to a plain uniform
+    /// \endcode
+    /// It is important to note that `buffer` must remain alive as long
+    /// as the shader uses it, no copy is made internally. The values
+    /// that changed in the buffer are uploaded when the shader is bound.
+    ///
+    /// This function fails if uniform buffers are not supported
+    /// by the system (see `UniformBuffer::isAvailable()`).
+    ///
+    /// \param name   Name of the uniform block in the shader
+    /// \param buffer Uniform buffer to read the values of the block from
+    ///
+    /// \return `true` if the block was found and bound to the buffer, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool bindUniformBlock(const std::string& name, UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow binding a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    bool bindUniformBlock(const std::string& name, UniformBuffer&& buffer) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a precompiled handle to a uniform variable
+    ///
+    /// The location of the uniform is looked up only once, the
+    /// returned handle can then be used to set its value without
+    /// any further lookup:
+    /// \code
+    /// const sf::Shader::UniformHandle offset = shader.getUniform("offset");
+    /// ...
+    /// for (const auto& sprite : sprites)
+    /// {
+    ///     shader.setUniform(offset, sprite.getPosition());
+    ///     window.draw(sprite, &shader);
+    /// }
+    /// \endcode
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle to the uniform, invalid if the shader has
+    ///         no uniform with this name
+    ///
+    /// \see `UniformHandle::isValid`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle getUniform(std::string_view name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param x       Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param x       Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param x       Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param vector  Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 matrix
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param matrix  Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 matrix
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param matrix  Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a texture as \p sampler2D uniform
+    ///
+    /// \param uniform Handle to the texture in the shader
+    /// \param texture Texture to assign
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify current texture as \p sampler2D uniform
+    ///
+    /// \param uniform Handle to the texture in the shader
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle uniform, CurrentTextureType);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p float[] array uniform
+    ///
+    /// \param uniform     Handle to the uniform variable
+    /// \param scalarArray pointer to array of \p float values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const float* scalarArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec2[] array uniform
+    ///
+    /// \param uniform     Handle to the uniform variable
+    /// \param vectorArray pointer to array of \p vec2 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Vec2* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec3[] array uniform
+    ///
+    /// \param uniform     Handle to the uniform variable
+    /// \param vectorArray pointer to array of \p vec3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Vec3* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec4[] array uniform
+    ///
+    /// \param uniform     Handle to the uniform variable
+    /// \param vectorArray pointer to array of \p vec4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Vec4* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat3[] array uniform
+    ///
+    /// \param uniform     Handle to the uniform variable
+    /// \param matrixArray pointer to array of \p mat3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Mat3* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat4[] array uniform
+    ///
+    /// \param uniform     Handle to the uniform variable
+    /// \param matrixArray pointer to array of \p mat4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle uniform, const Glsl::Mat4* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable deferred uniform uploads
+    ///
+    /// By default, setting a uniform uploads its value right away,
+    /// which requires binding the shader program and restoring the
+    /// previous one when the shader isn't currently in use.
+    ///
+    /// When deferred uploads are enabled, uniform values are
+    /// stored on the CPU side instead, and all the values that
+    /// changed are uploaded at once the next time the shader is
+    /// bound for drawing. Setting the same uniform several times
+    /// between two draws only uploads the last value.
+    ///
+    /// Disabling deferred uploads immediately uploads the values
+    /// that are still pending. Texture uniforms are not affected,
+    /// they are always bound when the shader is used.
+    ///
+    /// Deferred uploads are disabled by default.
+    ///
+    /// \param deferred `true` to defer uniform uploads, `false` to upload them immediately
+    ///
+    /// \see `isUniformUploadDeferred`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformUploadDeferred(bool deferred);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether uniform uploads are deferred
+    ///
+    /// \return `true` if uniform uploads are deferred until the shader is bound, `false` otherwise
+    ///
+    /// \see `setUniformUploadDeferred`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isUniformUploadDeferred() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -844,7 +1338,92 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the program binary cache
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BinaryCacheStatistics
+    {
+        std::uint64_t hits{};     //!< Number of programs loaded from the cache
+        std::uint64_t misses{};   //!< Number of programs compiled from source and then stored in the cache
+        std::uint64_t rejected{}; //!< Number of cached binaries that the driver refused (also counted as misses)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the directory of the program binary cache
+    ///
+    /// When a directory is set, the linked binary of every
+    /// successfully compiled shader is stored in it, and loaded
+    /// back instead of compiling the sources the next time the
+    /// same shader is loaded. This can significantly reduce the
+    /// startup time of applications that use many shaders.
+    ///
+    /// Cached binaries are identified by the shader sources and
+    /// by the vendor, renderer and version of the OpenGL driver,
+    /// so that a driver update never reuses stale binaries. If
+    /// the driver rejects a binary anyway, the shader is compiled
+    /// from its sources and the cache entry is replaced.
+    ///
+    /// The directory is created when the first binary is stored.
+    /// The cache is disabled by default; set an empty path to
+    /// disable it again. Setting a directory has no effect if
+    /// `isBinaryCacheAvailable()` returns `false`.
+    ///
+    /// \param directory Directory where the program binaries are stored
+    ///
+    /// \see `getBinaryCacheDirectory`, `getBinaryCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBinaryCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory of the program binary cache
+    ///
+    /// \return Directory of the cache, empty if the cache is disabled
+    ///
+    /// \see `setBinaryCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::filesystem::path getBinaryCacheDirectory();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports program binaries
+    ///
+    /// Program binaries require either OpenGL 4.1 or the
+    /// GL_ARB_get_program_binary extension, and a driver that
+    /// supports at least one binary format.
+    ///
+    /// \return `true` if the program binary cache can be used, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isBinaryCacheAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics about the program binary cache
+    ///
+    /// The statistics are accumulated over all shaders loaded
+    /// since the program started or since the last call to
+    /// `resetBinaryCacheStatistics`. Shaders loaded while the
+    /// cache is disabled are not counted.
+    ///
+    /// \return Program binary cache statistics
+    ///
+    /// \see `resetBinaryCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static BinaryCacheStatistics getBinaryCacheStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the statistics about the program binary cache
+    ///
+    /// \see `getBinaryCacheStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void resetBinaryCacheStatistics();
+
 private:
+    friend class RenderTarget;
+
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
     ///
@@ -862,6 +1441,40 @@ private:
                                std::string_view geometryShaderCode,
                                std::string_view fragmentShaderCode);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start compiling the shader(s) without waiting for the result
+    ///
+    /// \param vertexShaderCode   Source code of the vertex shader
+    /// \param geometryShaderCode Source code of the geometry shader
+    /// \param fragmentShaderCode Source code of the fragment shader
+    ///
+    /// \return `true` if the compilation was started, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool compileAsync(std::string vertexShaderCode,
+                                    std::string geometryShaderCode,
+                                    std::string fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the program being loaded asynchronously, if any
+    ///
+    /// This never waits for the compiler thread: a program it is
+    /// still compiling is destroyed by the thread once done.
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancelPendingProgram();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the program with a newly linked one
+    ///
+    /// The previous program is destroyed, and all the state
+    /// that depends on it is reset.
+    ///
+    /// \param shaderProgram OpenGL identifier of the linked program
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProgram(unsigned int shaderProgram);
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind all the textures used by the shader
     ///
@@ -871,6 +1484,15 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind all the uniform buffers used by the shader
+    ///
+    /// The values that changed in the buffers are uploaded
+    /// before they are bound to their binding point.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -879,7 +1501,95 @@ private:
     /// \return Location ID of the uniform, or -1 if not found
     ///
     ////////////////////////////////////////////////////////////
-    int getUniformLocation(const std::string& name);
+    int getUniformLocation(std::string_view name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the location ID of a vertex attribute of the shader
+    ///
+    /// Locations are requested from OpenGL once per program,
+    /// the shader's context must be active.
+    ///
+    /// \param name Name of the attribute to search
+    ///
+    /// \return Location ID of the attribute, or -1 if not found
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getAttributeLocation(std::string_view name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of values that can be staged for a uniform
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class UniformType
+    {
+        Float,
+        Vec2,
+        Vec3,
+        Vec4,
+        Int,
+        Ivec2,
+        Ivec3,
+        Ivec4,
+        Mat3,
+        Mat4
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a uniform, or stage them if uploads are deferred
+    ///
+    /// \param uniform Handle to the uniform variable
+    /// \param type    Type of the uniform
+    /// \param count   Number of elements (1 unless the uniform is an array)
+    /// \param values  Contiguous components of all the elements
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void setUniformValues(UniformHandle uniform, UniformType type, std::size_t count, const T* values);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a texture to a sampler uniform
+    ///
+    /// \param uniform Handle to the texture in the shader
+    /// \param texture Texture to assign
+    ///
+    /// \return `false` if all the available texture units are used, `true` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setUniformTexture(UniformHandle uniform, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the uniform values staged while deferred
+    ///
+    /// The shader program must be bound to the current context.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadStagedUniforms() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values of a float-based uniform
+    ///
+    /// The shader program must be bound to the current context.
+    ///
+    /// \param location Location of the uniform in the shader program
+    /// \param type     Type of the uniform
+    /// \param count    Number of elements
+    /// \param values   Contiguous components of all the elements
+    ///
+    ////////////////////////////////////////////////////////////
+    static void uploadUniform(int location, UniformType type, std::size_t count, const float* values);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values of an int-based uniform
+    ///
+    /// The shader program must be bound to the current context.
+    ///
+    /// \param location Location of the uniform in the shader program
+    /// \param type     Type of the uniform
+    /// \param count    Number of elements
+    /// \param values   Contiguous components of all the elements
+    ///
+    ////////////////////////////////////////////////////////////
+    static void uploadUniform(int location, UniformType type, std::size_t count, const int* values);
 
     ////////////////////////////////////////////////////////////
     /// \brief RAII object to save and restore the program
@@ -890,19 +1600,51 @@ private:
     ////////////////////////////////////////////////////////////
     struct UniformBinder;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Program being loaded asynchronously
+    ///
+    /// Implementation is private in the .cpp file.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PendingProgram;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform value waiting to be uploaded
+    ///
+    ////////////////////////////////////////////////////////////
+    struct StagedUniform
+    {
+        UniformType        type{};       //!< Type of the uniform
+        std::size_t        count{};      //!< Number of elements
+        std::vector<float> floats;       //!< Components of float-based uniforms
+        std::vector<int>   ints;         //!< Components of int-based uniforms
+        bool               dirty{};      //!< Has the value changed since it was last uploaded?
+    };
+
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int>;
+    using TextureTable   = std::unordered_map<int, const Texture*>;
+    using UniformTable   = std::unordered_map<std::string_view, int>;
+    using AttributeTable = std::unordered_map<std::string_view, int>;
+    using StagingTable   = std::unordered_map<int, StagedUniform>;
+    using BlockTable     = std::vector<UniformBuffer*>;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int                    m_shaderProgram{};         //!< OpenGL identifier for the program
+    std::uint64_t                   m_cacheId{};               //!< Unique number that identifies the program to the OpenGL state shadow
+    int                             m_currentTexture{-1};      //!< Location of the current texture in the shader
+    TextureTable                    m_textures;                //!< Texture variables in the shader, mapped to their location
+    UniformTable                    m_uniforms;                //!< Parameters location cache
+    mutable AttributeTable          m_attributes;              //!< Vertex attributes location cache
+    mutable std::deque<std::string> m_names;                   //!< Names viewed by the keys of the caches, never moved
+    BlockTable                      m_uniformBlocks;           //!< Uniform buffers, indexed by the binding point of their block
+    mutable StagingTable            m_stagedUniforms;          //!< Uniform values waiting to be uploaded
+    mutable bool                    m_stagedUniformsDirty{};   //!< Is any staged uniform waiting to be uploaded?
+    bool                            m_uniformUploadDeferred{}; //!< Are uniform uploads deferred until the shader is bound?
+    std::unique_ptr<PendingProgram> m_pendingProgram;          //!< Program being loaded asynchronously
 };
 
 } // namespace sf
@@ -969,6 +1711,20 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Uniforms that are updated often, for example once per drawn
+/// object, are best set through handles retrieved once with
+/// `getUniform()`, which skips the lookup of the uniform by name.
+/// Enabling deferred uploads with `setUniformUploadDeferred()`
+/// additionally keeps the values on the CPU side until the
+/// shader is used for drawing, so that the shader program
+/// doesn't have to be bound for every single value:
+/// \code
+/// const sf::Shader::UniformHandle offset = shader.getUniform("offset");
+/// shader.setUniformUploadDeferred(true);
+/// ...
+/// shader.setUniform(offset, 2.f);
+/// \endcode
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the `RenderWindow::draw` function:
 /// \code
@@ -1018,6 +1774,14 @@ private:
 /// sf::Shader::bind(nullptr);
 /// \endcode
 ///
+/// Compiling many shaders can noticeably slow down the startup
+/// of an application. When the driver supports it, the linked
+/// programs can be cached on disk and reloaded on the next run:
+/// \code
+/// if (sf::Shader::isBinaryCacheAvailable())
+///     sf::Shader::setBinaryCacheDirectory("cache/shaders");
+/// \endcode
+///
 /// \see `sf::Glsl`
 ///
 ////////////////////////////////////////////////////////////
@@ -283,6 +283,14 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the shape
+    ///
+    /// \return Global bounding rectangle of the shape
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<FloatRect> getCullingBounds() const override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
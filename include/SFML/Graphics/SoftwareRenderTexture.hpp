@@ -0,0 +1,270 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Target for off-screen 2D rendering on the CPU
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SoftwareRenderTexture : public RenderTarget
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Constructs a render-texture with width 0 and height 0.
+    ///
+    /// \see `resize`
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a render-texture
+    ///
+    /// After creation, the render-texture is filled with
+    /// transparent black and its stencil buffer with zeros.
+    ///
+    /// \param size Width and height of the render-texture
+    ///
+    /// \throws sf::Exception if creation was unsuccessful
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoftwareRenderTexture(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoftwareRenderTexture() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTexture(const SoftwareRenderTexture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTexture& operator=(const SoftwareRenderTexture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTexture(SoftwareRenderTexture&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTexture& operator=(SoftwareRenderTexture&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the render-texture
+    ///
+    /// The previous contents are lost: the render-texture is
+    /// filled with transparent black and its stencil buffer
+    /// with zeros. The view is reset to the default view.
+    ///
+    /// \param size Width and height of the render-texture
+    ///
+    /// \return `true` if resizing has been successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resize(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of threads used to rasterize a draw call
+    ///
+    /// Large draw calls are split in horizontal tiles which
+    /// are rasterized in parallel by the calling thread and the
+    /// workers of `sf::TaskScheduler::getDefault()`, small ones
+    /// always use the calling thread only. The result doesn't
+    /// depend on the number of threads.
+    ///
+    /// By default, a single thread is used.
+    ///
+    /// \param count Maximum number of threads, 0 is treated as 1
+    ///
+    /// \see `getThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of threads used to rasterize a draw call
+    ///
+    /// \return Maximum number of threads
+    ///
+    /// \see `setThreadCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the rendering region
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activate or deactivate the render-texture for rendering
+    ///
+    /// A software render-texture has no OpenGL context,
+    /// so there is nothing to activate.
+    ///
+    /// \param active `true` to activate, `false` to deactivate
+    ///
+    /// \return `true`, unless the render-texture has not been created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setActive(bool active = true) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the contents of the render-texture to an image
+    ///
+    /// \return Image containing the rendered pixels
+    ///
+    /// \see `getPixelsPtr`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image copyToImage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only pointer to the rendered pixels
+    ///
+    /// The returned value points to an array of RGBA pixels made of
+    /// 8 bit integer components, top row first. The size of the array
+    /// is `getSize().x * getSize().y * 4`.
+    /// Warning: the returned pointer may become invalid if you
+    /// resize the render-texture, so you should never store it.
+    ///
+    /// \return Read-only pointer to the array of pixels, `nullptr` if empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::uint8_t* getPixelsPtr() const;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rasterizer that draws into this target
+    ///
+    /// \return Pointer to the rasterizer, `nullptr` if the render-texture has not been created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] priv::SoftwareRasterizer* getSoftwareRasterizer() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<priv::SoftwareRasterizer> m_rasterizer;    //!< Color and stencil buffers, and the code drawing into them
+    unsigned int                              m_threadCount{1}; //!< Maximum number of threads used by a draw call
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoftwareRenderTexture
+/// \ingroup graphics
+///
+/// `sf::SoftwareRenderTexture` renders the same drawables as
+/// `sf::RenderTexture`, but entirely on the CPU: it needs neither
+/// a GPU nor a display server, and produces the same pixels on
+/// every machine. This makes it suitable for automated tests and
+/// server-side rendering, such as generating thumbnails.
+///
+/// Triangles, lines and points are rasterized following the
+/// OpenGL conventions (pixel centers, top-left fill rule, last
+/// pixel of lines left out), and views, viewports, scissor
+/// rectangles, blend modes, stencil modes and textures are
+/// supported.
+///
+/// There are a few limitations compared to `sf::RenderTexture`:
+/// \li shaders are not supported, draws using one are skipped
+/// \li `sf::VertexBuffer` and instanced draws are not supported, draws using one
+///     are skipped; `sf::TileMap` and `sf::ParticleSystem` detect software
+///     targets (see `isSoftware`) and draw their geometry from system memory
+/// \li `pushGLStates`, `popGLStates` and `resetGLStates` do nothing
+/// \li textures live in video memory, so drawing a textured entity
+///     (including `sf::Sprite` and `sf::Text`) reads its pixels back through
+///     OpenGL; the copy is cached until the texture is modified, but it
+///     still requires an OpenGL context to be available
+///
+/// Where no OpenGL context can be created, textures are replaced
+/// by images in system memory: any geometry can be textured by
+/// an `sf::Image` passed as `RenderStates::image`, and `sf::TileMap`
+/// accepts an `sf::Image` tileset. Such draws, like untextured
+/// geometry, never touch OpenGL at all.
+///
+/// Usage example:
+///
+/// \code
+/// // Create a new software render-texture
+/// sf::SoftwareRenderTexture texture({256, 256});
+///
+/// // Use up to 4 threads for large draw calls
+/// texture.setThreadCount(4);
+///
+/// // Draw stuff to the texture
+/// texture.clear(sf::Color::White);
+/// texture.draw(shape); // shape is a sf::Shape
+///
+/// // Draw textured geometry without OpenGL
+/// sf::RenderStates states;
+/// states.image = &image; // image is a sf::Image
+/// texture.draw(vertices, states); // vertices is a sf::VertexArray
+///
+/// // Save the result
+/// if (!texture.copyToImage().saveToFile("thumbnail.png"))
+///     return -1;
+/// \endcode
+///
+/// \see `sf::RenderTexture`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,376 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Uniform grid indexing values by their 2D bounds
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class SpatialIndex
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an item stored in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    using Id = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty index
+    ///
+    /// The cell size should be in the order of the size of
+    /// the typical item: items spanning more than a few cells
+    /// are checked by every query, while crowded cells make
+    /// queries slower.
+    ///
+    /// \param cellSize Width and height of a grid cell, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialIndex(float cellSize = 64.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an item to the index
+    ///
+    /// The identifier of a removed item may be reused by a
+    /// subsequent insertion.
+    ///
+    /// \param value  Value of the item
+    /// \param bounds Bounding rectangle of the item
+    ///
+    /// \return Identifier of the new item
+    ///
+    ////////////////////////////////////////////////////////////
+    Id insert(T value, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounds of an item
+    ///
+    /// Moving an item within the cells it already covers is
+    /// cheap, so this can be called every frame for moving
+    /// objects.
+    ///
+    /// \param id     Identifier of the item
+    /// \param bounds New bounding rectangle of the item
+    ///
+    /// \return True if the item was updated, false if \a id doesn't refer to an item
+    ///
+    ////////////////////////////////////////////////////////////
+    bool update(Id id, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an item from the index
+    ///
+    /// \param id Identifier of the item
+    ///
+    /// \return True if the item was removed, false if \a id doesn't refer to an item
+    ///
+    ////////////////////////////////////////////////////////////
+    bool remove(Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the items from the index
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of items in the index
+    ///
+    /// \return Number of items
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the grid cells
+    ///
+    /// \return Width and height of a cell, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getCellSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an identifier refers to an item of the index
+    ///
+    /// \param id Identifier to check
+    ///
+    /// \return True if \a id refers to an item
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the value of an item
+    ///
+    /// \a id must refer to an item of the index.
+    ///
+    /// \param id Identifier of the item
+    ///
+    /// \return Reference to the value of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] T& operator[](Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the value of an item
+    ///
+    /// \a id must refer to an item of the index.
+    ///
+    /// \param id Identifier of the item
+    ///
+    /// \return Const reference to the value of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const T& operator[](Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds of an item
+    ///
+    /// \a id must refer to an item of the index.
+    ///
+    /// \param id Identifier of the item
+    ///
+    /// \return Bounding rectangle of the item
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FloatRect& getBounds(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the items overlapping a rectangle
+    ///
+    /// Unlike `FloatRect::findIntersection`, edges are inclusive:
+    /// items merely touching \a area are reported too.
+    ///
+    /// \param area Rectangle to search
+    ///
+    /// \return Identifiers of the items overlapping \a area, in no particular order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Id> query(const FloatRect& area) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the items containing a point
+    ///
+    /// \param point Point to search
+    ///
+    /// \return Identifiers of the items containing \a point, in no particular order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Id> query(Vector2f point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the items visible through a view
+    ///
+    /// The whole area seen by the view is searched, including
+    /// its rotation, regardless of the view's viewport.
+    ///
+    /// \param view View to search
+    ///
+    /// \return Identifiers of the items overlapping the area seen by \a view, in no particular order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Id> query(const View& view) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the items closest to a point
+    ///
+    /// The distance of an item is the distance from \a point
+    /// to the nearest point of its bounds, so items containing
+    /// \a point are at distance 0.
+    ///
+    /// \param point Point to search from
+    /// \param count Maximum number of items to return
+    ///
+    /// \return Identifiers of the \a count closest items, sorted from the closest to the farthest
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Id> queryNearest(Vector2f point, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function for each item overlapping a rectangle
+    ///
+    /// This is the allocation-free version of `query`. The
+    /// function is called as `callback(id, value)` and must
+    /// not modify the index.
+    ///
+    /// \param area     Rectangle to search
+    /// \param callback Function to call for each item overlapping \a area
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    void forEach(const FloatRect& area, F&& callback) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Inclusive range of grid cells
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CellRange
+    {
+        int left{};   //!< Leftmost column
+        int top{};    //!< Topmost row
+        int right{};  //!< Rightmost column
+        int bottom{}; //!< Bottommost row
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Storage slot of an item
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Item
+    {
+        std::optional<T> value;  //!< Value of the item, empty if the slot is free
+        FloatRect        bounds; //!< Normalized bounds of the item
+        CellRange        cells;  //!< Cells covered by the bounds
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the range of cells covered by a normalized rectangle
+    ///
+    /// \param rect Rectangle with non-negative size
+    ///
+    /// \return Range of cells covered by \a rect
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] CellRange computeCellRange(const FloatRect& rect) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a range covers too many cells to register an item in all of them
+    ///
+    /// \param range Range of cells
+    ///
+    /// \return True if items covering \a range belong to the overflow list
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isLarge(const CellRange& range);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register an item in a range of cells
+    ///
+    /// Large ranges register the item in the overflow list instead.
+    ///
+    /// \param id    Identifier of the item
+    /// \param range Cells to register the item in
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(Id id, const CellRange& range);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unregister an item from a range of cells
+    ///
+    /// Large ranges unregister the item from the overflow list instead.
+    ///
+    /// \param id    Identifier of the item
+    /// \param range Cells to unregister the item from
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(Id id, const CellRange& range);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    float                                              m_cellSize; //!< Width and height of a grid cell
+    std::vector<Item>                                  m_items;    //!< Item slots, indexed by identifier
+    std::vector<Id>                                    m_freeIds;  //!< Identifiers of the free slots
+    std::unordered_map<std::uint64_t, std::vector<Id>> m_cells;    //!< Items registered in each non-empty cell
+    std::vector<Id>                                    m_overflow; //!< Items covering too many cells for the grid
+    std::optional<CellRange>                           m_occupied; //!< Cells that contained items since the last clear
+    std::size_t                                        m_size{};   //!< Number of items
+};
+
+} // namespace sf
+
+#include <SFML/Graphics/SpatialIndex.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialIndex
+/// \ingroup graphics
+///
+/// `sf::SpatialIndex` stores arbitrary values along with a
+/// bounding rectangle, and quickly finds the values located
+/// in a given area of the world. It is typically used to only
+/// draw the objects visible through the current view, or to
+/// find the candidates for collision tests, in scenes with
+/// many more objects than what can be tested each frame.
+///
+/// The world is divided in a uniform grid of square cells,
+/// and each item is registered in every cell its bounds cover.
+/// Items covering more than a few cells are kept in a separate
+/// list instead, that every query checks.
+/// The grid is sparse, so the world is unbounded and empty
+/// areas cost nothing. Queries only look at the cells covering
+/// the searched area, so their cost depends on the number of
+/// items around the area rather than on the total number of
+/// items.
+///
+/// Items are identified by the `sf::SpatialIndex::Id` returned
+/// by `insert`; this identifier stays valid until the item is
+/// removed, after which it may be reused by a new item.
+///
+/// Usage example:
+/// \code
+/// // Index the sprites of the scene by their position in the 'sprites' vector
+/// sf::SpatialIndex<std::size_t> index(128.f);
+///
+/// // Register the sprites once...
+/// std::vector<sf::SpatialIndex<std::size_t>::Id> ids;
+/// for (std::size_t i = 0; i < sprites.size(); ++i)
+///     ids.push_back(index.insert(i, sprites[i].getGlobalBounds()));
+///
+/// // ...update the ones that move...
+/// index.update(ids[player], sprites[player].getGlobalBounds());
+///
+/// // ...and only draw the ones that are visible
+/// for (const auto id : index.query(window.getView()))
+///     window.draw(sprites[index[id]]);
+///
+/// // Find the 3 closest sprites to the mouse cursor
+/// const sf::Vector2f cursor = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+/// const auto closest = index.queryNearest(cursor, 3);
+/// \endcode
+///
+/// \see `sf::FloatRect`, `sf::View`
+///
+////////////////////////////////////////////////////////////
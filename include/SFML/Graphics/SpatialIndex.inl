@@ -0,0 +1,583 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SpatialIndex.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline FloatRect normalizeSpatialRect(FloatRect rect)
+{
+    // Rectangles with negative dimensions are allowed, turn them into their positive equivalent
+    if (rect.size.x < 0.f)
+    {
+        rect.position.x += rect.size.x;
+        rect.size.x = -rect.size.x;
+    }
+
+    if (rect.size.y < 0.f)
+    {
+        rect.position.y += rect.size.y;
+        rect.size.y = -rect.size.y;
+    }
+
+    return rect;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline bool spatialRectsOverlap(const FloatRect& a, const FloatRect& b)
+{
+    // Edges are inclusive so that empty rectangles (points) can be found too
+    return (a.position.x <= b.position.x + b.size.x) && (b.position.x <= a.position.x + a.size.x) &&
+           (a.position.y <= b.position.y + b.size.y) && (b.position.y <= a.position.y + a.size.y);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline float spatialSquaredDistance(Vector2f point, const FloatRect& rect)
+{
+    const float dx = std::max({rect.position.x - point.x, 0.f, point.x - (rect.position.x + rect.size.x)});
+    const float dy = std::max({rect.position.y - point.y, 0.f, point.y - (rect.position.y + rect.size.y)});
+    return dx * dx + dy * dy;
+}
+
+
+////////////////////////////////////////////////////////////
+// Items covering more cells than this aren't registered in the grid, but in a list checked by every query
+inline constexpr std::int64_t maxSpatialCellsPerItem = 16;
+
+
+////////////////////////////////////////////////////////////
+// Marks of the items already visited by a search, reused from one search to the next
+struct SpatialVisitMarks
+{
+    std::vector<std::uint32_t> marks;     //!< Mark of each item, visited if equal to the current one
+    std::uint32_t              current{}; //!< Mark of the current search
+};
+
+[[nodiscard]] inline SpatialVisitMarks& getSpatialVisitMarks()
+{
+    // One set per thread, so that const searches can still run concurrently
+    thread_local SpatialVisitMarks visitMarks;
+    return visitMarks;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline std::uint64_t packSpatialCell(int x, int y)
+{
+    return (std::uint64_t{static_cast<std::uint32_t>(x)} << 32) | static_cast<std::uint32_t>(y);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline Vector2i unpackSpatialCell(std::uint64_t key)
+{
+    return {static_cast<std::int32_t>(key >> 32), static_cast<std::int32_t>(key & 0xFFFFFFFF)};
+}
+
+} // namespace priv
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+SpatialIndex<T>::SpatialIndex(float cellSize) : m_cellSize(cellSize)
+{
+    assert(cellSize > 0.f && "SpatialIndex::SpatialIndex() Cell size must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename SpatialIndex<T>::Id SpatialIndex<T>::insert(T value, const FloatRect& bounds)
+{
+    // Reuse a free slot if there is one
+    Id id = m_items.size();
+    if (m_freeIds.empty())
+    {
+        m_items.emplace_back();
+    }
+    else
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    Item& item = m_items[id];
+    item.value.emplace(std::move(value));
+    item.bounds = priv::normalizeSpatialRect(bounds);
+    item.cells  = computeCellRange(item.bounds);
+    link(id, item.cells);
+
+    ++m_size;
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool SpatialIndex<T>::update(Id id, const FloatRect& bounds)
+{
+    if (!contains(id))
+        return false;
+
+    Item& item = m_items[id];
+    item.bounds = priv::normalizeSpatialRect(bounds);
+
+    // Only touch the grid if the item moved to other cells
+    const CellRange cells = computeCellRange(item.bounds);
+    if ((cells.left != item.cells.left) || (cells.top != item.cells.top) || (cells.right != item.cells.right) ||
+        (cells.bottom != item.cells.bottom))
+    {
+        // Large items stay in the overflow list as long as they remain large
+        if (!isLarge(cells) || !isLarge(item.cells))
+        {
+            unlink(id, item.cells);
+            link(id, cells);
+        }
+
+        item.cells = cells;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool SpatialIndex<T>::remove(Id id)
+{
+    if (!contains(id))
+        return false;
+
+    Item& item = m_items[id];
+    unlink(id, item.cells);
+    item.value.reset();
+    m_freeIds.push_back(id);
+
+    --m_size;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::clear()
+{
+    m_items.clear();
+    m_freeIds.clear();
+    m_cells.clear();
+    m_overflow.clear();
+    m_occupied.reset();
+    m_size = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t SpatialIndex<T>::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+float SpatialIndex<T>::getCellSize() const
+{
+    return m_cellSize;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool SpatialIndex<T>::contains(Id id) const
+{
+    return (id < m_items.size()) && m_items[id].value.has_value();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+T& SpatialIndex<T>::operator[](Id id)
+{
+    assert(contains(id) && "SpatialIndex::operator[] Identifier doesn't refer to an item");
+    return *m_items[id].value;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const T& SpatialIndex<T>::operator[](Id id) const
+{
+    assert(contains(id) && "SpatialIndex::operator[] Identifier doesn't refer to an item");
+    return *m_items[id].value;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const FloatRect& SpatialIndex<T>::getBounds(Id id) const
+{
+    assert(contains(id) && "SpatialIndex::getBounds() Identifier doesn't refer to an item");
+    return m_items[id].bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<typename SpatialIndex<T>::Id> SpatialIndex<T>::query(const FloatRect& area) const
+{
+    std::vector<Id> result;
+    forEach(area, [&result](Id id, const T&) { result.push_back(id); });
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<typename SpatialIndex<T>::Id> SpatialIndex<T>::query(Vector2f point) const
+{
+    return query(FloatRect(point, {}));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<typename SpatialIndex<T>::Id> SpatialIndex<T>::query(const View& view) const
+{
+    // The view sees the [-1, 1] square of normalized device coordinates
+    return query(view.getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f})));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<typename SpatialIndex<T>::Id> SpatialIndex<T>::queryNearest(Vector2f point, std::size_t count) const
+{
+    if ((count == 0) || (m_size == 0))
+        return {};
+
+    // Keep the best candidates in a max-heap, so that the farthest one is the first to be replaced
+    using Candidate = std::pair<float, Id>;
+    std::priority_queue<Candidate> closest;
+
+    // Items found in several cells are only considered once, thanks to a mark unique to this search
+    priv::SpatialVisitMarks& visitMarks = priv::getSpatialVisitMarks();
+    if (visitMarks.marks.size() < m_items.size())
+        visitMarks.marks.resize(m_items.size());
+
+    if (++visitMarks.current == 0)
+    {
+        std::fill(visitMarks.marks.begin(), visitMarks.marks.end(), 0);
+        visitMarks.current = 1;
+    }
+
+    std::uint32_t* const marks = visitMarks.marks.data();
+    const std::uint32_t  mark  = visitMarks.current;
+
+    const auto consider = [&](Id id)
+    {
+        marks[id]            = mark;
+        const float distance = priv::spatialSquaredDistance(point, m_items[id].bounds);
+
+        if (closest.size() < count)
+        {
+            closest.emplace(distance, id);
+        }
+        else if (distance < closest.top().first)
+        {
+            closest.pop();
+            closest.emplace(distance, id);
+        }
+    };
+
+    // Empty the heap from the farthest to the closest candidate
+    const auto sortClosest = [&closest]
+    {
+        std::vector<Id> result(closest.size());
+        for (auto it = result.rbegin(); it != result.rend(); ++it)
+        {
+            *it = closest.top().second;
+            closest.pop();
+        }
+
+        return result;
+    };
+
+    // Large items aren't in the grid, they are always candidates
+    for (const Id id : m_overflow)
+        consider(id);
+
+    if (!m_occupied)
+        return sortClosest();
+
+    // Only the cells which ever contained items need to be searched
+    const CellRange& occupied     = *m_occupied;
+    std::size_t      visitedCells = 0;
+    const auto       visitCells   = [&](std::int64_t left, std::int64_t top, std::int64_t right, std::int64_t bottom)
+    {
+        left   = std::max<std::int64_t>(left, occupied.left);
+        top    = std::max<std::int64_t>(top, occupied.top);
+        right  = std::min<std::int64_t>(right, occupied.right);
+        bottom = std::min<std::int64_t>(bottom, occupied.bottom);
+
+        for (std::int64_t row = top; row <= bottom; ++row)
+        {
+            for (std::int64_t column = left; column <= right; ++column)
+            {
+                ++visitedCells;
+                const auto cell = m_cells.find(priv::packSpatialCell(static_cast<int>(column), static_cast<int>(row)));
+                if (cell == m_cells.end())
+                    continue;
+
+                for (const Id id : cell->second)
+                {
+                    if (marks[id] != mark)
+                        consider(id);
+                }
+            }
+        }
+    };
+
+    // Search the cells in square rings of growing radius around the cell of the point,
+    // starting with the first ring which intersects the occupied cells
+    const CellRange    center    = computeCellRange(FloatRect(point, {}));
+    const std::int64_t x         = center.left;
+    const std::int64_t y         = center.top;
+    const std::int64_t minRadius = std::max(
+        {std::int64_t{0}, occupied.left - x, x - occupied.right, occupied.top - y, y - occupied.bottom});
+    const std::int64_t maxRadius = std::max(
+        {x - occupied.left, occupied.right - x, y - occupied.top, occupied.bottom - y});
+    bool exhaustiveSearch = false;
+
+    for (std::int64_t radius = minRadius; radius <= maxRadius; ++radius)
+    {
+        if (radius == 0)
+        {
+            visitCells(x, y, x, y);
+        }
+        else
+        {
+            visitCells(x - radius, y - radius, x + radius, y - radius);
+            visitCells(x - radius, y + radius, x + radius, y + radius);
+            visitCells(x - radius, y - radius + 1, x - radius, y + radius - 1);
+            visitCells(x + radius, y - radius + 1, x + radius, y + radius - 1);
+        }
+
+        // The items not found yet are at least 'radius' whole cells away from the point
+        if (closest.size() == count)
+        {
+            const float reach = static_cast<float>(radius) * m_cellSize;
+            if (closest.top().first <= reach * reach)
+                break;
+        }
+
+        // Sparse grids: once more cells than items have been visited, checking all the items is cheaper
+        if (visitedCells > m_size)
+        {
+            exhaustiveSearch = true;
+            break;
+        }
+    }
+
+    if (exhaustiveSearch)
+    {
+        for (Id id = 0; id < m_items.size(); ++id)
+        {
+            if (m_items[id].value.has_value() && (marks[id] != mark))
+                consider(id);
+        }
+    }
+
+    return sortClosest();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+template <typename F>
+void SpatialIndex<T>::forEach(const FloatRect& area, F&& callback) const
+{
+    if (m_size == 0)
+        return;
+
+    const FloatRect searched = priv::normalizeSpatialRect(area);
+    const CellRange range    = computeCellRange(searched);
+
+    // Large items aren't in the grid, check them one by one
+    for (const Id id : m_overflow)
+    {
+        const Item& item = m_items[id];
+        if (priv::spatialRectsOverlap(item.bounds, searched))
+            callback(id, *item.value);
+    }
+
+    // An item is registered in several cells, so it is only reported from the first cell
+    // that it shares with the searched range
+    const auto visitCell = [&](int column, int row, const std::vector<Id>& ids)
+    {
+        for (const Id id : ids)
+        {
+            const Item& item = m_items[id];
+            if ((column == std::max(item.cells.left, range.left)) && (row == std::max(item.cells.top, range.top)) &&
+                priv::spatialRectsOverlap(item.bounds, searched))
+                callback(id, *item.value);
+        }
+    };
+
+    // Walk through the non-empty cells directly when there are fewer of them than cells in the searched range
+    const std::int64_t width  = std::int64_t{range.right} - range.left + 1;
+    const std::int64_t height = std::int64_t{range.bottom} - range.top + 1;
+
+    if (width * height > static_cast<std::int64_t>(m_cells.size()))
+    {
+        for (const auto& [key, ids] : m_cells)
+        {
+            const Vector2i cell = priv::unpackSpatialCell(key);
+            if ((cell.x >= range.left) && (cell.x <= range.right) && (cell.y >= range.top) && (cell.y <= range.bottom))
+                visitCell(cell.x, cell.y, ids);
+        }
+    }
+    else
+    {
+        for (int row = range.top; row <= range.bottom; ++row)
+        {
+            for (int column = range.left; column <= range.right; ++column)
+            {
+                const auto cell = m_cells.find(priv::packSpatialCell(column, row));
+                if (cell != m_cells.end())
+                    visitCell(column, row, cell->second);
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename SpatialIndex<T>::CellRange SpatialIndex<T>::computeCellRange(const FloatRect& rect) const
+{
+    const auto toCell = [this](float coordinate)
+    {
+        // Clamp far away coordinates (and NaN) so that cells can always be packed in a key
+        constexpr float limit = 1 << 30;
+        const float     cell  = std::floor(coordinate / m_cellSize);
+        return static_cast<int>((cell > -limit) ? std::min(cell, limit) : -limit);
+    };
+
+    return {toCell(rect.position.x),
+            toCell(rect.position.y),
+            toCell(rect.position.x + rect.size.x),
+            toCell(rect.position.y + rect.size.y)};
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool SpatialIndex<T>::isLarge(const CellRange& range)
+{
+    const std::int64_t width  = std::int64_t{range.right} - range.left + 1;
+    const std::int64_t height = std::int64_t{range.bottom} - range.top + 1;
+    return width * height > priv::maxSpatialCellsPerItem;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::link(Id id, const CellRange& range)
+{
+    if (isLarge(range))
+    {
+        m_overflow.push_back(id);
+        return;
+    }
+
+    for (int row = range.top; row <= range.bottom; ++row)
+    {
+        for (int column = range.left; column <= range.right; ++column)
+            m_cells[priv::packSpatialCell(column, row)].push_back(id);
+    }
+
+    if (!m_occupied)
+    {
+        m_occupied = range;
+    }
+    else
+    {
+        m_occupied->left   = std::min(m_occupied->left, range.left);
+        m_occupied->top    = std::min(m_occupied->top, range.top);
+        m_occupied->right  = std::max(m_occupied->right, range.right);
+        m_occupied->bottom = std::max(m_occupied->bottom, range.bottom);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void SpatialIndex<T>::unlink(Id id, const CellRange& range)
+{
+    if (isLarge(range))
+    {
+        // Order doesn't matter either in the overflow list
+        *std::find(m_overflow.begin(), m_overflow.end(), id) = m_overflow.back();
+        m_overflow.pop_back();
+        return;
+    }
+
+    for (int row = range.top; row <= range.bottom; ++row)
+    {
+        for (int column = range.left; column <= range.right; ++column)
+        {
+            const auto cell = m_cells.find(priv::packSpatialCell(column, row));
+            assert(cell != m_cells.end() && "SpatialIndex::unlink() Item isn't registered in its cells");
+
+            // Order within a cell doesn't matter, so swap with the last identifier instead of shifting
+            std::vector<Id>& ids = cell->second;
+            *std::find(ids.begin(), ids.end(), id) = ids.back();
+            ids.pop_back();
+
+            // Don't keep empty cells around, they would slow down the searches
+            if (ids.empty())
+                m_cells.erase(cell);
+        }
+    }
+}
+
+} // namespace sf
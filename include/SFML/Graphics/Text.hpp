@@ -92,6 +92,24 @@ public:
     ////////////////////////////////////////////////////////////
     Text(const Font&& font, String string = "", unsigned int characterSize = 30) = delete;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the text from a UTF-8 string, font and size
+    ///
+    /// The string is stored as UTF-8, see `setString(U8StringView)`.
+    ///
+    /// \param string         UTF-8 encoded text assigned to the string
+    /// \param font           Font used to draw the string
+    /// \param characterSize  Base size of characters, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    Text(const Font& font, U8StringView string, unsigned int characterSize = 30);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    Text(const Font&& font, U8StringView string, unsigned int characterSize = 30) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's string
     ///
@@ -113,6 +131,22 @@ public:
     ////////////////////////////////////////////////////////////
     void setString(const String& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the text's string from UTF-8 encoded data
+    ///
+    /// The string is stored as UTF-8 and the text layout decodes
+    /// it directly, so it takes about a quarter of the memory of
+    /// a `sf::String` for mostly-ASCII text. Setting the same
+    /// string again is free, and changing it only allocates when
+    /// it no longer fits in the previously stored string.
+    ///
+    /// \param string New string, encoded in UTF-8
+    ///
+    /// \see `getUtf8String`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setString(U8StringView string);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
@@ -262,6 +296,19 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const String& getString() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the text's string, encoded in UTF-8
+    ///
+    /// If the string was set as a `sf::String`, it is converted
+    /// the first time this function is called after the change.
+    ///
+    /// \return Text's string, encoded in UTF-8
+    ///
+    /// \see `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] U8StringView getUtf8String() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's font
     ///
@@ -400,6 +447,27 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the text
+    ///
+    /// \return Global bounding rectangle of the text
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<FloatRect> getCullingBounds() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function for each character of the string
+    ///
+    /// The characters are decoded directly from the stored
+    /// representation of the string, UTF-8 or UTF-32.
+    ///
+    /// \param count    Maximum number of characters to visit
+    /// \param function Function called with each character
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    void forEachCharacter(std::size_t count, F function) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure the text's geometry is updated
     ///
@@ -412,7 +480,10 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    String                m_string;                                    //!< String to display
+    mutable String        m_string;                                    //!< String to display, as UTF-32
+    mutable U8String      m_utf8String;                                //!< String to display, as UTF-8
+    bool                  m_isUtf8{};                                  //!< Is the string set as UTF-8?
+    mutable bool          m_stringNeedConversion{};                    //!< Is the other representation out of date?
     const Font*           m_font{};                                    //!< Font used to display the string
     unsigned int          m_characterSize{30};                         //!< Base size of characters, in pixels
     float                 m_letterSpacingFactor{1.f};                  //!< Spacing factor between letters
@@ -0,0 +1,437 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of textured tiles, drawn by chunks
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Index of a tile in the tileset
+    ///
+    ////////////////////////////////////////////////////////////
+    using Tile = std::uint32_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Special tile value for cells that display nothing
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr Tile EmptyTile{0xFFFFFFFF};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Largest supported chunk size, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int MaxChunkSize{128};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map
+    ///
+    /// All the tiles are initialized to `EmptyTile`.
+    ///
+    /// The chunk size is a trade-off between the number of draw
+    /// calls, which grows with small chunks, and the cost of
+    /// changing a tile, which grows with large chunks since the
+    /// whole chunk is uploaded again. It is clamped to the
+    /// [1, `MaxChunkSize`] range.
+    ///
+    /// \param tileset   Texture containing the tiles, laid out in rows
+    /// \param tileSize  Size of a tile, in pixels
+    /// \param mapSize   Size of the map, in tiles
+    /// \param chunkSize Width and height of a chunk, in tiles
+    ///
+    /// \see `setTileset`
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize = 64);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture&& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize = 64) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map whose tileset lives in system memory
+    ///
+    /// Such a map can only be textured by render targets drawn
+    /// on the CPU, such as `sf::SoftwareRenderTexture`, and is
+    /// meant for machines where textures can't be created.
+    /// OpenGL targets draw its tiles untextured.
+    ///
+    /// \param tileset   Image containing the tiles, laid out in rows
+    /// \param tileSize  Size of a tile, in pixels
+    /// \param mapSize   Size of the map, in tiles
+    /// \param chunkSize Width and height of a chunk, in tiles
+    ///
+    /// \see `setTileset`
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Image& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize = 64);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary image
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Image&& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize = 64) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset of the map
+    ///
+    /// The `tileset` argument refers to a texture that must
+    /// exist as long as the tile map uses it. Indeed, the tile
+    /// map doesn't store its own copy of the texture, but rather
+    /// keeps a pointer to the one that you passed to this function.
+    /// All the chunks are rebuilt the next time they are drawn.
+    ///
+    /// \param tileset New tileset
+    ///
+    /// \see `getTileset`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture& tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Texture&& tileset) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset of the map to an image in system memory
+    ///
+    /// The `tileset` argument refers to an image that must
+    /// exist as long as the tile map uses it.
+    /// All the chunks are rebuilt the next time they are drawn.
+    ///
+    /// \param tileset New tileset
+    ///
+    /// \see `getTilesetImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Image& tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary image
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTileset(const Image&& tileset) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset of the map
+    ///
+    /// The tileset must be a texture.
+    ///
+    /// \return Reference to the tileset
+    ///
+    /// \see `setTileset`, `getTilesetImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTileset() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset of the map, if it is an image
+    ///
+    /// \return Pointer to the tileset, or `nullptr` if the tileset is a texture
+    ///
+    /// \see `setTileset`, `getTileset`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Image* getTilesetImage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Tiles are numbered from left to right and top to bottom
+    /// in the tileset, starting at 0. Only the chunk containing
+    /// the tile is rebuilt, the next time it is drawn.
+    ///
+    /// \param position Coordinates of the tile in the map
+    /// \param tile     Index of the tile in the tileset, or `EmptyTile`
+    ///
+    /// \see `getTile`, `setTiles`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(Vector2u position, Tile tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a rectangular area of tiles
+    ///
+    /// \a tiles must contain `size.x * size.y` tiles, row
+    /// by row. The area must be contained in the map.
+    ///
+    /// \param position Coordinates of the top-left tile of the area
+    /// \param size     Size of the area, in tiles
+    /// \param tiles    Tiles to copy into the area
+    ///
+    /// \see `setTile`, `fill`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTiles(Vector2u position, Vector2u size, const Tile* tiles);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change all the tiles of the map
+    ///
+    /// \param tile Index of the tile in the tileset, or `EmptyTile`
+    ///
+    /// \see `setTile`, `setTiles`
+    ///
+    ////////////////////////////////////////////////////////////
+    void fill(Tile tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// \param position Coordinates of the tile in the map
+    ///
+    /// \return Index of the tile in the tileset, or `EmptyTile`
+    ///
+    /// \see `setTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Tile getTile(Vector2u position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a chunk
+    ///
+    /// \return Width and height of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks that need to be rebuilt
+    ///
+    /// Chunks are rebuilt lazily, when they are drawn.
+    ///
+    /// \return Number of chunks whose geometry is out of date
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDirtyChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// entity in the entity's coordinate system.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// tile map in the global 2D world's coordinate system.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty tile map without a tileset
+    ///
+    /// \param tileSize  Size of a tile, in pixels
+    /// \param mapSize   Size of the map, in tiles
+    /// \param chunkSize Width and height of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry of a square block of tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        std::optional<VertexBuffer> vertexBuffer; //!< Baked geometry, created when first drawn by OpenGL
+        std::vector<Vertex>         vertices;     //!< Geometry kept on the CPU, when it isn't in the vertex buffer
+        std::size_t                 quadCount{};  //!< Number of non-empty tiles in the chunk
+        bool                        dirty{true};  //!< Does the geometry need to be rebuilt?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks of the tile map to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the tile map
+    ///
+    /// \return Global bounding rectangle of the tile map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<FloatRect> getCullingBounds() const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the chunk containing a tile
+    ///
+    /// \param position Coordinates of the tile in the map
+    ///
+    /// \return Reference to the chunk containing the tile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Chunk& getChunk(Vector2u position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the tileset, texture or image
+    ///
+    /// \return Size of the tileset, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getTilesetSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the geometry of a chunk
+    ///
+    /// \param chunk    Chunk to rebuild
+    /// \param position Coordinates of the chunk, in chunks
+    /// \param upload   Move the geometry to the vertex buffer of the chunk?
+    ///
+    ////////////////////////////////////////////////////////////
+    void bakeChunk(Chunk& chunk, Vector2u position, bool upload) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*                     m_tileset{};      //!< Texture containing the tiles
+    const Image*                       m_tilesetImage{}; //!< Image containing the tiles, used instead of a texture
+    Vector2u                           m_tileSize;       //!< Size of a tile, in pixels
+    Vector2u                           m_mapSize;        //!< Size of the map, in tiles
+    unsigned int                       m_chunkSize;      //!< Width and height of a chunk, in tiles
+    Vector2u                           m_chunkCount;     //!< Number of chunks on each axis
+    std::vector<Tile>                  m_tiles;          //!< Tiles of the map, row by row
+    std::vector<std::uint16_t>         m_indices;        //!< Triangles of a full chunk, shared by all chunks
+    mutable std::optional<IndexBuffer> m_indexBuffer;    //!< m_indices, uploaded when first drawn by OpenGL
+    mutable std::vector<Chunk>         m_chunks;         //!< Chunks of the map, row by row
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// `sf::TileMap` is a drawable grid of tiles, all taken from
+/// the same texture (the tileset). It is meant for large maps
+/// which mostly stay the same from one frame to the next.
+///
+/// The map is split into square chunks, and the geometry of
+/// each chunk is baked once into a static `sf::VertexBuffer`.
+/// Drawing the map then costs one draw call per chunk overlapping
+/// the current view, regardless of the size of the map, and
+/// no per-tile work on the CPU. When tiles change, only the
+/// chunks containing them are rebuilt, the next time they
+/// become visible.
+///
+/// Chunks are only baked when they are drawn for the first
+/// time, so huge maps only use video memory for the areas
+/// that were actually seen. On systems without vertex buffer
+/// support, and when drawn to a render target drawn on the CPU
+/// such as `sf::SoftwareRenderTexture`, the geometry of the
+/// chunks is kept on the CPU. For machines where textures can't
+/// be created at all, the tileset can also be an `sf::Image`,
+/// which only software render targets can sample.
+///
+/// Usage example:
+/// \code
+/// // Load a tileset made of 32x32 tiles
+/// const sf::Texture tileset("tileset.png");
+///
+/// // Create a 4096x4096 map and fill it with grass
+/// sf::TileMap map(tileset, {32, 32}, {4096, 4096});
+/// map.fill(grassTile);
+///
+/// // Put a tree somewhere
+/// map.setTile({100, 42}, treeTile);
+///
+/// // Draw it: only the chunks visible through the window's view are drawn
+/// window.draw(map);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::Sprite`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,633 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Glsl.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Buffer of uniform values shared by several shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// \see `VertexBuffer::Usage`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Usage
+    {
+        Stream,  //!< Constantly changing data
+        Dynamic, //!< Occasionally changing data
+        Static   //!< Rarely changing data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Helper computing the std140 layout of a uniform block
+    ///
+    /// Members must be added in the order in which they are
+    /// declared in the GLSL uniform block. Each call returns
+    /// the offset of the member in the buffer, following the
+    /// alignment rules of the std140 layout.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Layout
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Types of block members
+        ///
+        ////////////////////////////////////////////////////////////
+        enum class Type
+        {
+            Float, //!< \p float scalar
+            Int,   //!< \p int scalar
+            Bool,  //!< \p bool scalar
+            Vec2,  //!< \p vec2 vector
+            Vec3,  //!< \p vec3 vector
+            Vec4,  //!< \p vec4 vector
+            Ivec2, //!< \p ivec2 vector
+            Ivec3, //!< \p ivec3 vector
+            Ivec4, //!< \p ivec4 vector
+            Bvec2, //!< \p bvec2 vector
+            Bvec3, //!< \p bvec3 vector
+            Bvec4, //!< \p bvec4 vector
+            Mat3,  //!< \p mat3 matrix
+            Mat4   //!< \p mat4 matrix
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Add a member to the block
+        ///
+        /// \param type Type of the member
+        ///
+        /// \return Offset of the member in the buffer, in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        std::size_t add(Type type);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Add an array member to the block
+        ///
+        /// In the std140 layout, the elements of an array are
+        /// always aligned to the size of a \p vec4.
+        ///
+        /// \param type   Type of the elements
+        /// \param length Number of elements in the array
+        ///
+        /// \return Offset of the first element in the buffer, in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        std::size_t addArray(Type type, std::size_t length);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the size of the block
+        ///
+        /// This is the size to pass to `UniformBuffer::create`.
+        ///
+        /// \return Size of the block with the members added so far, in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::size_t getSize() const;
+
+    private:
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        std::size_t m_size{}; //!< Size of the members added so far, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a uniform buffer with a specific usage specifier
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit UniformBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates enough graphics
+    /// memory to hold `size` bytes. All the bytes are initialized
+    /// to zero.
+    ///
+    /// If the uniform buffer already exists, its contents are
+    /// lost and it is resized.
+    ///
+    /// This function fails if uniform buffers are not supported
+    /// by the system (see `isAvailable()`).
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return `true` if creation was successful
+    ///
+    /// \see `Layout::getSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the contents of the buffer
+    ///
+    /// The contents are stored with the std140 layout, and
+    /// include the values that were not uploaded yet.
+    ///
+    /// \return Pointer to the contents of the buffer, `getSize()` bytes long
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::uint8_t* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from raw bytes
+    ///
+    /// The bytes must already follow the std140 layout.
+    /// Unlike the `set()` and `setArray()` functions, this
+    /// uploads the modified range immediately.
+    ///
+    /// \param data   Pointer to the bytes to copy
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p float member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param x      Value of the float scalar
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p vec2 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the vec2 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p vec3 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the vec3 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p vec4 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the vec4 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of an \p int member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param x      Value of the int scalar
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of an \p ivec2 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the ivec2 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of an \p ivec3 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the ivec3 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of an \p ivec4 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the ivec4 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p bool member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param x      Value of the bool scalar
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p bvec2 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the bvec2 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p bvec3 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the bvec3 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p bvec4 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param vector Value of the bvec4 vector
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p mat3 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param matrix Value of the mat3 matrix
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the value of a \p mat4 member
+    ///
+    /// \param offset Offset of the member, as returned by `Layout::add`
+    /// \param matrix Value of the mat4 matrix
+    ///
+    /// \return `true` on success, `false` if the member doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool set(std::size_t offset, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a \p float[] array member
+    ///
+    /// \param offset      Offset of the array, as returned by `Layout::addArray`
+    /// \param scalarArray pointer to array of \p float values
+    /// \param length      Number of elements in the array
+    ///
+    /// \return `true` on success, `false` if the array doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setArray(std::size_t offset, const float* scalarArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a \p vec2[] array member
+    ///
+    /// \param offset      Offset of the array, as returned by `Layout::addArray`
+    /// \param vectorArray pointer to array of \p vec2 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \return `true` on success, `false` if the array doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setArray(std::size_t offset, const Glsl::Vec2* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a \p vec3[] array member
+    ///
+    /// \param offset      Offset of the array, as returned by `Layout::addArray`
+    /// \param vectorArray pointer to array of \p vec3 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \return `true` on success, `false` if the array doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setArray(std::size_t offset, const Glsl::Vec3* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a \p vec4[] array member
+    ///
+    /// \param offset      Offset of the array, as returned by `Layout::addArray`
+    /// \param vectorArray pointer to array of \p vec4 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \return `true` on success, `false` if the array doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setArray(std::size_t offset, const Glsl::Vec4* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a \p mat3[] array member
+    ///
+    /// \param offset      Offset of the array, as returned by `Layout::addArray`
+    /// \param matrixArray pointer to array of \p mat3 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \return `true` on success, `false` if the array doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setArray(std::size_t offset, const Glsl::Mat3* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the values of a \p mat4[] array member
+    ///
+    /// \param offset      Offset of the array, as returned by `Layout::addArray`
+    /// \param matrixArray pointer to array of \p mat4 values
+    /// \param length      Number of elements in the array
+    ///
+    /// \return `true` on success, `false` if the array doesn't fit in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setArray(std::size_t offset, const Glsl::Mat4* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values that changed since the last upload
+    ///
+    /// Values set with `set()` and `setArray()` are only kept
+    /// on the CPU side until they are uploaded, either by this
+    /// function or automatically when a shader using the buffer
+    /// is bound. Only the range of bytes that changed is
+    /// uploaded.
+    ///
+    /// \return `true` if the upload was successful or there was nothing to upload
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool upload();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this uniform buffer
+    ///
+    /// Changing the usage specifier takes effect the next
+    /// time the buffer is created.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this uniform buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// This function should always be called before using
+    /// the uniform buffer features. If it returns `false`, then
+    /// any attempt to use `sf::UniformBuffer` will fail, and
+    /// the values have to be set on each shader with
+    /// `Shader::setUniform()` instead.
+    ///
+    /// \return `true` if uniform buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    friend class Shader;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy bytes into the CPU-side copy of the buffer
+    ///
+    /// \param offset Offset in the buffer to copy to, in bytes
+    /// \param data   Pointer to the bytes to copy
+    /// \param size   Number of bytes to copy
+    ///
+    /// \return `true` on success, `false` if the range is out of bounds
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool write(std::size_t offset, const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check that a range of bytes fits in the buffer
+    ///
+    /// An error is printed if it doesn't.
+    ///
+    /// \param offset Offset of the range, in bytes
+    /// \param size   Size of the range, in bytes
+    ///
+    /// \return `true` if the range is within the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool checkRange(std::size_t offset, std::size_t size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the range of bytes that changed, if any
+    ///
+    /// The buffer must have been created.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadDirtyRange();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int              m_buffer{};              //!< Internal buffer identifier
+    std::uint64_t             m_cacheId{};             //!< Unique number that identifies the buffer to the OpenGL state shadow
+    std::vector<std::uint8_t> m_data;                  //!< CPU-side copy of the contents of the buffer
+    std::size_t               m_dirtyBegin{};          //!< Beginning of the range of bytes that changed since the last upload
+    std::size_t               m_dirtyEnd{};            //!< End of the range of bytes that changed since the last upload
+    Usage                     m_usage{Usage::Dynamic}; //!< How this uniform buffer is to be used
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` stores the values of a GLSL uniform
+/// block in graphics memory. Unlike regular uniforms, which
+/// belong to a single shader, the same uniform buffer can be
+/// used by any number of shaders: values that are common to
+/// many shaders, like the camera or the lighting parameters,
+/// are then uploaded only once and shared by all of them.
+///
+/// The contents of the buffer follow the std140 layout,
+/// which must be requested in the GLSL declaration of the
+/// block. `sf::UniformBuffer::Layout` computes the offset
+/// of each member according to the rules of this layout.
+///
+/// Values are first written to a CPU-side copy of the buffer,
+/// and the range of bytes that changed is uploaded at once,
+/// either explicitly with `upload()` or automatically the
+/// next time a shader using the buffer is bound.
+///
+/// Uniform buffers require OpenGL 3.1 or the
+/// \p ARB_uniform_buffer_object extension. If they are not
+/// supported (see `isAvailable()`), the same values must be
+/// set on each shader with `sf::Shader::setUniform()` instead.
+///
+/// Usage example:
+/// \code
+/// // uniform, in the shaders:
+/// // layout(std140) uniform Camera
+/// // {
+/// //     mat4 viewProjection;
+/// //     vec2 resolution;
+/// //     float time;
+/// // };
+///
+/// sf::UniformBuffer::Layout layout;
+/// const std::size_t viewProjection = layout.add(sf::UniformBuffer::Layout::Type::Mat4);
+/// const std::size_t resolution     = layout.add(sf::UniformBuffer::Layout::Type::Vec2);
+/// const std::size_t time           = layout.add(sf::UniformBuffer::Layout::Type::Float);
+///
+/// sf::UniformBuffer camera;
+/// if (!camera.create(layout.getSize()))
+///     return -1;
+///
+/// for (sf::Shader& shader : materials)
+///     shader.bindUniformBlock("Camera", camera);
+///
+/// // Once per frame
+/// camera.set(viewProjection, sf::Glsl::Mat4(view.getTransform()));
+/// camera.set(resolution, sf::Glsl::Vec2(window.getSize()));
+/// camera.set(time, clock.getElapsedTime().asSeconds());
+/// \endcode
+///
+/// \see `sf::Shader`
+///
+////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 
+#include <optional>
 #include <vector>
 
 #include <cstddef>
@@ -185,11 +186,27 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the vertex array
+    ///
+    /// Unlike `getBounds`, the result is cached until the
+    /// vertices are accessed for writing through `operator[]`,
+    /// `append`, `resize` or `clear`. A vertex modified through
+    /// a reference obtained before the last culling test is
+    /// therefore not taken into account until the next write
+    /// access.
+    ///
+    /// \return Bounding rectangle of the vertex array
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<FloatRect> getCullingBounds() const override;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<Vertex> m_vertices;                             //!< Vertices contained in the array
-    PrimitiveType       m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    std::vector<Vertex>              m_vertices;                             //!< Vertices contained in the array
+    PrimitiveType                    m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    mutable std::optional<FloatRect> m_cullingBounds;                        //!< Cached culling bounds, or empty
 };
 
 } // namespace sf
@@ -205,6 +222,13 @@ private:
 /// It inherits `sf::Drawable`, but unlike other drawables it
 /// is not transformable.
 ///
+/// When view culling is enabled on the render target, the
+/// bounds of the array are computed once and reused until a
+/// vertex is accessed for writing. Vertices modified through
+/// a reference kept across draws may then be culled based on
+/// their previous positions; access them through `operator[]`
+/// again after drawing to make the array recompute its bounds.
+///
 /// Example:
 /// \code
 /// sf::VertexArray lines(sf::PrimitiveType::LineStrip, 4);
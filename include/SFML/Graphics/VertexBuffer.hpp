@@ -32,16 +32,17 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class RenderTarget;
-struct Vertex;
 
 ////////////////////////////////////////////////////////////
 /// \brief Vertex buffer storage for one or more 2D primitives
@@ -110,6 +111,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Copy constructor
     ///
+    /// The buffer to copy must not be mapped, since the
+    /// contents of a mapped buffer can't be read by the GPU.
+    ///
     /// \param copy instance to copy
     ///
     ////////////////////////////////////////////////////////////
@@ -132,6 +136,9 @@ public:
     /// as `vertexCount`. Don't forget to recreate with a non-zero
     /// value when graphics memory should be allocated again.
     ///
+    /// If the buffer is mapped, it is unmapped and the pointer
+    /// returned by `map` becomes invalid.
+    ///
     /// \param vertexCount Number of vertices worth of memory to allocate
     ///
     /// \return `true` if creation was successful
@@ -157,8 +164,9 @@ public:
     /// array. Passing invalid arguments will lead to undefined
     /// behavior.
     ///
-    /// This function does nothing if `vertices` is null or if the
-    /// buffer was not previously created.
+    /// This function does nothing if `vertices` is null, if the
+    /// buffer was not previously created or if its layout isn't
+    /// `VertexLayout::Default`.
     ///
     /// \param vertices Array of vertices to copy to the buffer
     ///
@@ -200,9 +208,29 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from vertices in the buffer's layout
+    ///
+    /// This function behaves like the overload taking `sf::Vertex`,
+    /// except that `vertices` points to vertices stored according
+    /// to the layout of the buffer, which can be any layout.
+    ///
+    /// \param vertices    Pointer to the vertices to copy to the buffer
+    /// \param vertexCount Number of vertices to copy
+    /// \param offset      Offset in the buffer to copy to, in vertices
+    ///
+    /// \return `true` if the update was successful
+    ///
+    /// \see `setLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* vertices, std::size_t vertexCount, unsigned int offset);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the contents of another buffer into this buffer
     ///
+    /// Both buffers must have the same layout.
+    ///
     /// \param vertexBuffer Vertex buffer whose contents to copy into this vertex buffer
     ///
     /// \return `true` if the copy was successful
@@ -210,9 +238,63 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const VertexBuffer& vertexBuffer);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map the buffer into system memory, for direct access to its vertices
+    ///
+    /// The returned pointer gives access to the `getVertexCount()`
+    /// vertices of the buffer, until `unmap` is called. Writing
+    /// vertices directly into the mapped memory avoids copying
+    /// them from a staging array with `update`.
+    ///
+    /// If the usage of the buffer is `Usage::Stream`, its storage
+    /// is orphaned before being mapped: the driver provides new
+    /// memory instead of waiting for the GPU to finish drawing
+    /// the previous contents. The mapped vertices are then
+    /// undefined and must all be written, but never read.
+    /// Otherwise the mapped vertices are the current contents of
+    /// the buffer, which may stall until the GPU is done with them.
+    ///
+    /// The buffer must be unmapped before it is drawn or updated.
+    /// Mapping is not supported with OpenGL ES, nor for buffers
+    /// whose layout isn't `VertexLayout::Default`.
+    ///
+    /// \return Pointer to the vertices, or a null pointer if the buffer couldn't be mapped
+    ///
+    /// \see `unmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* map();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the buffer, making the vertices written since `map` available for drawing
+    ///
+    /// The pointer returned by `map` must not be used anymore
+    /// after calling this function.
+    ///
+    /// \return `true` if the buffer was mapped and its contents are valid,
+    ///         `false` if it wasn't mapped or if its contents were lost
+    ///         while it was mapped (e.g. because of a display mode change)
+    ///
+    /// \see `map`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool unmap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the buffer is currently mapped
+    ///
+    /// \return `true` if the buffer is mapped
+    ///
+    /// \see `map`, `unmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMapped() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
+    /// Like with the copy constructor, \a right must not be mapped.
+    ///
     /// \param right Instance to assign
     ///
     /// \return Reference to self
@@ -286,6 +368,41 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Usage getUsage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layout of the vertices stored in the buffer
+    ///
+    /// The layout tells how vertices passed to `update` are stored,
+    /// and how the buffer is read when drawn. Compact layouts
+    /// use less graphics memory and bandwidth than `sf::Vertex`.
+    ///
+    /// The current contents of the buffer are kept, but are
+    /// reinterpreted with the new layout: if the size of a vertex
+    /// changes, the vertex count becomes the number of whole
+    /// vertices that fit in the allocated memory. The layout is
+    /// thus best set before calling `create` or `update`.
+    ///
+    /// The default layout is `sf::VertexLayout::Default`, which
+    /// describes `sf::Vertex`.
+    ///
+    /// \param layout Layout of the vertices
+    ///
+    /// \return `true` if the layout was applied, `false` if it is invalid
+    ///
+    /// \see `getLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setLayout(const VertexLayout& layout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layout of the vertices stored in the buffer
+    ///
+    /// \return Layout of the vertices
+    ///
+    /// \see `setLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const VertexLayout& getLayout() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind a vertex buffer for rendering
     ///
@@ -335,9 +452,12 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     unsigned int  m_buffer{};                             //!< Internal buffer identifier
+    std::uint64_t m_cacheId{};                            //!< Unique number that identifies the buffer to the OpenGL state shadow
     std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
     PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    bool          m_mapped{};                             //!< Is the buffer currently mapped?
+    VertexLayout  m_layout;                               //!< Layout of the vertices stored in the buffer
 };
 
 ////////////////////////////////////////////////////////////
@@ -395,6 +515,18 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// pending data transfers complete before the vertex buffer is sourced
 /// by the rendering pipeline.
 ///
+/// Instead of copying vertices from system memory with `update`,
+/// they can also be written straight into the buffer after mapping
+/// it with `map`. Buffers whose usage is `Usage::Stream` are
+/// orphaned when mapped or fully updated, so rewriting them every
+/// frame doesn't wait for the GPU to finish drawing the previous
+/// frame.
+///
+/// Vertices don't have to be `sf::Vertex`: with `setLayout`, the
+/// buffer can store any layout described by `sf::VertexLayout`,
+/// such as the 12-byte `sf::CompactVertex`, to save graphics
+/// memory and bandwidth.
+///
 /// It inherits `sf::Drawable`, but unlike other drawables it
 /// is not transformable.
 ///
@@ -407,8 +539,20 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// triangles.update(vertices.data());
 /// ...
 /// window.draw(triangles);
+///
+/// // Rewrite all the vertices every frame, without a staging array
+/// sf::VertexBuffer particles(sf::PrimitiveType::Points, sf::VertexBuffer::Usage::Stream);
+/// particles.create(10000);
+/// ...
+/// if (sf::Vertex* mapped = particles.map())
+/// {
+///     for (std::size_t i = 0; i < particles.getVertexCount(); ++i)
+///         mapped[i] = ...;
+///     particles.unmap();
+/// }
+/// window.draw(particles);
 /// \endcode
 ///
-/// \see `sf::Vertex`, `sf::VertexArray`
+/// \see `sf::Vertex`, `sf::VertexArray`, `sf::VertexLayout`
 ///
 ////////////////////////////////////////////////////////////
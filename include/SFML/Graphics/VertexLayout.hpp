@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Textured vertex without color, stored in 12 bytes
+///
+/// The texture coordinates are whole texels, which makes this
+/// vertex a good fit for tile maps and sprite batches drawn
+/// with `sf::CoordinateType::Pixels`.
+///
+/// \see `VertexLayout::Compact`
+///
+////////////////////////////////////////////////////////////
+struct CompactVertex
+{
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2f              position;    //!< 2D position of the vertex
+    Vector2<std::int16_t> texCoords{}; //!< Coordinates of the texel to map to the vertex
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Vertex with integer position and texture coordinates, stored in 12 bytes
+///
+/// Suited to pixel-aligned geometry such as user interfaces.
+///
+/// \see `VertexLayout::Pixel`
+///
+////////////////////////////////////////////////////////////
+struct PixelVertex
+{
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2<std::int16_t> position;            //!< 2D position of the vertex
+    Color                 color{Color::White}; //!< Color of the vertex
+    Vector2<std::int16_t> texCoords{};         //!< Coordinates of the texel to map to the vertex
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Description of how vertex attributes are stored in memory
+///
+////////////////////////////////////////////////////////////
+struct SFML_GRAPHICS_API VertexLayout
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Type of the components of a 2D attribute
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        Float, //!< 32-bit floating point components
+        Short  //!< 16-bit signed integer components, used as is (not normalized)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a 2D attribute stored in a given format
+    ///
+    /// \param format Format of the components
+    ///
+    /// \return Size of the attribute, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t getAttributeSize(Format format);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the layout describes valid vertices
+    ///
+    /// A layout is valid if its stride isn't 0 and all its
+    /// attributes fit within the stride.
+    ///
+    /// \return `true` if the layout is valid, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isValid() const;
+
+    ////////////////////////////////////////////////////////////
+    // Static member data
+    ////////////////////////////////////////////////////////////
+    // NOLINTBEGIN(readability-identifier-naming)
+    static const VertexLayout Default;  //!< Layout of `sf::Vertex`, 20 bytes
+    static const VertexLayout Compact;  //!< Layout of `sf::CompactVertex`, 12 bytes
+    static const VertexLayout Pixel;    //!< Layout of `sf::PixelVertex`, 12 bytes
+    static const VertexLayout Position; //!< Layout of `sf::Vector2f` positions, 8 bytes
+    // NOLINTEND(readability-identifier-naming)
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t                stride{sizeof(Vertex)};                       //!< Distance between two vertices, in bytes
+    Format                     positionFormat{Format::Float};                //!< Format of the position
+    std::size_t                positionOffset{offsetof(Vertex, position)};   //!< Offset of the position, in bytes
+    std::optional<std::size_t> colorOffset{offsetof(Vertex, color)};         //!< Offset of the RGBA color, if the vertices have one
+    Color                      color{Color::White};                          //!< Color of all the vertices if they have none
+    Format                     texCoordsFormat{Format::Float};               //!< Format of the texture coordinates
+    std::optional<std::size_t> texCoordsOffset{offsetof(Vertex, texCoords)}; //!< Offset of the texture coordinates, if any
+};
+
+////////////////////////////////////////////////////////////
+/// \relates VertexLayout
+/// \brief Overload of the `operator==`
+///
+/// \param left  Left operand
+/// \param right Right operand
+///
+/// \return `true` if the layouts are equal, `false` if they are different
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API bool operator==(const VertexLayout& left, const VertexLayout& right);
+
+////////////////////////////////////////////////////////////
+/// \relates VertexLayout
+/// \brief Overload of the `operator!=`
+///
+/// \param left  Left operand
+/// \param right Right operand
+///
+/// \return `true` if the layouts are different, `false` if they are equal
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_GRAPHICS_API bool operator!=(const VertexLayout& left, const VertexLayout& right);
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \struct sf::VertexLayout
+/// \ingroup graphics
+///
+/// `sf::Vertex` stores a float position, a RGBA color and float
+/// texture coordinates in 20 bytes. Many kinds of geometry don't
+/// need all of that: a tile map has no per-vertex color, solid
+/// shapes have no texture coordinates, and pixel-aligned user
+/// interfaces don't need floating point positions. Dropping
+/// what isn't needed reduces the amount of memory to store and
+/// upload, which matters when rendering is bandwidth-bound.
+///
+/// `sf::VertexLayout` describes where each attribute is stored
+/// in a vertex, and in which format. Positions and texture
+/// coordinates can be stored as floats or 16-bit integers; the
+/// color is optional, vertices without one use the layout's
+/// `color` instead. Texture coordinates are optional too, and
+/// are interpreted according to the `sf::CoordinateType` of the
+/// render states, like those of `sf::Vertex`.
+///
+/// Ready-made layouts are provided for `sf::Vertex`,
+/// `sf::CompactVertex`, `sf::PixelVertex` and plain `sf::Vector2f`
+/// positions, but any structure can be described.
+///
+/// Vertices in a custom layout can be drawn directly from memory
+/// with the corresponding `sf::RenderTarget::draw` overload, or
+/// stored in a `sf::VertexBuffer` whose layout was set with
+/// `sf::VertexBuffer::setLayout`.
+///
+/// Usage example:
+/// \code
+/// // A textured quad, in 48 bytes instead of 80
+/// const sf::CompactVertex vertices[] =
+/// {
+///     {{  0.f,   0.f}, { 0,  0}},
+///     {{100.f,   0.f}, {32,  0}},
+///     {{  0.f, 100.f}, { 0, 32}},
+///     {{100.f, 100.f}, {32, 32}}
+/// };
+/// window.draw(vertices, 4, sf::VertexLayout::Compact, sf::PrimitiveType::TriangleStrip, &texture);
+///
+/// // Solid geometry: positions only, with a single color
+/// sf::VertexLayout layout = sf::VertexLayout::Position;
+/// layout.color = sf::Color::Red;
+/// window.draw(positions.data(), positions.size(), layout, sf::PrimitiveType::Triangles);
+/// \endcode
+///
+/// \see `sf::Vertex`, `sf::VertexBuffer`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -29,7 +29,10 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.hpp>
 
+#include <SFML/System/String.hpp>
+
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <cstddef>
@@ -38,8 +41,6 @@
 
 namespace sf
 {
-class String;
-
 ////////////////////////////////////////////////////////////
 /// \brief Utility class to build blocks of data to transfer
 ///        over the network
@@ -283,6 +284,11 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator>>(String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& operator>>(U8String& data);
+
     ////////////////////////////////////////////////////////////
     /// Overload of `operator<<` to write data into the packet
     ///
@@ -349,6 +355,11 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const std::string& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& operator<<(std::string_view data);
+
     ////////////////////////////////////////////////////////////
     /// \overload
     ////////////////////////////////////////////////////////////
@@ -364,6 +375,11 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& operator<<(U8StringView data);
+
 protected:
     friend class TcpSocket;
     friend class UdpSocket;
@@ -489,6 +505,8 @@ private:
 /// \li fixed-size integer types (`int[8|16|32]_t`, `uint[8|16|32]_t`)
 /// \li floating point numbers (`float`, `double`)
 /// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::String`)
+/// \li UTF-8 strings (`sf::U8String`), written from a `sf::U8StringView`
+///     without any conversion; `std::string_view` can be written too
 ///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
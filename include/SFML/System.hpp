@@ -31,14 +31,20 @@
 #include <SFML/Config.hpp>
 
 #include <SFML/System/Angle.hpp>
+#include <SFML/System/BufferedInputStream.hpp>
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/FramePacer.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/PackFile.hpp>
+#include <SFML/System/ResourceCache.hpp>
 #include <SFML/System/Sleep.hpp>
 #include <SFML/System/String.hpp>
+#include <SFML/System/TaskScheduler.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Utf.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Input stream decorator that reads its source in large blocks
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API BufferedInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Strategies used to refill the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Mode
+    {
+        Synchronous, //!< Refill the buffer from the calling thread when it runs empty
+        ReadAhead    //!< Read the next block in a background thread while the current one is consumed
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::uint64_t reads{};       //!< Number of calls to `read`
+        std::uint64_t bytesRead{};   //!< Number of bytes returned by `read`
+        std::uint64_t sourceReads{}; //!< Number of reads issued on the source stream
+        std::uint64_t stalls{};      //!< Number of times `read` had to wait for the source stream
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t DefaultBufferSize = 64 * 1024;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream from a source stream
+    ///
+    /// The source stream must remain alive as long as the
+    /// buffered stream uses it, and must not be used directly
+    /// in the meantime. Reading starts at the current position
+    /// of the source stream.
+    ///
+    /// In `Mode::ReadAhead` mode, two buffers of \a bufferSize
+    /// bytes are allocated and the source stream is read from
+    /// a background thread.
+    ///
+    /// \param source     Stream to read from
+    /// \param bufferSize Size of the buffer, in bytes
+    /// \param mode       Strategy used to refill the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit BufferedInputStream(InputStream& source,
+                                 std::size_t  bufferSize = DefaultBufferSize,
+                                 Mode         mode       = Mode::Synchronous);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the background read, if any, to finish.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~BufferedInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    BufferedInputStream(const BufferedInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    BufferedInputStream& operator=(const BufferedInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    BufferedInputStream(BufferedInputStream&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    BufferedInputStream& operator=(BufferedInputStream&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// Seeking within the buffered block doesn't access
+    /// the source stream.
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or `std::nullopt` on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::size_t> getSize() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the whole content of the stream
+    ///
+    /// Forwards the contiguous content of the source stream, if
+    /// any, so that loaders can still read it in place.
+    ///
+    /// \return Pointer to the content of the source stream, or `nullptr`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the read statistics
+    ///
+    /// \return Read statistics since construction or the last reset
+    ///
+    /// \see `resetStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the read statistics
+    ///
+    /// \see `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::BufferedInputStream
+/// \ingroup system
+///
+/// `sf::BufferedInputStream` wraps another `InputStream` and
+/// serves reads from a memory buffer that is refilled from
+/// the source stream in large blocks.
+///
+/// Decoders such as `sf::Music`, `sf::Font` or the image
+/// loaders issue many small reads; when the source stream
+/// is slow to access (network file systems, SD cards,
+/// archives) each of them may cost a system call or worse.
+/// Wrapping the stream turns them into a few large reads.
+///
+/// In `Mode::ReadAhead` mode, the next block is read by a
+/// background thread while the current one is consumed, so
+/// that sequential reads rarely have to wait for the source.
+/// `getStatistics` reports how many reads reached the source
+/// and how many had to wait for it (stalls).
+///
+/// Since it is an `InputStream` itself, a buffered stream can
+/// be passed to any `openFromStream` or `loadFromStream`
+/// function. As with any stream, it must stay alive for as
+/// long as the resource reads from it (e.g. `sf::Music`).
+///
+/// Usage example:
+/// \code
+/// sf::FileInputStream     file("music.ogg");
+/// sf::BufferedInputStream stream(file, 256 * 1024, sf::BufferedInputStream::Mode::ReadAhead);
+///
+/// sf::Music music;
+/// if (!music.openFromStream(stream))
+/// {
+///     // error...
+/// }
+///
+/// music.play();
+/// \endcode
+///
+/// \see `InputStream`, `FileInputStream`
+///
+////////////////////////////////////////////////////////////
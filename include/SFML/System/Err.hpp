@@ -55,6 +55,11 @@ namespace sf
 /// insertion operations defined by the STL
 /// (`operator<<`, manipulators, etc.).
 ///
+/// `sf::err()` isn't thread-safe. What SFML writes to it from
+/// its own background threads (task schedulers, shader compilation,
+/// frame encoding) is collected and written by the thread using
+/// the corresponding object instead.
+///
 /// `sf::err()` can be redirected to write to another output, independently
 /// of `std::cerr`, by using the `rdbuf()` function provided by the
 /// `std::ostream` class.
@@ -207,6 +207,6 @@ private:
 ///    process(*stream);
 /// \endcode
 ///
-/// \see `InputStream`, `MemoryInputStream`
+/// \see `InputStream`, `MemoryInputStream`, `MappedFileInputStream`
 ///
 ////////////////////////////////////////////////////////////
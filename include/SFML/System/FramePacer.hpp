@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <array>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Utility class that paces a loop to a fixed frame time
+///        and measures the time taken by each frame
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API FramePacer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Strategies used to wait for the end of a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Mode
+    {
+        Relative, //!< Sleep for the remainder of the frame; oversleeping delays all the following frames
+        Absolute  //!< Wait for absolute deadlines, sleeping then spinning for the last part of the wait
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Frame-time statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::size_t frameCount{};      //!< Number of frames measured since the last reset
+        std::size_t missedDeadlines{}; //!< Number of frames whose work wasn't done by their deadline
+        Time        minimum;           //!< Shortest frame time since the last reset
+        Time        average;           //!< Average frame time since the last reset
+        Time        maximum;           //!< Longest frame time since the last reset
+        Time        median;            //!< Median frame time over the most recent frames
+        Time        percentile95;      //!< 95th percentile of the frame time over the most recent frames
+        Time        percentile99;      //!< 99th percentile of the frame time over the most recent frames
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default time left to spin before an absolute deadline
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr Time DefaultSlack = milliseconds(2);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of frames over which percentiles are computed
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t HistorySize = 512;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the time each frame should last
+    ///
+    /// Pacing is disabled when the frame time is zero, which is
+    /// the default; frame times are measured nonetheless.
+    ///
+    /// \param frameTime Target duration of a frame
+    ///
+    /// \see `getFrameTime`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrameTime(Time frameTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time each frame should last
+    ///
+    /// \return Target duration of a frame, zero if pacing is disabled
+    ///
+    /// \see `setFrameTime`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getFrameTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the strategy used to wait for the end of a frame
+    ///
+    /// In `Mode::Relative`, the default, the pacer sleeps for
+    /// whatever remains of the frame. Since `sf::sleep` usually
+    /// oversleeps a little, frames end up slightly too long.
+    ///
+    /// In `Mode::Absolute`, frames end on a fixed schedule: a
+    /// frame that ends late is compensated by the next one, and
+    /// the pacer sleeps until `slack` before the deadline then
+    /// spins until the deadline itself. A larger slack is more
+    /// accurate but uses more CPU time.
+    ///
+    /// \param mode  Strategy used to wait
+    /// \param slack Time left to spin before a deadline, in `Mode::Absolute`
+    ///
+    /// \see `getMode`, `getSlack`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMode(Mode mode, Time slack = DefaultSlack);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the strategy used to wait for the end of a frame
+    ///
+    /// \return Strategy used to wait
+    ///
+    /// \see `setMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Mode getMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time left to spin before an absolute deadline
+    ///
+    /// \return Spinning time
+    ///
+    /// \see `setMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getSlack() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for the end of the current frame
+    ///
+    /// This function should be called once per frame, typically
+    /// after presenting it. It records the time the frame took,
+    /// from the end of the previous call to the end of this one.
+    ///
+    /// \return Duration of the frame which just ended
+    ///
+    ////////////////////////////////////////////////////////////
+    Time endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a new frame now, without waiting
+    ///
+    /// Call this after a pause (such as loading a level), so that
+    /// the pause is neither measured nor caught up with.
+    ///
+    ////////////////////////////////////////////////////////////
+    void restart();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frame-time statistics
+    ///
+    /// Minimum, average and maximum frame times cover all the
+    /// frames since the last reset, percentiles cover the last
+    /// `HistorySize` of them.
+    ///
+    /// \return Frame-time statistics
+    ///
+    /// \see `resetStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the frame-time statistics
+    ///
+    /// \see `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until the clock reaches a given time
+    ///
+    /// \param deadline Time to wait for, relative to the clock's start
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitUntil(Time deadline) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Clock                         m_clock;               //!< Time elapsed since the pacer was created or restarted
+    Time                          m_frameTime;           //!< Target duration of a frame, zero to disable pacing
+    Mode                          m_mode{};              //!< Strategy used to wait for the end of a frame
+    Time                          m_slack{DefaultSlack}; //!< Time left to spin before an absolute deadline
+    Time                          m_frameStart;          //!< Time at which the current frame started
+    Time                          m_deadline;            //!< Time at which the current frame should end, in Mode::Absolute
+    std::size_t                   m_frameCount{};        //!< Number of frames measured since the last reset
+    std::size_t                   m_missedDeadlines{};   //!< Number of frames whose work wasn't done by their deadline
+    Time                          m_minimum;             //!< Shortest frame time since the last reset
+    Time                          m_maximum;             //!< Longest frame time since the last reset
+    Time                          m_total;               //!< Sum of the frame times since the last reset
+    std::array<Time, HistorySize> m_history{};           //!< Most recent frame times, used as a ring buffer
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FramePacer
+/// \ingroup system
+///
+/// `sf::FramePacer` limits how often a loop runs, and measures
+/// how long each iteration takes. `sf::Window` uses one to
+/// implement `setFramerateLimit`; it can also pace loops that
+/// don't display anything, such as a fixed-rate server tick.
+///
+/// Usage example:
+/// \code
+/// sf::FramePacer pacer;
+/// pacer.setFrameTime(sf::seconds(1.f / 144.f));
+/// pacer.setMode(sf::FramePacer::Mode::Absolute);
+///
+/// while (running)
+/// {
+///     update();
+///     pacer.endFrame();
+/// }
+///
+/// const sf::FramePacer::Statistics statistics = pacer.getStatistics();
+/// std::cout << "99% of the frames took less than " << statistics.percentile99.asMicroseconds() << " us\n"
+///           << statistics.missedDeadlines << " frames out of " << statistics.frameCount << " were late\n";
+/// \endcode
+///
+/// \see `sf::Clock`, `sf::sleep`
+///
+////////////////////////////////////////////////////////////
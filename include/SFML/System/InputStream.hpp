@@ -90,6 +90,25 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     virtual std::optional<std::size_t> getSize() = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the whole content of the stream
+    ///
+    /// Streams whose content is entirely available in memory
+    /// can override this function so that loaders read it in
+    /// place instead of copying it through `read`. The pointed
+    /// data starts at the beginning of the stream, regardless of
+    /// the current reading position, and is `getSize()` bytes long.
+    ///
+    /// The default implementation returns a null pointer.
+    ///
+    /// \return Pointer to the content of the stream, or `nullptr` if it is not contiguous in memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual const void* getData()
+    {
+        return nullptr;
+    }
 };
 
 } // namespace sf
@@ -161,6 +180,6 @@ public:
 /// // etc.
 /// \endcode
 ///
-/// \see `FileInputStream`, `MemoryInputStream`
+/// \see `FileInputStream`, `MappedFileInputStream`, `MemoryInputStream`
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <filesystem>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on a file mapped in memory
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFileInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Construct a mapped file input stream that is not
+    /// associated with a file to read.
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MappedFileInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(MappedFileInputStream&& other) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(MappedFileInputStream&& other) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream from a file path
+    ///
+    /// \param filename Name of the file to map
+    ///
+    /// \throws sf::Exception on error
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit MappedFileInputStream(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from a file path
+    ///
+    /// The whole file is mapped read-only in the address space
+    /// of the process. If the stream was already open, the
+    /// previous file is unmapped first.
+    ///
+    /// \param filename Name of the file to map
+    ///
+    /// \return `true` on success, `false` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or `std::nullopt` on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::size_t> getSize() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the whole content of the stream
+    ///
+    /// The pointer stays valid until the stream is closed,
+    /// reopened or destroyed.
+    ///
+    /// \return Pointer to the mapped file, or `nullptr` if no file is mapped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the current file, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte* m_data{};   //!< Pointer to the mapped file
+    std::size_t      m_size{};   //!< Size of the mapped file
+    std::size_t      m_offset{}; //!< Current reading position
+    bool             m_isOpen{}; //!< Is a file open? (empty files are not mapped)
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MappedFileInputStream
+/// \ingroup system
+///
+/// This class is a specialization of `InputStream` that
+/// reads from a file on disk, mapped in memory by the
+/// operating system (`mmap` on Unix systems, file mapping
+/// objects on Windows).
+///
+/// Unlike `FileInputStream`, it exposes the content of
+/// the file as a contiguous, read-only block of memory
+/// through `getData()`. SFML loaders such as
+/// `sf::Image::loadFromStream`, `sf::Font::openFromStream`
+/// and the WAV and MP3 sound readers detect this and decode
+/// the mapped bytes in place, so large assets are not copied
+/// into an intermediate buffer, and loading the same file
+/// again reads straight from the system page cache.
+///
+/// The file must not be modified or truncated while it is
+/// mapped. Files packaged inside an Android APK cannot be
+/// mapped; use `FileInputStream` for them.
+///
+/// Usage example:
+/// \code
+/// sf::MappedFileInputStream stream("background.png");
+///
+/// sf::Image image;
+/// if (!image.loadFromStream(stream))
+/// {
+///     // error...
+/// }
+/// \endcode
+///
+/// \see `InputStream`, `FileInputStream`, `MemoryInputStream`
+///
+////////////////////////////////////////////////////////////
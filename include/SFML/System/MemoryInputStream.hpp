@@ -95,6 +95,14 @@ public:
     ////////////////////////////////////////////////////////////
     std::optional<std::size_t> getSize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the whole content of the stream
+    ///
+    /// \return Pointer to the data in memory
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -134,6 +142,6 @@ private:
 /// process(stream);
 /// \endcode
 ///
-/// \see `InputStream`, `FileInputStream`
+/// \see `InputStream`, `FileInputStream`, `MappedFileInputStream`
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Read-only archive of files, accessed through a memory-mapped hashed index
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API PackFile
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Compression methods of the entries
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Compression
+    {
+        None, //!< Entries are stored as is and read in place
+        Lz4   //!< Entries are compressed in the LZ4 block format, unless it doesn't make them smaller
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Construct a pack file that doesn't contain any entry.
+    ///
+    ////////////////////////////////////////////////////////////
+    PackFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pack file from a file on disk
+    ///
+    /// \param filename Path of the pack file to open
+    ///
+    /// \throws sf::Exception if the file can't be opened or isn't a valid pack file
+    ///
+    /// \see `open`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit PackFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Unmounts the pack file if it is mounted.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PackFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PackFile(const PackFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PackFile& operator=(const PackFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PackFile(PackFile&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PackFile& operator=(PackFile&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a pack file from disk
+    ///
+    /// The pack file is mapped in memory, only its header is
+    /// read. If another pack file was open, it is closed
+    /// (and unmounted) first.
+    ///
+    /// \param filename Path of the pack file to open
+    ///
+    /// \return `true` on success, `false` if the file can't be opened or isn't a valid pack file
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the pack file contains an entry
+    ///
+    /// \param path Path of the entry, relative to the root of the pack file
+    ///
+    /// \return `true` if the entry exists
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(const std::filesystem::path& path) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open an entry of the pack file for reading
+    ///
+    /// Stored entries are read in place from the mapped pack
+    /// file, compressed entries are decompressed in memory.
+    /// The returned stream exposes its content through
+    /// `InputStream::getData`. It shares the ownership of the
+    /// mapped pack file, so it stays valid after the pack file
+    /// is closed, reopened or destroyed.
+    ///
+    /// \param path Path of the entry, relative to the root of the pack file
+    ///
+    /// \return Stream reading the entry, or `nullptr` if it doesn't exist or is corrupted
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::unique_ptr<InputStream> openStream(const std::filesystem::path& path) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries in the pack file
+    ///
+    /// \return Number of entries
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getEntryCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the paths of all the entries in the pack file
+    ///
+    /// \return Paths of the entries, in index order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::string> getEntryPaths() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the entries available to the `loadFromFile` functions
+    ///
+    /// Once mounted, the entries of the pack file are found by
+    /// `openMountedStream`, which the SFML loaders consult
+    /// before the file system. Pack files mounted last are
+    /// searched first.
+    ///
+    /// \see `unmount`, `openMountedStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    void mount();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop making the entries available to the `loadFromFile` functions
+    ///
+    /// \see `mount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void unmount();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pack file is mounted
+    ///
+    /// \return `true` if the pack file is mounted
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMounted() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open an entry of the mounted pack files
+    ///
+    /// This function is thread-safe.
+    ///
+    /// \param path Path of the entry, relative to the root of the pack files
+    ///
+    /// \return Stream reading the entry, or `nullptr` if no mounted pack file contains it
+    ///
+    /// \see `mount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::unique_ptr<InputStream> openMountedStream(const std::filesystem::path& path);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a pack file containing all the files of a directory
+    ///
+    /// The directory is scanned recursively, entries are
+    /// named after the paths of the files relative to it,
+    /// with `/` as separator.
+    ///
+    /// \param filename    Path of the pack file to write
+    /// \param directory   Directory whose files are packed
+    /// \param compression Compression method of the entries
+    ///
+    /// \return `true` on success, `false` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool build(const std::filesystem::path& filename,
+                                    const std::filesystem::path& directory,
+                                    Compression                  compression = Compression::Lz4);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::shared_ptr<Impl> m_impl; //!< Implementation details, shared with the streams reading the entries
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PackFile
+/// \ingroup system
+///
+/// `sf::PackFile` gives access to the files stored in a
+/// single archive. Opening thousands of small files one by
+/// one costs a lot of system calls, especially on Windows
+/// and on a cold file system cache; a pack file is opened
+/// and mapped in memory once, and its entries are then
+/// found with a binary search in a sorted, hashed index.
+///
+/// Entries can be stored as is, in which case they are read
+/// in place from the mapped file, or compressed with LZ4.
+/// Pack files are written by `build`, or by the `pack_file`
+/// example program.
+///
+/// Entries are read through the `InputStream` returned by
+/// `openStream`, which can be passed to any `loadFromStream`
+/// or `openFromStream` function. Alternatively, a mounted
+/// pack file makes its entries available to the
+/// `loadFromFile` and `openFromFile` functions of
+/// `sf::Image`, `sf::Texture`, `sf::Font`, `sf::Shader`,
+/// `sf::SoundBuffer`, `sf::Music` and `sf::InputSoundFile`:
+/// paths relative to the root of the pack file are looked
+/// up in the mounted pack files before the file system.
+///
+/// Usage example:
+/// \code
+/// sf::PackFile pack("assets.sfpack");
+/// pack.mount();
+///
+/// // Loaded from the pack file
+/// const sf::Texture texture("images/hero.png");
+///
+/// // Or explicitly
+/// const std::unique_ptr<sf::InputStream> stream = pack.openStream("fonts/title.ttf");
+/// const sf::Font font(*stream);
+/// \endcode
+///
+/// \see `InputStream`, `MappedFileInputStream`
+///
+////////////////////////////////////////////////////////////
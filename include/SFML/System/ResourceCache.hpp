@@ -0,0 +1,538 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Cache of shared resources, loaded once and evicted under a memory budget
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+class ResourceCache
+{
+    struct Entry;
+
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function loading a resource from a file
+    ///
+    ////////////////////////////////////////////////////////////
+    using Loader = std::function<std::optional<T>(const std::filesystem::path&)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function estimating the memory used by a resource, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    using Sizer = std::function<std::size_t(const T&)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Loading status of a resource
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Status
+    {
+        Loading, //!< The resource is being loaded in the background
+        Ready,   //!< The resource is loaded
+        Failed   //!< The resource couldn't be loaded
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Shared reference to a resource of the cache
+    ///
+    /// A resource isn't evicted from the cache, nor destroyed,
+    /// as long as a handle refers to it. While the resource is
+    /// loading, or if it failed to load, the handle gives
+    /// access to the placeholder of the cache instead.
+    ///
+    ////////////////////////////////////////////////////////////
+    class Handle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Construct a handle that doesn't refer to any resource.
+        ///
+        ////////////////////////////////////////////////////////////
+        Handle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the resource
+        ///
+        /// \return Loaded resource, placeholder if it isn't loaded, or `nullptr` if there's none
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] const T* get() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the resource
+        ///
+        /// The handle must give access to a resource.
+        ///
+        /// \return Loaded resource, or placeholder if it isn't loaded
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] const T& operator*() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Access the members of the resource
+        ///
+        /// \return Loaded resource, placeholder if it isn't loaded, or `nullptr` if there's none
+        ///
+        ////////////////////////////////////////////////////////////
+        const T* operator->() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle gives access to a resource
+        ///
+        /// \return `true` if `get` returns a resource or a placeholder
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit operator bool() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the loading status of the resource
+        ///
+        /// \return Loading status, `Status::Failed` if the handle doesn't refer to any resource
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Status getStatus() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the resource is loaded
+        ///
+        /// \return `true` if the status is `Status::Ready`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isReady() const;
+
+    private:
+        friend class ResourceCache;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct a handle referring to a cache entry
+        ///
+        /// \param entry Cache entry
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit Handle(std::shared_ptr<Entry> entry);
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        std::shared_ptr<Entry> m_entry; //!< Cache entry shared with the cache and the other handles
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the cache
+    ///
+    /// By default, resources are loaded with their `loadFromFile`
+    /// or `openFromFile` function, and their memory usage is
+    /// estimated from their `getSize` (4 bytes per pixel) or
+    /// `getSampleCount` (2 bytes per sample) function. Resources
+    /// that have neither, like `sf::Font`, count as the size of
+    /// their file, or 0 bytes when added with `insert`.
+    /// Resources that have no single-argument loading function,
+    /// like `sf::Shader`, require a custom loader.
+    ///
+    /// \param loader Function loading a resource from a file
+    /// \param sizer  Function estimating the memory used by a resource, or empty for the default estimation
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ResourceCache(Loader loader = &ResourceCache::loadFromFile, Sizer sizer = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending background loads carry on, and handles remain
+    /// valid after the cache is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ResourceCache() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceCache(const ResourceCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceCache(ResourceCache&&) = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ResourceCache& operator=(ResourceCache&&) = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a resource from a file, identified by its path
+    ///
+    /// The identifier of the resource is the normalized path
+    /// of the file, with `/` as separator.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return Handle to the resource
+    ///
+    /// \see `loadAsync`
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle load(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a resource from a file, under a given identifier
+    ///
+    /// If the cache already contains a resource with this
+    /// identifier, it is returned without loading the file
+    /// again. If it is being loaded in the background, this
+    /// function waits for the load to finish, or loads it
+    /// itself if the background load hasn't started yet.
+    /// Resources that fail to load aren't kept in the cache.
+    ///
+    /// \param id       Identifier of the resource
+    /// \param filename Path of the file to load
+    ///
+    /// \return Handle to the resource, whose status is `Status::Ready` on success and `Status::Failed` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle load(const std::string& id, const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a resource from a file in the background, identified by its path
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return Handle to the resource, which gives access to the placeholder until the resource is loaded
+    ///
+    /// \see `load`
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle loadAsync(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a resource from a file in the background, under a given identifier
+    ///
+    /// If the cache already contains a resource with this
+    /// identifier, loaded or being loaded, it is returned
+    /// without loading the file again. Otherwise the loader
+    /// is run by the default `sf::TaskScheduler`, and the
+    /// returned handle gives access to the placeholder until
+    /// it is done.
+    ///
+    /// \param id       Identifier of the resource
+    /// \param filename Path of the file to load
+    ///
+    /// \return Handle to the resource
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle loadAsync(const std::string& id, const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a resource to the cache
+    ///
+    /// If the cache already contains a resource with this
+    /// identifier, it is replaced; the handles referring to
+    /// the previous resource keep it alive.
+    ///
+    /// \param id       Identifier of the resource
+    /// \param resource Resource to add
+    ///
+    /// \return Handle to the resource
+    ///
+    ////////////////////////////////////////////////////////////
+    Handle insert(const std::string& id, T resource);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a resource of the cache
+    ///
+    /// \param id Identifier of the resource
+    ///
+    /// \return Handle to the resource, or an empty handle if the cache doesn't contain it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle find(const std::string& id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the cache contains a resource
+    ///
+    /// \param id Identifier of the resource
+    ///
+    /// \return `true` if the cache contains the resource, loaded or not
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(const std::string& id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the resource substituted for resources that aren't loaded
+    ///
+    /// The placeholder applies to the resources loaded after
+    /// this call.
+    ///
+    /// \param placeholder Resource to substitute
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPlaceholder(T placeholder);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the memory budget of the cache
+    ///
+    /// When the memory used by the loaded resources exceeds
+    /// the budget, the least recently used resources that
+    /// no handle refers to are evicted. Resources that are
+    /// still referenced are never evicted, so the usage can
+    /// stay above the budget. The default budget is unlimited.
+    ///
+    /// \param budget Memory budget, in bytes
+    ///
+    /// \see `trim`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t budget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory budget of the cache
+    ///
+    /// \return Memory budget, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory used by the loaded resources of the cache
+    ///
+    /// \return Memory usage estimated by the sizer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of resources in the cache
+    ///
+    /// \return Number of resources, loaded or not
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getResourceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict resources until the memory usage fits in the budget
+    ///
+    /// This function is called automatically when resources
+    /// are added. Resources that failed to load in the
+    /// background are evicted as well.
+    ///
+    /// \return Number of evicted resources
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t trim();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the resources from the cache
+    ///
+    /// Resources that are still referenced by handles, or
+    /// being loaded, stay alive until their last handle is
+    /// destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Resource shared between the cache and its handles
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::optional<T>         resource;                //!< Loaded resource, valid once the status is ready
+        std::shared_ptr<const T> placeholder;             //!< Resource substituted until the resource is loaded
+        std::size_t              memoryUsage{};           //!< Memory used by the loaded resource
+        std::atomic<Status>      status{Status::Loading}; //!< Loading status
+        std::atomic<bool>        claimed{};               //!< Has a thread started loading the resource?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cache bookkeeping of an entry
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Record
+    {
+        std::shared_ptr<Entry> entry;     //!< Shared resource
+        std::future<void>      pending;   //!< Background load, if any
+        std::uint64_t          lastUse{}; //!< Value of the use counter when the resource was last requested
+        std::filesystem::path  filename;  //!< File loaded in the background, if any
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default loader, calling `loadFromFile` or `openFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::optional<T> loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default sizer, based on `getSize` or `getSampleCount`
+    ///
+    /// \return Estimated memory usage, 0 if the resource has neither function
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::size_t getSize(const T& resource);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a file, in the mounted pack files or on disk
+    ///
+    /// \return Size of the file, 0 if it can't be found
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::size_t getFileSize(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the resource of an entry and update its status
+    ///
+    ////////////////////////////////////////////////////////////
+    static void loadEntry(Entry&                       entry,
+                          const Loader&                loader,
+                          const Sizer&                 sizer,
+                          const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the identifier of a file
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::string getId(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an entry, not loaded yet
+    ///
+    ////////////////////////////////////////////////////////////
+    std::shared_ptr<Entry> createEntry() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Loader                                  m_loader;       //!< Loading function
+    Sizer                                   m_sizer;        //!< Memory estimation function, empty for the default one
+    std::unordered_map<std::string, Record> m_records;      //!< Resources, by identifier
+    std::shared_ptr<const T>                m_placeholder;  //!< Resource substituted until the resources are loaded
+    std::size_t                             m_memoryBudget; //!< Memory budget, in bytes
+    std::uint64_t                           m_useCounter{}; //!< Incremented each time a resource is requested
+};
+
+} // namespace sf
+
+#include <SFML/System/ResourceCache.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ResourceCache
+/// \ingroup system
+///
+/// `sf::ResourceCache` makes sure that a resource used in
+/// several places is loaded only once. It can hold any
+/// resource class, typically `sf::Texture`, `sf::Image`,
+/// `sf::Font`, `sf::SoundBuffer` or `sf::Shader`; use one
+/// cache per resource type, each of them reports the memory
+/// used by its own resources.
+///
+/// Resources are identified by the path of their file, or
+/// by an arbitrary identifier. The cache hands out
+/// `Handle`s, which share the ownership of the resource:
+/// a resource stays alive as long as a handle refers to it,
+/// even after it is evicted from the cache or the cache is
+/// destroyed. For instance, keep the handle of a sound
+/// buffer for as long as the `sf::Sound` playing it.
+///
+/// Resources can be loaded in the background with `loadAsync`,
+/// which runs the loader on the default `sf::TaskScheduler`.
+/// Until they are loaded, and if they fail to load, their
+/// handles give access to the placeholder of the cache
+/// instead, such as a small checkerboard texture. Their errors
+/// are reported to `sf::err()` by the main thread of the
+/// scheduler the next time it uses it. The cache
+/// itself must be used from a single thread, while handles
+/// can be read from any thread.
+///
+/// When a memory budget is set, the least recently used
+/// resources that no handle refers to are evicted to keep
+/// the memory usage within the budget.
+///
+/// Since resources are loaded with their `loadFromFile` or
+/// `openFromFile` function by default, they are looked up in
+/// the mounted `sf::PackFile`s first.
+///
+/// Usage example:
+/// \code
+/// sf::ResourceCache<sf::Texture> textures;
+/// textures.setPlaceholder(sf::Texture("loading.png"));
+/// textures.setMemoryBudget(256 * 1024 * 1024);
+///
+/// // Loaded once, the second call returns the same texture
+/// const sf::ResourceCache<sf::Texture>::Handle hero  = textures.load("images/hero.png");
+/// const sf::ResourceCache<sf::Texture>::Handle hero2 = textures.load("images/hero.png");
+///
+/// // Drawn with the placeholder until it is loaded
+/// const sf::ResourceCache<sf::Texture>::Handle background = textures.loadAsync("images/background.png");
+/// window.draw(sf::Sprite(*background));
+///
+/// // Shaders need a custom loader
+/// sf::ResourceCache<sf::Shader> shaders(
+///     [](const std::filesystem::path& filename) -> std::optional<sf::Shader>
+///     {
+///         sf::Shader shader;
+///         if (!shader.loadFromFile(filename, sf::Shader::Type::Fragment))
+///             return std::nullopt;
+///         return shader;
+///     });
+/// \endcode
+///
+/// \see `sf::PackFile`, `sf::TaskScheduler`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,517 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/ResourceCache.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/PackFile.hpp>
+#include <SFML/System/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <ostream>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+using LoadFromFileResult = decltype(std::declval<T&>().loadFromFile(std::declval<const std::filesystem::path&>()));
+
+template <typename T>
+using OpenFromFileResult = decltype(std::declval<T&>().openFromFile(std::declval<const std::filesystem::path&>()));
+
+template <typename T, typename = void>
+struct HasLoadFromFile : std::false_type
+{
+};
+
+template <typename T>
+struct HasLoadFromFile<T, std::void_t<LoadFromFileResult<T>>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct HasOpenFromFile : std::false_type
+{
+};
+
+template <typename T>
+struct HasOpenFromFile<T, std::void_t<OpenFromFileResult<T>>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct HasPixelSize : std::false_type
+{
+};
+
+template <typename T>
+struct HasPixelSize<T, std::void_t<decltype(std::declval<const T&>().getSize().x)>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct HasSampleCount : std::false_type
+{
+};
+
+template <typename T>
+struct HasSampleCount<T, std::void_t<decltype(std::declval<const T&>().getSampleCount())>> : std::true_type
+{
+};
+} // namespace priv
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+ResourceCache<T>::Handle::Handle(std::shared_ptr<Entry> entry) : m_entry(std::move(entry))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const T* ResourceCache<T>::Handle::get() const
+{
+    if (!m_entry)
+        return nullptr;
+
+    if (m_entry->status.load(std::memory_order_acquire) == Status::Ready)
+        return &*m_entry->resource;
+
+    return m_entry->placeholder.get();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const T& ResourceCache<T>::Handle::operator*() const
+{
+    const T* resource = get();
+    assert(resource && "ResourceCache::Handle::operator*() Handle doesn't give access to any resource");
+    return *resource;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+const T* ResourceCache<T>::Handle::operator->() const
+{
+    return get();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+ResourceCache<T>::Handle::operator bool() const
+{
+    return get() != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Status ResourceCache<T>::Handle::getStatus() const
+{
+    return m_entry ? m_entry->status.load(std::memory_order_acquire) : Status::Failed;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool ResourceCache<T>::Handle::isReady() const
+{
+    return getStatus() == Status::Ready;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+ResourceCache<T>::ResourceCache(Loader loader, Sizer sizer) :
+m_loader(std::move(loader)),
+m_sizer(std::move(sizer)),
+m_memoryBudget(std::numeric_limits<std::size_t>::max())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::load(const std::filesystem::path& filename)
+{
+    return load(getId(filename), filename);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::load(const std::string& id, const std::filesystem::path& filename)
+{
+    if (const auto it = m_records.find(id); (it != m_records.end()) && (it->second.entry->status != Status::Failed))
+    {
+        Record& record = it->second;
+        bool    loaded = false;
+
+        if (record.pending.valid())
+        {
+            // Load the resource right away if its background load hasn't started yet, rather than waiting
+            // for a task that may be stuck behind busy workers, or behind the task calling this function
+            if (!record.entry->claimed.exchange(true, std::memory_order_acq_rel))
+            {
+                loadEntry(*record.entry, m_loader, m_sizer, record.filename);
+                loaded = true;
+            }
+            else
+            {
+                record.pending.wait();
+            }
+
+            record.pending = {};
+        }
+
+        record.lastUse = ++m_useCounter;
+        const Handle handle(record.entry);
+
+        if (loaded)
+            trim();
+
+        return handle;
+    }
+
+    const std::shared_ptr<Entry> entry = createEntry();
+    loadEntry(*entry, m_loader, m_sizer, filename);
+
+    if (entry->status == Status::Ready)
+    {
+        m_records[id] = Record{entry, {}, ++m_useCounter, {}};
+        trim();
+    }
+
+    return Handle(entry);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::loadAsync(const std::filesystem::path& filename)
+{
+    return loadAsync(getId(filename), filename);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::loadAsync(const std::string&           id,
+                                                             const std::filesystem::path& filename)
+{
+    if (const auto it = m_records.find(id); (it != m_records.end()) && (it->second.entry->status != Status::Failed))
+    {
+        it->second.lastUse = ++m_useCounter;
+        return Handle(it->second.entry);
+    }
+
+    const std::shared_ptr<Entry> entry = createEntry();
+
+    // The loader and sizer are copied so that the cache can be moved or destroyed while the resource is loading.
+    // The task releases the entry once done, as the future keeps it alive and would prevent its eviction.
+    // The entry is claimed so that a synchronous load started in the meantime doesn't load it twice.
+    auto task = std::make_shared<std::packaged_task<void()>>(
+        [loading = entry, filename, loader = m_loader, sizer = m_sizer]() mutable
+        {
+            if (!loading->claimed.exchange(true, std::memory_order_acq_rel))
+                loadEntry(*loading, loader, sizer, filename);
+
+            loading.reset();
+        });
+
+    m_records[id] = Record{entry, task->get_future(), ++m_useCounter, filename};
+    TaskScheduler::getDefault().run([task] { (*task)(); });
+
+    trim();
+    return Handle(entry);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::insert(const std::string& id, T resource)
+{
+    const std::shared_ptr<Entry> entry = createEntry();
+    entry->claimed                     = true;
+    entry->memoryUsage                 = m_sizer ? m_sizer(resource) : getSize(resource);
+    entry->resource.emplace(std::move(resource));
+    entry->status.store(Status::Ready, std::memory_order_release);
+
+    m_records[id] = Record{entry, {}, ++m_useCounter, {}};
+    trim();
+
+    return Handle(entry);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+typename ResourceCache<T>::Handle ResourceCache<T>::find(const std::string& id)
+{
+    const auto it = m_records.find(id);
+    if (it == m_records.end())
+        return {};
+
+    it->second.lastUse = ++m_useCounter;
+    return Handle(it->second.entry);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool ResourceCache<T>::contains(const std::string& id) const
+{
+    return m_records.find(id) != m_records.end();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::setPlaceholder(T placeholder)
+{
+    m_placeholder = std::make_shared<const T>(std::move(placeholder));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::setMemoryBudget(std::size_t budget)
+{
+    m_memoryBudget = budget;
+    trim();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::getMemoryUsage() const
+{
+    std::size_t usage = 0;
+    for (const auto& [id, record] : m_records)
+    {
+        if (record.entry->status.load(std::memory_order_acquire) == Status::Ready)
+            usage += record.entry->memoryUsage;
+    }
+
+    return usage;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::getResourceCount() const
+{
+    return m_records.size();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::trim()
+{
+    // Gather the resources that no handle refers to, least recently used first
+    std::vector<typename std::unordered_map<std::string, Record>::iterator> candidates;
+    for (auto it = m_records.begin(); it != m_records.end(); ++it)
+    {
+        const Record& record  = it->second;
+        const bool    loading = record.entry->status.load(std::memory_order_acquire) == Status::Loading;
+        if ((record.entry.use_count() == 1) && !loading)
+            candidates.push_back(it);
+    }
+
+    std::sort(candidates.begin(),
+              candidates.end(),
+              [](const auto& left, const auto& right) { return left->second.lastUse < right->second.lastUse; });
+
+    std::size_t usage   = getMemoryUsage();
+    std::size_t evicted = 0;
+
+    for (const auto it : candidates)
+    {
+        const Entry& entry = *it->second.entry;
+
+        // Failed loads are always evicted, loaded resources only while the usage exceeds the budget
+        if (entry.status == Status::Ready)
+        {
+            if (usage <= m_memoryBudget)
+                continue;
+
+            usage -= entry.memoryUsage;
+        }
+
+        m_records.erase(it);
+        ++evicted;
+    }
+
+    return evicted;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::clear()
+{
+    m_records.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::optional<T> ResourceCache<T>::loadFromFile(const std::filesystem::path& filename)
+{
+    T resource;
+
+    if constexpr (priv::HasLoadFromFile<T>::value)
+    {
+        if (!resource.loadFromFile(filename))
+            return std::nullopt;
+    }
+    else
+    {
+        static_assert(priv::HasOpenFromFile<T>::value,
+                      "ResourceCache requires a custom loader for resources without loadFromFile or openFromFile");
+
+        if (!resource.openFromFile(filename))
+            return std::nullopt;
+    }
+
+    return std::optional<T>(std::move(resource));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::getSize(const T& resource)
+{
+    if constexpr (priv::HasPixelSize<T>::value)
+    {
+        const auto size = resource.getSize();
+        return static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4;
+    }
+    else if constexpr (priv::HasSampleCount<T>::value)
+    {
+        return static_cast<std::size_t>(resource.getSampleCount()) * sizeof(std::int16_t);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t ResourceCache<T>::getFileSize(const std::filesystem::path& filename)
+{
+    // Resources are looked up in the mounted pack files first, like their loading functions do
+    if (const std::unique_ptr<InputStream> stream = PackFile::openMountedStream(filename))
+        return static_cast<std::size_t>(stream->getSize().value_or(0));
+
+    std::error_code error;
+    const auto      size = std::filesystem::file_size(filename, error);
+    return error ? 0 : static_cast<std::size_t>(size);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+void ResourceCache<T>::loadEntry(Entry&                       entry,
+                                 const Loader&                loader,
+                                 const Sizer&                 sizer,
+                                 const std::filesystem::path& filename)
+{
+    try
+    {
+        entry.resource = loader(filename);
+    }
+    catch (const std::exception& exception)
+    {
+        err() << "Failed to load resource (" << exception.what() << ")\n"
+              << "    Provided path: " << filename << std::endl;
+        entry.resource.reset();
+    }
+
+    if (!entry.resource)
+    {
+        entry.status.store(Status::Failed, std::memory_order_release);
+        return;
+    }
+
+    if (sizer)
+        entry.memoryUsage = sizer(*entry.resource);
+    else if (const std::size_t size = getSize(*entry.resource); size > 0)
+        entry.memoryUsage = size;
+    else
+        entry.memoryUsage = getFileSize(filename);
+
+    entry.status.store(Status::Ready, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::string ResourceCache<T>::getId(const std::filesystem::path& filename)
+{
+    const auto normalized = filename.lexically_normal().generic_u8string();
+    return {normalized.begin(), normalized.end()};
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+std::shared_ptr<typename ResourceCache<T>::Entry> ResourceCache<T>::createEntry() const
+{
+    auto entry         = std::make_shared<Entry>();
+    entry->placeholder = m_placeholder;
+    return entry;
+}
+
+} // namespace sf
@@ -33,6 +33,7 @@
 
 #include <locale>
 #include <string>
+#include <string_view>
 
 #include <cstddef>
 #include <cstdint>
@@ -80,6 +81,16 @@ struct SFML_SYSTEM_API U8StringCharTraits
 ////////////////////////////////////////////////////////////
 using U8String = std::basic_string<std::uint8_t, U8StringCharTraits>;
 
+////////////////////////////////////////////////////////////
+/// \brief Portable replacement for `std::u8string_view`
+///
+/// Non-owning view over UTF-8 encoded data, accepted by
+/// the functions which can consume UTF-8 text directly
+/// without converting it to a `sf::String` first.
+///
+////////////////////////////////////////////////////////////
+using U8StringView = std::basic_string_view<std::uint8_t, U8StringCharTraits>;
+
 ////////////////////////////////////////////////////////////
 /// \brief Utility string class that automatically handles
 ///        conversions between types and encodings
@@ -216,6 +227,25 @@ public:
     template <typename T>
     [[nodiscard]] static String fromUtf8(T begin, T end);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new `sf::String` from a contiguous UTF-8 encoded string
+    ///
+    /// The result is the same as with the iterator version, but
+    /// the conversion processes runs of ASCII characters in bulk,
+    /// which makes it much faster on large amounts of text.
+    ///
+    /// Like the iterator version, this function doesn't check
+    /// that its input is well-formed, see `isValidUtf8`.
+    ///
+    /// \param utf8String UTF-8 sequence to convert
+    ///
+    /// \return A `sf::String` containing the source string
+    ///
+    /// \see `fromUtf16`, `fromUtf32`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static String fromUtf8(U8StringView utf8String);
+
     ////////////////////////////////////////////////////////////
     /// \brief Create a new `sf::String` from a UTF-16 encoded string
     ///
@@ -230,6 +260,22 @@ public:
     template <typename T>
     [[nodiscard]] static String fromUtf16(T begin, T end);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a new `sf::String` from a contiguous UTF-16 encoded string
+    ///
+    /// The result is the same as with the iterator version, but
+    /// the conversion processes runs of characters which don't
+    /// need a surrogate pair in bulk.
+    ///
+    /// \param utf16String UTF-16 sequence to convert
+    ///
+    /// \return A `sf::String` containing the source string
+    ///
+    /// \see `fromUtf8`, `fromUtf32`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static String fromUtf16(std::u16string_view utf16String);
+
     ////////////////////////////////////////////////////////////
     /// \brief Create a new `sf::String` from a UTF-32 encoded string
     ///
@@ -248,6 +294,21 @@ public:
     template <typename T>
     [[nodiscard]] static String fromUtf32(T begin, T end);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether a UTF-8 encoded string is well-formed
+    ///
+    /// Overlong encodings, surrogate code points, code points
+    /// above U+10FFFF and truncated sequences are rejected.
+    /// Use this function before converting untrusted input,
+    /// as the conversion functions don't validate it.
+    ///
+    /// \param utf8String UTF-8 sequence to check
+    ///
+    /// \return `true` if the sequence is valid UTF-8
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isValidUtf8(U8StringView utf8String);
+
     ////////////////////////////////////////////////////////////
     /// \brief Implicit conversion operator to `std::string` (ANSI string)
     ///
@@ -694,6 +755,16 @@ private:
 /// care of converting your string to `sf::String` whenever SFML
 /// requires it.
 ///
+/// As every character takes 4 bytes, text which is mostly
+/// stored rather than edited (localization tables, labels...)
+/// can instead be kept as UTF-8 in a `sf::U8String`. Functions
+/// accepting a `sf::U8StringView`, such as `sf::Text::setString`,
+/// then consume it directly, without any conversion:
+/// \code
+/// const sf::U8String label = sf::String(L"Options").toUtf8();
+/// text.setString(label);
+/// \endcode
+///
 /// Please note that SFML also defines a low-level, generic
 /// interface for Unicode handling, see the `sf::Utf` classes.
 ///
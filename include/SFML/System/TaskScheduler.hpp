@@ -0,0 +1,406 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of worker threads running tasks, with work stealing
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API TaskScheduler
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Unit of work run by the scheduler
+    ///
+    ////////////////////////////////////////////////////////////
+    using Task = std::function<void()>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set of tasks that can be waited for together
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_SYSTEM_API TaskGroup
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct an empty group
+        ///
+        /// \param scheduler Scheduler running the tasks of the group
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit TaskGroup(TaskScheduler& scheduler);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Waits for the tasks of the group to finish, and reports
+        /// what they wrote to `sf::err()`. An exception thrown by
+        /// a task and not retrieved by `wait` is ignored.
+        ///
+        ////////////////////////////////////////////////////////////
+        ~TaskGroup();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        TaskGroup(const TaskGroup&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Run a task on any thread of the scheduler
+        ///
+        /// \param task Task to run
+        ///
+        ////////////////////////////////////////////////////////////
+        void run(Task task);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Run a task on the main thread of the scheduler
+        ///
+        /// \param task Task to run
+        ///
+        /// \see `TaskScheduler::runOnMainThread`
+        ///
+        ////////////////////////////////////////////////////////////
+        void runOnMainThread(Task task);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Wait for the tasks of the group to finish
+        ///
+        /// The calling thread runs pending tasks while it
+        /// waits; the main thread also runs the tasks bound
+        /// to it.
+        ///
+        /// What the tasks of the group wrote to `sf::err()` is
+        /// reported by the calling thread. If tasks of the group
+        /// threw exceptions, the first one is rethrown once all
+        /// the tasks are finished, and the group can then be reused.
+        ///
+        ////////////////////////////////////////////////////////////
+        void wait();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether all the tasks of the group are finished
+        ///
+        /// \return `true` if no task of the group is pending or running
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isDone() const;
+
+    private:
+        ////////////////////////////////////////////////////////////
+        /// \brief Wrap a task so that it updates the group when done
+        ///
+        /// The wrapped task catches the exceptions of \a task and
+        /// keeps the first one for `wait`, and collects what it
+        /// writes to `sf::err()`.
+        ///
+        ////////////////////////////////////////////////////////////
+        Task wrap(Task task);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Write the messages collected from the tasks to `sf::err()`
+        ///
+        ////////////////////////////////////////////////////////////
+        void reportMessages();
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        TaskScheduler&           m_scheduler; //!< Scheduler running the tasks
+        std::atomic<std::size_t> m_pending{}; //!< Number of tasks not finished yet
+        std::atomic<bool>        m_failed{};  //!< Did a task throw an exception?
+        std::exception_ptr       m_exception; //!< First exception thrown by a task
+        std::mutex               m_mutex;     //!< Mutex protecting the messages
+        std::string              m_messages;  //!< Messages written to sf::err() by the tasks, not reported yet
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the scheduler and start its worker threads
+    ///
+    /// The thread constructing the scheduler becomes its main
+    /// thread. With no worker thread, tasks run immediately on
+    /// the calling thread.
+    ///
+    /// \param workerCount Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TaskScheduler(unsigned int workerCount = getHardwareWorkerCount());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Finishes the pending tasks, then stops the worker
+    /// threads. Tasks bound to the main thread that haven't
+    /// run yet are discarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TaskScheduler();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TaskScheduler(const TaskScheduler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getWorkerCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run a task on a worker thread, without waiting for it
+    ///
+    /// Use a `TaskGroup` to wait for tasks.
+    ///
+    /// \param task Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    void run(Task task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run a task on the main thread, without waiting for it
+    ///
+    /// Tasks bound to the main thread, typically because they
+    /// need its OpenGL context, run when the main thread calls
+    /// `runMainThreadTasks` or waits for a `TaskGroup`.
+    ///
+    /// \param task Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    void runOnMainThread(Task task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the tasks bound to the main thread
+    ///
+    /// This function must be called regularly from the main
+    /// thread, for example once per frame. It does nothing
+    /// when called from another thread.
+    ///
+    /// \return Number of tasks run
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t runMainThreadTasks();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the calling thread the main thread of the scheduler
+    ///
+    /// The main thread is the one that constructed the
+    /// scheduler, unless it is changed by this function.
+    /// It must not be a worker thread of the scheduler.
+    ///
+    /// \see `isMainThread`, `runOnMainThread`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMainThread();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the calling thread is the main thread of the scheduler
+    ///
+    /// \return `true` if the calling thread is the main thread
+    ///
+    /// \see `setMainThread`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMainThread() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function on sub-ranges of a range, in parallel
+    ///
+    /// The range is split into chunks of `grainSize` elements,
+    /// and `function(first, last)` is called for each chunk
+    /// `[first, last)`. The calling thread takes part in the
+    /// work, and returns once all the chunks are processed.
+    ///
+    /// \param begin     Beginning of the range
+    /// \param end       End of the range (excluded)
+    /// \param function  Function processing a chunk
+    /// \param grainSize Number of elements per chunk, 0 to split the range evenly between the threads
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, F&& function, std::size_t grainSize = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scheduler shared by the application and SFML
+    ///
+    /// The scheduler is created on the first call, and the
+    /// calling thread becomes its main thread. Since SFML
+    /// itself may be the first to call it, from whatever thread
+    /// uses it, applications relying on `runOnMainThread` should
+    /// either call this function early from their main thread,
+    /// or call `setMainThread` on the default scheduler. The
+    /// first call must not come from a worker thread of another
+    /// scheduler.
+    ///
+    /// \return Default scheduler
+    ///
+    /// \see `setDefaultWorkerCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static TaskScheduler& getDefault();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of worker threads of the default scheduler
+    ///
+    /// This function must be called before the first call to
+    /// `getDefault`, it has no effect afterwards. By default,
+    /// the default scheduler has `getHardwareWorkerCount()`
+    /// worker threads.
+    ///
+    /// \param workerCount Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setDefaultWorkerCount(unsigned int workerCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads that keeps all the cores busy
+    ///
+    /// \return Number of hardware threads minus one, for the main thread
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getHardwareWorkerCount();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a task
+    ///
+    /// \param task       Task to queue
+    /// \param mainThread Bind the task to the main thread?
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(Task task, bool mainThread);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run pending tasks until a counter reaches zero
+    ///
+    /// \param pending Counter of pending tasks
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait(const std::atomic<std::size_t>& pending);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+#include <SFML/System/TaskScheduler.inl>
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TaskScheduler
+/// \ingroup system
+///
+/// `sf::TaskScheduler` runs small units of work on a pool of
+/// worker threads. Each worker has its own queue of tasks:
+/// tasks spawned by a worker are pushed to its own queue and
+/// run in last-in first-out order, which keeps their data hot
+/// in the cache, while idle workers steal the oldest tasks of
+/// the other queues. Tasks submitted from other threads are
+/// shared between all the workers.
+///
+/// Tasks are waited for with a `TaskGroup`. Waiting threads
+/// don't block while tasks are pending: they run them. Tasks
+/// can therefore spawn and wait for nested tasks without
+/// exhausting the workers.
+///
+/// Some tasks must run on a given thread, typically the one
+/// whose OpenGL context is active. Such tasks are bound to the
+/// main thread with `runOnMainThread`, and run when the main
+/// thread calls `runMainThreadTasks` or waits for a group.
+///
+/// `getDefault` returns a scheduler shared by the application
+/// and SFML itself, whose number of workers can be set once
+/// with `setDefaultWorkerCount`.
+///
+/// An exception thrown by a task of a `TaskGroup` is rethrown
+/// by `TaskGroup::wait`. Exceptions thrown by the other tasks
+/// can't be delivered to anyone: they are reported to
+/// `sf::err()` and ignored.
+///
+/// Since `sf::err()` isn't thread-safe, what tasks write to it
+/// is collected and reported by another thread: the one that
+/// waits for their group, or for the other tasks, the main
+/// thread the next time it uses the scheduler.
+///
+/// Usage example:
+/// \code
+/// sf::TaskScheduler& scheduler = sf::TaskScheduler::getDefault();
+///
+/// // Process an image in parallel, one chunk of rows per task
+/// scheduler.parallelFor(0, image.getSize().y, [&](std::size_t first, std::size_t last)
+/// {
+///     for (std::size_t y = first; y < last; ++y)
+///         processRow(image, y);
+/// });
+///
+/// // Decode in the background, then upload on the main thread
+/// sf::TaskScheduler::TaskGroup group(scheduler);
+/// group.run([&]
+/// {
+///     decode(pixels);
+///     group.runOnMainThread([&] { texture.update(pixels.data()); });
+/// });
+/// group.wait();
+/// \endcode
+///
+////////////////////////////////////////////////////////////
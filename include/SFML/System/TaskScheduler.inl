@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/TaskScheduler.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename F>
+void TaskScheduler::parallelFor(std::size_t begin, std::size_t end, F&& function, std::size_t grainSize)
+{
+    if (begin >= end)
+        return;
+
+    // By default, give a few chunks to each thread so that the work stays balanced
+    if (grainSize == 0)
+        grainSize = std::max<std::size_t>((end - begin) / ((getWorkerCount() + 1) * 4), 1);
+
+    TaskGroup group(*this);
+
+    std::size_t first = begin;
+    for (; end - first > grainSize; first += grainSize)
+        group.run([&function, first, grainSize] { function(first, first + grainSize); });
+
+    // The last chunk is processed by the calling thread
+    function(first, end);
+    group.wait();
+}
+
+} // namespace sf
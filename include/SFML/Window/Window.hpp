@@ -33,7 +33,7 @@
 #include <SFML/Window/WindowEnums.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 
-#include <SFML/System/Clock.hpp>
+#include <SFML/System/FramePacer.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <memory>
@@ -299,17 +299,63 @@ public:
     /// If a limit is set, the window will use a small delay after
     /// each call to `display()` to ensure that the current frame
     /// lasted long enough to match the framerate limit.
-    /// SFML will try to match the given limit as much as it can,
-    /// but since it internally uses `sf::sleep`, whose precision
-    /// depends on the underlying OS, the results may be a little
-    /// imprecise as well (for example, you can get 65 FPS when
-    /// requesting 60).
+    /// By default SFML sleeps for the rest of the frame, and since
+    /// the precision of `sf::sleep` depends on the underlying OS,
+    /// the results may be a little imprecise as well (for example,
+    /// you can get 57 FPS when requesting 60). Use `setFramePacing`
+    /// with `sf::FramePacer::Mode::Absolute` for precise pacing.
     ///
     /// \param limit Framerate limit, in frames per seconds (use 0 to disable limit)
     ///
+    /// \see `setFramePacing`
+    ///
     ////////////////////////////////////////////////////////////
     void setFramerateLimit(unsigned int limit);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Choose how the framerate limit is enforced
+    ///
+    /// `sf::FramePacer::Mode::Relative`, the default, sleeps for
+    /// the remainder of each frame: oversleeping delays all the
+    /// following frames, which shows as judder on high refresh
+    /// rate monitors.
+    ///
+    /// `sf::FramePacer::Mode::Absolute` schedules frames on fixed
+    /// deadlines instead, sleeping until `slack` before each of
+    /// them then spinning until the deadline itself. A larger
+    /// slack is more precise but uses more CPU time.
+    ///
+    /// This has no effect unless a framerate limit is set.
+    ///
+    /// \param mode  Strategy used to wait for the end of a frame
+    /// \param slack Time left to spin before a deadline, in absolute mode
+    ///
+    /// \see `setFramerateLimit`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFramePacing(FramePacer::Mode mode, Time slack = FramePacer::DefaultSlack);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frame-time statistics of the window
+    ///
+    /// Frame times are measured between consecutive calls to
+    /// `display()`, whether or not a framerate limit is set.
+    ///
+    /// \return Frame-time statistics since the last reset
+    ///
+    /// \see `resetFrameStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FramePacer::Statistics getFrameStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the frame-time statistics of the window
+    ///
+    /// \see `getFrameStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetFrameStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the window as the current target
     ///        for OpenGL rendering
@@ -348,9 +394,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::unique_ptr<priv::GlContext> m_context;        //!< Platform-specific implementation of the OpenGL context
-    Clock                            m_clock;          //!< Clock for measuring the elapsed time between frames
-    Time                             m_frameTimeLimit; //!< Current framerate limit
+    std::unique_ptr<priv::GlContext> m_context;    //!< Platform-specific implementation of the OpenGL context
+    FramePacer                       m_framePacer; //!< Enforces the framerate limit and measures frame times
 };
 
 } // namespace sf
@@ -33,6 +33,7 @@
 #include <SFML/Window/WindowEnums.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 
+#include <SFML/System/String.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
@@ -45,7 +46,6 @@
 namespace sf
 {
 class Cursor;
-class String;
 class VideoMode;
 
 namespace priv
@@ -406,6 +406,16 @@ public:
     ////////////////////////////////////////////////////////////
     void setTitle(const String& title);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the title of the window from UTF-8 encoded data
+    ///
+    /// \param title New title, encoded in UTF-8
+    ///
+    /// \see `setIcon`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTitle(U8StringView title);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the window's icon
     ///
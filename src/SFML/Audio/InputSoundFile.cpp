@@ -34,9 +34,11 @@
 #include <SFML/System/FileInputStream.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/PackFile.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -97,6 +99,17 @@ bool InputSoundFile::openFromFile(const std::filesystem::path& filename)
     // If the file is already open, first close it
     close();
 
+    // Prefer an entry of a mounted pack file over the file system
+    if (std::unique_ptr<InputStream> stream = PackFile::openMountedStream(filename))
+    {
+        if (!openFromStream(*stream))
+            return false;
+
+        // Keep the entry stream alive for as long as the sound file is open
+        m_stream = {stream.release(), true};
+        return true;
+    }
+
     // Find a suitable reader for the file type
     auto reader = SoundFileFactory::createReaderFromFilename(filename);
     if (!reader)
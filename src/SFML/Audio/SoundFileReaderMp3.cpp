@@ -124,12 +124,24 @@ SoundFileReaderMp3::~SoundFileReaderMp3()
 ////////////////////////////////////////////////////////////
 std::optional<SoundFileReader::Info> SoundFileReaderMp3::open(InputStream& stream)
 {
-    // Init IO callbacks
-    m_io.read_data = &stream;
-    m_io.seek_data = &stream;
+    // Decode the stream in place if its content is already in memory (memory or mapped file streams)
+    const void*         data = stream.getData();
+    const std::optional size = stream.getSize();
 
-    // Init mp3 decoder
-    mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE);
+    if (data && size)
+    {
+        // Init mp3 decoder
+        mp3dec_ex_open_buf(&m_decoder, static_cast<const std::uint8_t*>(data), *size, MP3D_SEEK_TO_SAMPLE);
+    }
+    else
+    {
+        // Init IO callbacks
+        m_io.read_data = &stream;
+        m_io.seek_data = &stream;
+
+        // Init mp3 decoder
+        mp3dec_ex_open_cb(&m_decoder, &m_io, MP3D_SEEK_TO_SAMPLE);
+    }
     if (!m_decoder.samples)
         return std::nullopt;
 
@@ -134,7 +134,13 @@ std::optional<SoundFileReader::Info> SoundFileReaderWav::open(InputStream& strea
     config.encodingFormat = ma_encoding_format_wav;
     config.format         = ma_format_s16;
 
-    if (const ma_result result = ma_decoder_init(&onRead, &onSeek, &stream, &config, &*m_decoder); result != MA_SUCCESS)
+    // Decode the stream in place if its content is already in memory (memory or mapped file streams)
+    const void*         data = stream.getData();
+    const std::optional size = stream.getSize();
+
+    if (const ma_result result = (data && size) ? ma_decoder_init_memory(data, *size, &config, &*m_decoder)
+                                                : ma_decoder_init(&onRead, &onSeek, &stream, &config, &*m_decoder);
+        result != MA_SUCCESS)
     {
         err() << "Failed to initialize wav decoder: " << ma_result_description(result) << std::endl;
         m_decoder = std::nullopt;
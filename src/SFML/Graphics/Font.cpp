@@ -34,6 +34,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/PackFile.hpp>
 #include <SFML/System/Utils.hpp>
 
 #include <ft2build.h>
@@ -148,6 +149,15 @@ Font::Font(InputStream& stream)
 ////////////////////////////////////////////////////////////
 bool Font::openFromFile(const std::filesystem::path& filename)
 {
+    // Entries of mounted pack files take precedence over the file system
+    if (std::unique_ptr<InputStream> stream = PackFile::openMountedStream(filename))
+    {
+        // The current face may still be reading from the current stream, so destroy it first
+        cleanup();
+        m_stream = std::move(stream);
+        return openFromStream(*m_stream);
+    }
+
 #ifndef SFML_SYSTEM_ANDROID
 
     // Cleanup the previous resources
@@ -198,6 +208,7 @@ bool Font::openFromFile(const std::filesystem::path& filename)
 
 #else
 
+    cleanup();
     m_stream = std::make_shared<priv::ResourceStream>(filename);
     return openFromStream(*m_stream);
 
@@ -291,6 +302,14 @@ bool Font::openFromStream(InputStream& stream)
     fontHandles->streamRec.read               = &read;
     fontHandles->streamRec.close              = &close;
 
+    // If the content of the stream is already in memory (memory or mapped file streams),
+    // let FreeType access it directly instead of copying it through the read callback
+    if (const void* data = stream.getData())
+    {
+        fontHandles->streamRec.base = static_cast<unsigned char*>(const_cast<void*>(data));
+        fontHandles->streamRec.read = nullptr;
+    }
+
     // Setup the FreeType callbacks that will read our stream
     FT_Open_Args args;
     args.flags  = FT_OPEN_STREAM;
@@ -0,0 +1,645 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameRecorder.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SoftwareRasterizer.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+#include <SFML/System/ErrCapture.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FrameRecorderImpl
+{
+// Number of frames read back asynchronously before the oldest one is collected
+constexpr std::size_t readbackCount = 3;
+
+// Name of the file a frame is written to
+std::filesystem::path getFilename(std::size_t index, sf::FrameRecorder::Format format)
+{
+    static constexpr std::array<const char*, 3> extensions = {".png", ".qoi", ".rgba"};
+
+    std::ostringstream stream;
+    stream << "frame_" << std::setw(6) << std::setfill('0') << index << extensions[static_cast<std::size_t>(format)];
+    return stream.str();
+}
+
+// Reverse the order of the rows of an image, as OpenGL reads them from bottom to top
+void flipRows(std::vector<std::uint8_t>& pixels, sf::Vector2u size)
+{
+    const std::size_t rowSize = std::size_t{size.x} * 4;
+
+    for (std::size_t top = 0, bottom = size.y - 1; top < bottom; ++top, --bottom)
+        std::swap_ranges(pixels.begin() + static_cast<std::ptrdiff_t>(top * rowSize),
+                         pixels.begin() + static_cast<std::ptrdiff_t>((top + 1) * rowSize),
+                         pixels.begin() + static_cast<std::ptrdiff_t>(bottom * rowSize));
+}
+
+// Difference between two color channels, wrapped to the signed 8-bit range
+int wrappedDifference(std::uint8_t left, std::uint8_t right)
+{
+    return (left - right + 384) % 256 - 128;
+}
+
+// Encode RGBA pixels to the QOI format, see https://qoiformat.org/qoi-specification.pdf
+std::vector<std::uint8_t> encodeQoi(const std::vector<std::uint8_t>& pixels, sf::Vector2u size)
+{
+    std::vector<std::uint8_t> result;
+    result.reserve(pixels.size() / 2);
+
+    const auto write32 = [&result](std::uint32_t value)
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            result.push_back(static_cast<std::uint8_t>(value >> shift));
+    };
+
+    // Header: magic, size, 4 channels, sRGB with linear alpha
+    result.insert(result.end(), {'q', 'o', 'i', 'f'});
+    write32(size.x);
+    write32(size.y);
+    result.insert(result.end(), {4, 0});
+
+    std::array<std::array<std::uint8_t, 4>, 64> seen{};
+    std::array<std::uint8_t, 4>                 previous = {0, 0, 0, 255};
+    std::uint8_t                                run      = 0;
+
+    for (std::size_t offset = 0; offset < pixels.size(); offset += 4)
+    {
+        const std::array<std::uint8_t, 4> pixel = {pixels[offset],
+                                                   pixels[offset + 1],
+                                                   pixels[offset + 2],
+                                                   pixels[offset + 3]};
+
+        if (pixel == previous)
+        {
+            // QOI_OP_RUN, for up to 62 repetitions of the previous pixel
+            if ((++run == 62) || (offset + 4 == pixels.size()))
+            {
+                result.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+                run = 0;
+            }
+
+            continue;
+        }
+
+        if (run > 0)
+        {
+            result.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+            run = 0;
+        }
+
+        const std::size_t hash = (pixel[0] * 3u + pixel[1] * 5u + pixel[2] * 7u + pixel[3] * 11u) % 64;
+
+        if (seen[hash] == pixel)
+        {
+            // QOI_OP_INDEX, for recently seen pixels
+            result.push_back(static_cast<std::uint8_t>(hash));
+        }
+        else if (pixel[3] != previous[3])
+        {
+            // QOI_OP_RGBA
+            seen[hash] = pixel;
+            result.insert(result.end(), {0xFF, pixel[0], pixel[1], pixel[2], pixel[3]});
+        }
+        else
+        {
+            seen[hash] = pixel;
+
+            const int red      = wrappedDifference(pixel[0], previous[0]);
+            const int green    = wrappedDifference(pixel[1], previous[1]);
+            const int blue     = wrappedDifference(pixel[2], previous[2]);
+            const int redLuma  = red - green;
+            const int blueLuma = blue - green;
+
+            if ((red >= -2) && (red <= 1) && (green >= -2) && (green <= 1) && (blue >= -2) && (blue <= 1))
+            {
+                // QOI_OP_DIFF, for small differences with the previous pixel
+                result.push_back(static_cast<std::uint8_t>(0x40 | (red + 2) << 4 | (green + 2) << 2 | (blue + 2)));
+            }
+            else if ((green >= -32) && (green <= 31) && (redLuma >= -8) && (redLuma <= 7) && (blueLuma >= -8) &&
+                     (blueLuma <= 7))
+            {
+                // QOI_OP_LUMA, for differences mostly carried by the green channel
+                result.push_back(static_cast<std::uint8_t>(0x80 | (green + 32)));
+                result.push_back(static_cast<std::uint8_t>((redLuma + 8) << 4 | (blueLuma + 8)));
+            }
+            else
+            {
+                // QOI_OP_RGB
+                result.insert(result.end(), {0xFE, pixel[0], pixel[1], pixel[2]});
+            }
+        }
+
+        previous = pixel;
+    }
+
+    // End marker
+    result.insert(result.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+
+    return result;
+}
+
+// Write a whole buffer to a file
+bool writeFile(const std::filesystem::path& filename, const std::vector<std::uint8_t>& data)
+{
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(file);
+}
+} // namespace FrameRecorderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct FrameRecorder::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Frame waiting to be encoded
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Frame
+    {
+        std::vector<std::uint8_t> pixels;    //!< RGBA pixels of the frame
+        Vector2u                  size;      //!< Size of the frame, in pixels
+        std::size_t               index{};   //!< Number of the frame in the recording
+        bool                      flipped{}; //!< Are the rows stored from bottom to top?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixel buffer receiving a frame from the graphics card
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Readback
+    {
+        unsigned int buffer{};   //!< OpenGL identifier of the pixel buffer
+        std::size_t  capacity{}; //!< Size of the pixel buffer, in bytes
+        Vector2u     size;       //!< Size of the frame being read back, in pixels
+        std::size_t  index{};    //!< Number of the frame being read back
+        bool         pending{};  //!< Is a frame being read back into this buffer?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Ring of pixel buffers, created on the first capture of a render target
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PixelBuffers : GlResource
+    {
+        ~PixelBuffers()
+        {
+            const TransientContextLock contextLock;
+
+            for (const Readback& readback : readbacks)
+            {
+                if (readback.buffer)
+                    glCheck(GLEXT_glDeleteBuffers(1, &readback.buffer));
+            }
+        }
+
+        // Hand the frames still being read back to the encoders, oldest first
+        void collectPending(Impl& impl)
+        {
+            const TransientContextLock contextLock;
+
+            for (std::size_t i = 0; i < readbacks.size(); ++i)
+            {
+                Readback& readback = readbacks[(next + i) % readbacks.size()];
+                if (readback.pending)
+                    impl.collect(readback);
+            }
+        }
+
+        std::array<Readback, FrameRecorderImpl::readbackCount> readbacks; //!< Pixel buffers receiving the frames
+        std::size_t                                            next{};    //!< Index of the next pixel buffer to use
+    };
+
+    ~Impl()
+    {
+        stop();
+    }
+
+    void stop()
+    {
+        if (!recording)
+            return;
+
+        if (pixelBuffers)
+            pixelBuffers->collectPending(*this);
+
+        // Let the encoders finish the queue, then wait for them
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        frameQueued.notify_all();
+
+        for (std::thread& encoder : encoders)
+            encoder.join();
+
+        encoders.clear();
+        recording = false;
+
+        reportMessages();
+    }
+
+    // Write the messages of the encoders to sf::err(), from the thread using the recorder
+    void reportMessages()
+    {
+        std::string text;
+        {
+            const std::lock_guard lock(mutex);
+            text.swap(messages);
+        }
+
+        if (!text.empty())
+            err() << text << std::flush;
+    }
+
+    bool enqueue(Frame&& frame)
+    {
+        std::unique_lock lock(mutex);
+
+        if (queue.size() >= settings.queueCapacity)
+        {
+            if (settings.overflowPolicy == OverflowPolicy::Drop)
+            {
+                ++statistics.droppedFrames;
+                return false;
+            }
+
+            frameDequeued.wait(lock, [this] { return queue.size() < settings.queueCapacity; });
+        }
+
+        queue.push_back(std::move(frame));
+        lock.unlock();
+        frameQueued.notify_one();
+
+        return true;
+    }
+
+    void collect([[maybe_unused]] Readback& readback)
+    {
+#ifndef SFML_OPENGL_ES
+
+        Frame frame{{}, readback.size, readback.index, true};
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, readback.buffer));
+
+        if (const void* pixels = glCheck(GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY)))
+        {
+            const auto* begin = static_cast<const std::uint8_t*>(pixels);
+            frame.pixels.assign(begin, begin + std::size_t{readback.size.x} * readback.size.y * 4);
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+        readback.pending = false;
+
+        if (frame.pixels.empty())
+        {
+            err() << "Failed to read back a recorded frame" << std::endl;
+
+            const std::lock_guard lock(mutex);
+            ++statistics.failedFrames;
+            return;
+        }
+
+        enqueue(std::move(frame));
+
+#endif // SFML_OPENGL_ES
+    }
+
+    void encode()
+    {
+        std::unique_lock lock(mutex);
+
+        while (true)
+        {
+            frameQueued.wait(lock, [this] { return !queue.empty() || stopping; });
+
+            // The queue is only empty here when stopping
+            if (queue.empty())
+                return;
+
+            Frame frame = std::move(queue.front());
+            queue.pop_front();
+            ++encodingCount;
+
+            lock.unlock();
+            frameDequeued.notify_one();
+
+            // The errors are reported by the thread using the recorder, sf::err() isn't thread-safe
+            priv::ErrCapture capture;
+
+            const Clock clock;
+            const bool  written = write(frame);
+            const Time  elapsed = clock.getElapsedTime();
+
+            lock.lock();
+            messages += capture.take();
+            --encodingCount;
+            ++(written ? statistics.writtenFrames : statistics.failedFrames);
+            encodingTime += elapsed;
+        }
+    }
+
+    [[nodiscard]] bool write(Frame& frame) const
+    {
+        if (frame.flipped)
+            FrameRecorderImpl::flipRows(frame.pixels, frame.size);
+
+        const std::filesystem::path filename = directory / FrameRecorderImpl::getFilename(frame.index, settings.format);
+
+        switch (settings.format)
+        {
+            case Format::Png:
+                return Image(frame.size, frame.pixels.data()).saveToFile(filename);
+
+            case Format::Qoi:
+                return FrameRecorderImpl::writeFile(filename, FrameRecorderImpl::encodeQoi(frame.pixels, frame.size));
+
+            case Format::Raw:
+                return FrameRecorderImpl::writeFile(filename, frame.pixels);
+        }
+
+        return false;
+    }
+
+    std::filesystem::path         directory;       //!< Directory the frames are written to
+    Settings                      settings;        //!< Settings of the recording
+    bool                          recording{};     //!< Is a recording in progress?
+    std::size_t                   nextIndex{};     //!< Number of the next captured frame
+    std::unique_ptr<PixelBuffers> pixelBuffers;    //!< Pixel buffers used to read frames back asynchronously
+    std::vector<std::thread>      encoders;        //!< Encoding threads
+    mutable std::mutex            mutex;           //!< Protects the members below
+    std::condition_variable       frameQueued;     //!< Signaled when a frame is queued or when stopping
+    std::condition_variable       frameDequeued;   //!< Signaled when there is room in the queue
+    std::deque<Frame>             queue;           //!< Frames waiting to be encoded
+    bool                          stopping{};      //!< Should the encoders stop once the queue is empty?
+    std::size_t                   encodingCount{}; //!< Number of frames being encoded
+    Statistics                    statistics;      //!< Statistics of the recording
+    Time                          encodingTime;    //!< Total time spent encoding frames
+    std::string                   messages;        //!< Errors of the encoders, not reported yet
+};
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::FrameRecorder() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::~FrameRecorder() = default;
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::FrameRecorder(FrameRecorder&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder& FrameRecorder::operator=(FrameRecorder&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::start(const std::filesystem::path& directory, const Settings& settings)
+{
+    stop();
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error)
+    {
+        err() << "Failed to create the frame recording directory\n" << formatDebugPathInfo(directory) << std::endl;
+        return false;
+    }
+
+    m_impl->directory              = directory;
+    m_impl->settings               = settings;
+    m_impl->settings.encoderCount  = std::max(settings.encoderCount, 1u);
+    m_impl->settings.queueCapacity = std::max<std::size_t>(settings.queueCapacity, 1);
+    m_impl->nextIndex              = 0;
+    m_impl->stopping               = false;
+    m_impl->statistics             = {};
+    m_impl->encodingTime           = Time::Zero;
+
+    for (unsigned int i = 0; i < m_impl->settings.encoderCount; ++i)
+        m_impl->encoders.emplace_back(&Impl::encode, m_impl.get());
+
+    m_impl->recording = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::start(const std::filesystem::path& directory)
+{
+    return start(directory, Settings());
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameRecorder::stop()
+{
+    m_impl->stop();
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::isRecording() const
+{
+    return m_impl->recording;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::capture(RenderTarget& target)
+{
+    if (!m_impl->recording)
+        return false;
+
+    m_impl->reportMessages();
+
+    const Vector2u size = target.getSize();
+    if ((size.x == 0) || (size.y == 0))
+        return false;
+
+    // Software render targets already hold their pixels in system memory
+    if (const priv::SoftwareRasterizer* rasterizer = target.getSoftwareRasterizer())
+    {
+        const std::uint8_t* pixels = rasterizer->getPixels();
+        {
+            const std::lock_guard lock(m_impl->mutex);
+            ++m_impl->statistics.capturedFrames;
+        }
+
+        return m_impl->enqueue({{pixels, pixels + std::size_t{size.x} * size.y * 4}, size, m_impl->nextIndex++, false});
+    }
+
+    if (!target.setActive())
+    {
+        err() << "Failed to activate the render target for frame capture" << std::endl;
+        return false;
+    }
+
+    const std::size_t byteCount = std::size_t{size.x} * size.y * 4;
+    const auto        width     = static_cast<GLsizei>(size.x);
+    const auto        height    = static_cast<GLsizei>(size.y);
+
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        ++m_impl->statistics.capturedFrames;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    priv::ensureExtensionsInit();
+
+    if (GLEXT_pixel_buffer_object)
+    {
+        if (!m_impl->pixelBuffers)
+            m_impl->pixelBuffers = std::make_unique<Impl::PixelBuffers>();
+
+        Impl::PixelBuffers& pixelBuffers = *m_impl->pixelBuffers;
+        Impl::Readback&     readback     = pixelBuffers.readbacks[pixelBuffers.next];
+        pixelBuffers.next                = (pixelBuffers.next + 1) % pixelBuffers.readbacks.size();
+
+        // The oldest readback is most likely complete by now, hand it to the encoders before reusing its buffer
+        if (readback.pending)
+            m_impl->collect(readback);
+
+        if (!readback.buffer)
+            glCheck(GLEXT_glGenBuffers(1, &readback.buffer));
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, readback.buffer));
+
+        if (readback.capacity != byteCount)
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                       static_cast<GLsizeiptrARB>(byteCount),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_READ));
+            readback.capacity = byteCount;
+        }
+
+        // With a pixel buffer bound, the copy happens asynchronously
+        glCheck(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        readback.size    = size;
+        readback.index   = m_impl->nextIndex++;
+        readback.pending = true;
+        return true;
+    }
+
+#endif // SFML_OPENGL_ES
+
+    // No pixel buffers: read the pixels back immediately
+    std::vector<std::uint8_t> pixels(byteCount);
+    glCheck(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+
+    return m_impl->enqueue({std::move(pixels), size, m_impl->nextIndex++, true});
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameRecorder::capture(const Image& image)
+{
+    if (!m_impl->recording)
+        return false;
+
+    m_impl->reportMessages();
+
+    const Vector2u size = image.getSize();
+    if ((size.x == 0) || (size.y == 0))
+        return false;
+
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        ++m_impl->statistics.capturedFrames;
+    }
+
+    const std::uint8_t* pixels = image.getPixelsPtr();
+    return m_impl->enqueue({{pixels, pixels + std::size_t{size.x} * size.y * 4}, size, m_impl->nextIndex++, false});
+}
+
+
+////////////////////////////////////////////////////////////
+FrameRecorder::Statistics FrameRecorder::getStatistics() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+
+    Statistics statistics = m_impl->statistics;
+
+    statistics.pendingFrames = m_impl->queue.size() + m_impl->encodingCount;
+
+    if (m_impl->pixelBuffers)
+    {
+        const auto& readbacks = m_impl->pixelBuffers->readbacks;
+        statistics.pendingFrames += static_cast<std::size_t>(
+            std::count_if(readbacks.begin(),
+                          readbacks.end(),
+                          [](const Impl::Readback& readback) { return readback.pending; }));
+    }
+
+    const std::size_t encodedFrames = statistics.writtenFrames + statistics.failedFrames;
+    if (encodedFrames > 0)
+        statistics.averageEncodingTime = m_impl->encodingTime / static_cast<std::int64_t>(encodedFrames);
+
+    return statistics;
+}
+
+} // namespace sf
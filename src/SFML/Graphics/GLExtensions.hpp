@@ -65,16 +65,17 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
@@ -168,6 +169,32 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glCopyBufferSubData \
     glCopyBufferSubData // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 
+// Core since 3.1
+#define GLEXT_uniform_buffer_object false
+#define GLEXT_GL_UNIFORM_BUFFER     0
+#define GLEXT_GL_INVALID_INDEX      0xFFFFFFFF
+#define GLEXT_glBindBufferBase \
+    glBindBufferBase // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetUniformBlockIndex \
+    glGetUniformBlockIndex // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUniformBlockBinding \
+    glUniformBlockBinding // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 4.1
+#define GLEXT_get_program_binary                 false
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           0
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      0
+#define GLEXT_GL_PROGRAM_BINARY_FORMATS          0
+#define GLEXT_glGetProgramiv \
+    glGetProgramiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetProgramBinary \
+    glGetProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramBinary \
+    glProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramParameteri \
+    glProgramParameteri // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 // Core since 3.0 - EXT_sRGB
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
@@ -232,7 +259,9 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
+#define GLEXT_GL_READ_WRITE                    GL_READ_WRITE_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
 #define GLEXT_GL_STREAM_DRAW                   GL_STREAM_DRAW_ARB
 #define GLEXT_GL_WRITE_ONLY                    GL_WRITE_ONLY_ARB
@@ -272,9 +301,12 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glUniform4i              glUniform4iARB
 #define GLEXT_glUniform1fv             glUniform1fvARB
 #define GLEXT_glUniform2fv             glUniform2fvARB
-#define GLEXT_glUniform2iv             glUniform2ivARB
 #define GLEXT_glUniform3fv             glUniform3fvARB
 #define GLEXT_glUniform4fv             glUniform4fvARB
+#define GLEXT_glUniform1iv             glUniform1ivARB
+#define GLEXT_glUniform2iv             glUniform2ivARB
+#define GLEXT_glUniform3iv             glUniform3ivARB
+#define GLEXT_glUniform4iv             glUniform4ivARB
 #define GLEXT_glUniformMatrix3fv       glUniformMatrix3fvARB
 #define GLEXT_glUniformMatrix4fv       glUniformMatrix4fvARB
 #define GLEXT_glGetObjectParameteriv   glGetObjectParameterivARB
@@ -289,13 +321,24 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
     SF_GLAD_GL_ARB_shader_objects, glDeleteObjectARB, glGetHandleARB, glCreateShaderObjectARB, glShaderSourceARB,       \
         glCompileShaderARB, glCreateProgramObjectARB, glAttachObjectARB, glLinkProgramARB, glUseProgramObjectARB,       \
         glUniform1fARB, glUniform2fARB, glUniform3fARB, glUniform4fARB, glUniform1iARB, glUniform2iARB, glUniform3iARB, \
-        glUniform4iARB, glUniform1fvARB, glUniform2fvARB, glUniform2ivARB, glUniform3fvARB, glUniform4fvARB,            \
-        glUniformMatrix3fvARB, glUniformMatrix4fvARB, glGetObjectParameterivARB, glGetInfoLogARB, glGetUniformLocationARB
+        glUniform4iARB, glUniform1fvARB, glUniform2fvARB, glUniform3fvARB, glUniform4fvARB, glUniform1ivARB,            \
+        glUniform2ivARB, glUniform3ivARB, glUniform4ivARB, glUniformMatrix3fvARB, glUniformMatrix4fvARB,                \
+        glGetObjectParameterivARB, glGetInfoLogARB, glGetUniformLocationARB
 
 // Core since 2.0 - ARB_vertex_shader
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
 #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
 #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
+#define GLEXT_glDisableVertexAttribArray          glDisableVertexAttribArrayARB
+#define GLEXT_glEnableVertexAttribArray           glEnableVertexAttribArrayARB
+#define GLEXT_glGetAttribLocation                 glGetAttribLocationARB
+#define GLEXT_glVertexAttrib2f                    glVertexAttrib2fARB
+#define GLEXT_glVertexAttrib4Nub                  glVertexAttrib4NubARB
+#define GLEXT_glVertexAttribPointer               glVertexAttribPointerARB
+
+#define GLEXT_vertex_shader_dependencies                                                                              \
+    SF_GLAD_GL_ARB_vertex_shader, glDisableVertexAttribArrayARB, glEnableVertexAttribArrayARB, glGetAttribLocationARB, \
+        glVertexAttrib2fARB, glVertexAttrib4NubARB, glVertexAttribPointerARB
 
 // Core since 2.0 - ARB_fragment_shader
 #define GLEXT_fragment_shader                     SF_GLAD_GL_ARB_fragment_shader
@@ -364,6 +407,12 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_framebuffer_multisample_dependencies \
     SF_GLAD_GL_EXT_framebuffer_multisample, glRenderbufferStorageMultisampleEXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+// Not loaded by glad, the buffer entry points of ARB_vertex_buffer_object also accept the pixel buffer targets
+#define GLEXT_pixel_buffer_object  (GLEXT_GL_VERSION_2_1 && GLEXT_vertex_buffer_object)
+#define GLEXT_GL_PIXEL_PACK_BUFFER GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_STREAM_READ       GL_STREAM_READ_ARB
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer          SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER  GL_COPY_READ_BUFFER
@@ -372,6 +421,38 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_copy_buffer_dependencies SF_GLAD_GL_ARB_copy_buffer, glCopyBufferSubData
 
+// Core since 3.1 - ARB_uniform_buffer_object
+#define GLEXT_uniform_buffer_object  SF_GLAD_GL_ARB_uniform_buffer_object
+#define GLEXT_GL_UNIFORM_BUFFER      GL_UNIFORM_BUFFER
+#define GLEXT_GL_INVALID_INDEX       GL_INVALID_INDEX
+#define GLEXT_glBindBufferBase       glBindBufferBase
+#define GLEXT_glGetUniformBlockIndex glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding  glUniformBlockBinding
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_ARB_uniform_buffer_object, glBindBufferBase, glGetUniformBlockIndex, glUniformBlockBinding
+
+// Core since 4.1 - ARB_get_program_binary
+#define GLEXT_get_program_binary                 SF_GLAD_GL_ARB_get_program_binary
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_GL_PROGRAM_BINARY_FORMATS          GL_PROGRAM_BINARY_FORMATS
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+
+#define GLEXT_get_program_binary_dependencies \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramiv, glGetProgramBinary, glProgramBinary, glProgramParameteri
+
+// KHR_parallel_shader_compile / ARB_parallel_shader_compile
+// Not loaded by glad, only the query token is needed since compiling in parallel is the default
+#define GLEXT_GL_COMPLETION_STATUS 0x91B1
+
+// Core since 3.3 - ARB_instanced_arrays
+// Not loaded by glad, the entry points are retrieved with sf::Context::getFunction when needed
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
@@ -0,0 +1,407 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLStateShadow.hpp>
+
+#include <algorithm>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace GLStateShadowImpl
+{
+// Index of a shadowed server-side capability, or nothing if it isn't shadowed
+std::optional<std::size_t> getCapabilityIndex(GLenum capability)
+{
+    switch (capability)
+    {
+        case GL_ALPHA_TEST:
+            return 0;
+        case GL_BLEND:
+            return 1;
+        case GL_CULL_FACE:
+            return 2;
+        case GL_DEPTH_TEST:
+            return 3;
+        case GL_LIGHTING:
+            return 4;
+        case GL_SCISSOR_TEST:
+            return 5;
+        case GL_STENCIL_TEST:
+            return 6;
+        case GL_TEXTURE_2D:
+            return 7;
+#ifndef SFML_OPENGL_ES
+        case GL_FRAMEBUFFER_SRGB:
+            return 8;
+#endif
+        default:
+            return std::nullopt;
+    }
+}
+
+// Index of a shadowed client-side array, or nothing if it isn't shadowed
+std::optional<std::size_t> getClientArrayIndex(GLenum array)
+{
+    switch (array)
+    {
+        case GL_VERTEX_ARRAY:
+            return 0;
+        case GL_COLOR_ARRAY:
+            return 1;
+        case GL_TEXTURE_COORD_ARRAY:
+            return 2;
+        default:
+            return std::nullopt;
+    }
+}
+
+// The identity matrix, in column-major order
+constexpr std::array<float, 16> identityMatrix = {1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f,
+                                                  0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f};
+} // namespace GLStateShadowImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool GLStateShadow::TextureBinding::operator==(const TextureBinding& right) const
+{
+    return (textureId == right.textureId) && (coordinateType == right.coordinateType) &&
+           (pixelsFlipped == right.pixelsFlipped);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+bool GLStateShadow::change(std::optional<T>& state, const T& value)
+{
+    if (m_trusted && (state == value))
+    {
+        ++m_skippedCount;
+        return false;
+    }
+
+    state = value;
+    ++m_issuedCount;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename F>
+void GLStateShadow::changeMatrix(GLenum mode, const Matrix& matrix, F load)
+{
+    if (!change(mode == GL_PROJECTION ? m_projectionMatrix : m_modelViewMatrix, matrix))
+        return;
+
+    // GL_MODELVIEW is always the current mode, only the other stacks have to be selected
+    if (mode != GL_MODELVIEW)
+        glCheck(glMatrixMode(mode));
+
+    load();
+
+    if (mode != GL_MODELVIEW)
+        glCheck(glMatrixMode(GL_MODELVIEW));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::invalidate()
+{
+    m_capabilities.fill(std::nullopt);
+    m_clientArrays.fill(std::nullopt);
+    m_colorMask.reset();
+    m_activeTextureUnit.reset();
+    m_textureBindings.fill(std::nullopt);
+    m_arrayBuffer.reset();
+    m_elementArrayBuffer.reset();
+    m_blendFunc.reset();
+    m_blendEquation.reset();
+    m_stencilFunc.reset();
+    m_stencilOp.reset();
+    m_viewport.reset();
+    m_scissor.reset();
+    m_modelViewMatrix.reset();
+    m_projectionMatrix.reset();
+    m_programId.reset();
+    m_uniformBuffers.fill(std::nullopt);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setTrusted(bool trusted)
+{
+    if (trusted != m_trusted)
+    {
+        invalidate();
+        m_trusted = trusted;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setEnabled(GLenum capability, bool enabled)
+{
+    const std::optional<std::size_t> index = GLStateShadowImpl::getCapabilityIndex(capability);
+
+    if (!index || change(m_capabilities[*index], enabled))
+    {
+        if (enabled)
+            glCheck(glEnable(capability));
+        else
+            glCheck(glDisable(capability));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setClientStateEnabled(GLenum array, bool enabled)
+{
+    const std::optional<std::size_t> index = GLStateShadowImpl::getClientArrayIndex(array);
+
+    if (!index || change(m_clientArrays[*index], enabled))
+    {
+        if (enabled)
+            glCheck(glEnableClientState(array));
+        else
+            glCheck(glDisableClientState(array));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setColorMask(bool enabled)
+{
+    if (change(m_colorMask, enabled))
+    {
+        const GLboolean mask = enabled ? GL_TRUE : GL_FALSE;
+        glCheck(glColorMask(mask, mask, mask, mask));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setActiveTextureUnit(unsigned int unit)
+{
+    if (change(m_activeTextureUnit, unit))
+        glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0 + static_cast<GLenum>(unit)));
+}
+
+
+////////////////////////////////////////////////////////////
+bool GLStateShadow::changeTextureBinding(const TextureBinding& binding, bool force)
+{
+    const unsigned int unit = m_activeTextureUnit.value_or(TextureUnitCount);
+
+    // Units beyond the shadowed ones, or an unknown active unit, always have to be bound
+    if (unit >= TextureUnitCount)
+    {
+        ++m_issuedCount;
+        return true;
+    }
+
+    if (force)
+    {
+        m_textureBindings[unit] = binding;
+        ++m_issuedCount;
+        return true;
+    }
+
+    return change(m_textureBindings[unit], binding);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::bindArrayBuffer(unsigned int buffer, std::uint64_t bufferId)
+{
+    if (change(m_arrayBuffer, bufferId))
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::bindElementArrayBuffer(unsigned int buffer, std::uint64_t bufferId)
+{
+    if (change(m_elementArrayBuffer, bufferId))
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ELEMENT_ARRAY_BUFFER, buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setBlendFunc(GLenum colorSrc, GLenum colorDst, GLenum alphaSrc, GLenum alphaDst)
+{
+    if (!change(m_blendFunc, {colorSrc, colorDst, alphaSrc, alphaDst}))
+        return;
+
+    if (GLEXT_blend_func_separate)
+        glCheck(GLEXT_glBlendFuncSeparate(colorSrc, colorDst, alphaSrc, alphaDst));
+    else
+        glCheck(glBlendFunc(colorSrc, colorDst));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setBlendEquation(GLenum color, GLenum alpha)
+{
+    if (!change(m_blendEquation, {color, alpha}))
+        return;
+
+    if (GLEXT_blend_equation_separate)
+        glCheck(GLEXT_glBlendEquationSeparate(color, alpha));
+    else
+        glCheck(GLEXT_glBlendEquation(color));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setStencilFunc(GLenum function, GLint reference, GLuint mask)
+{
+    if (change(m_stencilFunc, {function, reference, mask}))
+        glCheck(glStencilFunc(function, reference, mask));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setStencilOp(GLenum stencilFail, GLenum depthFail, GLenum depthPass)
+{
+    if (change(m_stencilOp, {stencilFail, depthFail, depthPass}))
+        glCheck(glStencilOp(stencilFail, depthFail, depthPass));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    if (change(m_viewport, {x, y, width, height}))
+        glCheck(glViewport(x, y, width, height));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::setScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    if (change(m_scissor, {x, y, width, height}))
+        glCheck(glScissor(x, y, width, height));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::loadMatrix(GLenum mode, const float* matrix)
+{
+    Matrix values{};
+    std::copy(matrix, matrix + values.size(), values.begin());
+
+    changeMatrix(mode, values, [matrix] { glCheck(glLoadMatrixf(matrix)); });
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::loadIdentity(GLenum mode)
+{
+    changeMatrix(mode, GLStateShadowImpl::identityMatrix, [] { glCheck(glLoadIdentity()); });
+}
+
+
+#ifndef SFML_OPENGL_ES
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::useProgram(unsigned int program, std::uint64_t programId)
+{
+    if (change(m_programId, programId))
+    {
+        m_program = program;
+
+#if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+        glCheck(GLEXT_glUseProgramObject(reinterpret_cast<GLEXT_GLhandle>(std::ptrdiff_t{program})));
+#else
+        glCheck(GLEXT_glUseProgramObject(program));
+#endif
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::uint64_t> GLStateShadow::getProgramId() const
+{
+    if (!m_trusted)
+        return std::nullopt;
+
+    return m_programId;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GLStateShadow::getProgram() const
+{
+    return m_program;
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::bindUniformBuffer(unsigned int index, unsigned int buffer, std::uint64_t bufferId)
+{
+    // Binding points beyond the shadowed ones always have to be bound
+    if (index >= UniformBufferCount)
+    {
+        ++m_issuedCount;
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER, index, buffer));
+        return;
+    }
+
+    if (change(m_uniformBuffers[index], bufferId))
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER, index, buffer));
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t GLStateShadow::getIssuedCount() const
+{
+    return m_issuedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t GLStateShadow::getSkippedCount() const
+{
+    return m_skippedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateShadow::resetCounters()
+{
+    m_issuedCount  = 0;
+    m_skippedCount = 0;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,379 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+
+#include <array>
+#include <optional>
+#include <tuple>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Shadow copy of the raw OpenGL states of a context
+///
+/// State changes requested by the graphics module go through
+/// the shadow, which skips the OpenGL call when the state is
+/// known to already have the requested value.
+///
+/// States are only trusted while a render target owns the
+/// context, from the moment it sets its OpenGL states until
+/// it is deactivated or the user restores their own states:
+/// at any other time the user is free to change them with
+/// raw OpenGL calls, so every change is issued.
+///
+/// Code that temporarily changes a state and restores it
+/// afterwards (like TextureSaver) doesn't have to go through
+/// the shadow.
+///
+////////////////////////////////////////////////////////////
+class GLStateShadow
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifies what is bound to a texture unit
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TextureBinding
+    {
+        std::uint64_t  textureId{};      //!< Cache identifier of the texture, 0 if none
+        CoordinateType coordinateType{}; //!< Coordinate type used to compute the texture matrix
+        bool           pixelsFlipped{};  //!< Are the pixels of the texture flipped?
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Check if two texture bindings are equal
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool operator==(const TextureBinding& right) const;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all the shadowed states
+    ///
+    /// The next change of every state will be issued.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Trust or stop trusting the shadowed states
+    ///
+    /// Calls are only skipped while the shadow is trusted.
+    /// The shadowed states are forgotten when the trust changes.
+    ///
+    /// \param trusted `true` if all the state changes go through the shadow from now on
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTrusted(bool trusted);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable a server-side capability
+    ///
+    /// \param capability Capability, as passed to `glEnable`
+    /// \param enabled    `true` to enable, `false` to disable
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEnabled(GLenum capability, bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable a client-side array
+    ///
+    /// \param array   Array, as passed to `glEnableClientState`
+    /// \param enabled `true` to enable, `false` to disable
+    ///
+    ////////////////////////////////////////////////////////////
+    void setClientStateEnabled(GLenum array, bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable writing to all the color channels
+    ///
+    /// \param enabled `true` to enable, `false` to disable
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColorMask(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the active texture unit
+    ///
+    /// \param unit Index of the texture unit
+    ///
+    ////////////////////////////////////////////////////////////
+    void setActiveTextureUnit(unsigned int unit);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the binding of a texture to the active texture unit
+    ///
+    /// The caller is responsible for binding the texture
+    /// and setting up its texture matrix if this returns `true`.
+    ///
+    /// \param binding Texture binding to record
+    /// \param force   Should the binding be issued even if it is already current?
+    ///
+    /// \return `true` if the binding must be issued
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool changeTextureBinding(const TextureBinding& binding, bool force = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a buffer to `GL_ARRAY_BUFFER`
+    ///
+    /// \param buffer   OpenGL name of the buffer, 0 to unbind
+    /// \param bufferId Unique identifier of the buffer, never reused unlike OpenGL names
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindArrayBuffer(unsigned int buffer, std::uint64_t bufferId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a buffer to `GL_ELEMENT_ARRAY_BUFFER`
+    ///
+    /// \param buffer   OpenGL name of the buffer, 0 to unbind
+    /// \param bufferId Unique identifier of the buffer, never reused unlike OpenGL names
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindElementArrayBuffer(unsigned int buffer, std::uint64_t bufferId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the blending factors
+    ///
+    /// Falls back to `glBlendFunc` with the color factors if
+    /// separate blending factors are not supported.
+    ///
+    /// \param colorSrc Source factor of the color channels
+    /// \param colorDst Destination factor of the color channels
+    /// \param alphaSrc Source factor of the alpha channel
+    /// \param alphaDst Destination factor of the alpha channel
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBlendFunc(GLenum colorSrc, GLenum colorDst, GLenum alphaSrc, GLenum alphaDst);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the blending equations
+    ///
+    /// Falls back to `glBlendEquation` with the color equation
+    /// if separate blending equations are not supported. The
+    /// caller must make sure that blending equations are supported.
+    ///
+    /// \param color Equation of the color channels
+    /// \param alpha Equation of the alpha channel
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBlendEquation(GLenum color, GLenum alpha);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the stencil test function
+    ///
+    /// \param function  Comparison function, as passed to `glStencilFunc`
+    /// \param reference Reference value
+    /// \param mask      Mask applied to the reference and stored values
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStencilFunc(GLenum function, GLint reference, GLuint mask);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the stencil test actions
+    ///
+    /// \param stencilFail Action when the stencil test fails
+    /// \param depthFail   Action when the stencil test passes but the depth test fails
+    /// \param depthPass   Action when both tests pass
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStencilOp(GLenum stencilFail, GLenum depthFail, GLenum depthPass);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the viewport
+    ///
+    /// \param x      Left of the viewport, in pixels
+    /// \param y      Bottom of the viewport, in pixels
+    /// \param width  Width of the viewport, in pixels
+    /// \param height Height of the viewport, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scissor rectangle
+    ///
+    /// \param x      Left of the rectangle, in pixels
+    /// \param y      Bottom of the rectangle, in pixels
+    /// \param width  Width of the rectangle, in pixels
+    /// \param height Height of the rectangle, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load a matrix into the model-view or projection matrix stack
+    ///
+    /// `GL_MODELVIEW` must be the current matrix mode, as it is
+    /// everywhere in the graphics module; it still is afterwards.
+    ///
+    /// \param mode   Matrix stack, either `GL_MODELVIEW` or `GL_PROJECTION`
+    /// \param matrix 4x4 matrix in column-major order
+    ///
+    ////////////////////////////////////////////////////////////
+    void loadMatrix(GLenum mode, const float* matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the identity into the model-view or projection matrix stack
+    ///
+    /// `GL_MODELVIEW` must be the current matrix mode, as it is
+    /// everywhere in the graphics module; it still is afterwards.
+    ///
+    /// \param mode Matrix stack, either `GL_MODELVIEW` or `GL_PROJECTION`
+    ///
+    ////////////////////////////////////////////////////////////
+    void loadIdentity(GLenum mode);
+
+#ifndef SFML_OPENGL_ES
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Use a program object
+    ///
+    /// \param program   OpenGL name of the program, 0 for the fixed pipeline
+    /// \param programId Unique identifier of the program, never reused unlike OpenGL names
+    ///
+    ////////////////////////////////////////////////////////////
+    void useProgram(unsigned int program, std::uint64_t programId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the unique identifier of the program object currently in use, if known
+    ///
+    /// \return Unique identifier of the program, or `std::nullopt` if it has to be queried
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::uint64_t> getProgramId() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the OpenGL name of the program object currently in use
+    ///
+    /// Only meaningful when `getProgramId` returns a value.
+    ///
+    /// \return OpenGL name of the program, 0 for the fixed pipeline
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getProgram() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a buffer to an indexed `GL_UNIFORM_BUFFER` binding point
+    ///
+    /// \param index    Index of the binding point
+    /// \param buffer   OpenGL name of the buffer, 0 to unbind
+    /// \param bufferId Unique identifier of the buffer, never reused unlike OpenGL names
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBuffer(unsigned int index, unsigned int buffer, std::uint64_t bufferId);
+
+#endif
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of state changes sent to OpenGL
+    ///
+    /// \return Number of issued state changes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getIssuedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of state changes skipped because they wouldn't have changed anything
+    ///
+    /// \return Number of skipped state changes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getSkippedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the issued and skipped counters to zero
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetCounters();
+
+private:
+    using Matrix      = std::array<float, 16>;             //!< Column-major 4x4 matrix
+    using StencilFunc = std::tuple<GLenum, GLint, GLuint>; //!< Function, reference and mask of the stencil test
+    using Rectangle   = std::array<GLint, 4>;              //!< Left, bottom, width and height of a rectangle
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the new value of a state
+    ///
+    /// \param state Shadowed state
+    /// \param value New value of the state
+    ///
+    /// \return `true` if the change must be issued
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard]] bool change(std::optional<T>& state, const T& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record and issue the loading of a matrix
+    ///
+    /// \param mode   Matrix stack, either `GL_MODELVIEW` or `GL_PROJECTION`
+    /// \param matrix New matrix
+    /// \param load   Function issuing the load once `mode` is the current matrix mode
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    void changeMatrix(GLenum mode, const Matrix& matrix, F load);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t CapabilityCount    = 9;  //!< Number of shadowed server-side capabilities
+    static constexpr std::size_t ClientArrayCount   = 3;  //!< Number of shadowed client-side arrays
+    static constexpr std::size_t TextureUnitCount   = 32; //!< Number of shadowed texture units
+    static constexpr std::size_t UniformBufferCount = 16; //!< Number of shadowed uniform buffer binding points
+
+    bool                                                         m_trusted{};          //!< Can the shadowed states be trusted?
+    std::array<std::optional<bool>, CapabilityCount>             m_capabilities;       //!< Server-side capabilities
+    std::array<std::optional<bool>, ClientArrayCount>            m_clientArrays;       //!< Client-side arrays
+    std::optional<bool>                                          m_colorMask;          //!< Color write mask
+    std::optional<unsigned int>                                  m_activeTextureUnit;  //!< Active texture unit
+    std::array<std::optional<TextureBinding>, TextureUnitCount>  m_textureBindings;    //!< Texture bound to each unit
+    std::optional<std::uint64_t>                                 m_arrayBuffer;        //!< Identifier of the buffer bound to `GL_ARRAY_BUFFER`
+    std::optional<std::uint64_t>                                 m_elementArrayBuffer; //!< Identifier of the buffer bound to `GL_ELEMENT_ARRAY_BUFFER`
+    std::optional<std::array<GLenum, 4>>                         m_blendFunc;          //!< Color and alpha blending factors
+    std::optional<std::array<GLenum, 2>>                         m_blendEquation;      //!< Color and alpha blending equations
+    std::optional<StencilFunc>                                   m_stencilFunc;        //!< Stencil test function
+    std::optional<std::array<GLenum, 3>>                         m_stencilOp;          //!< Stencil test actions
+    std::optional<Rectangle>                                     m_viewport;           //!< Viewport
+    std::optional<Rectangle>                                     m_scissor;            //!< Scissor rectangle
+    std::optional<Matrix>                                        m_modelViewMatrix;    //!< Top of the model-view matrix stack
+    std::optional<Matrix>                                        m_projectionMatrix;   //!< Top of the projection matrix stack
+    std::optional<std::uint64_t>                                 m_programId;          //!< Identifier of the program object in use
+    unsigned int                                                 m_program{};          //!< OpenGL name of the program object in use
+    std::array<std::optional<std::uint64_t>, UniformBufferCount> m_uniformBuffers;     //!< Identifier of the buffer bound to each uniform buffer binding point
+    std::uint64_t                                                m_issuedCount{};      //!< Number of issued state changes
+    std::uint64_t                                                m_skippedCount{};     //!< Number of skipped state changes
+};
+
+} // namespace sf::priv
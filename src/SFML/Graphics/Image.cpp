@@ -30,6 +30,7 @@
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/PackFile.hpp>
 #include <SFML/System/Utils.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/Activity.hpp>
@@ -43,6 +44,7 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -199,6 +201,10 @@ void Image::resize(Vector2u size, const std::uint8_t* pixels)
 ////////////////////////////////////////////////////////////
 bool Image::loadFromFile(const std::filesystem::path& filename)
 {
+    // Entries of mounted pack files take precedence over the file system
+    if (const std::unique_ptr<InputStream> stream = PackFile::openMountedStream(filename))
+        return loadFromStream(*stream);
+
 #ifdef SFML_SYSTEM_ANDROID
 
     if (priv::getActivityStatesPtr() != nullptr)
@@ -291,11 +297,18 @@ bool Image::loadFromStream(InputStream& stream)
     callbacks.skip = skip;
     callbacks.eof  = eof;
 
+    // Decode the stream in place if its content is already in memory (memory or mapped file streams)
+    const auto*         data    = static_cast<const unsigned char*>(stream.getData());
+    const std::optional size    = stream.getSize();
+    const bool          inPlace = data && size && (*size <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+
     // Load the image and get a pointer to the pixels in memory
     int width    = 0;
     int height   = 0;
     int channels = 0;
-    if (const auto ptr = StbPtr(stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &channels, STBI_rgb_alpha)))
+    if (const auto ptr = StbPtr(
+            inPlace ? stbi_load_from_memory(data, static_cast<int>(*size), &width, &height, &channels, STBI_rgb_alpha)
+                    : stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &channels, STBI_rgb_alpha)))
     {
         // Assign the image properties
         m_size = Vector2u(Vector2i(width, height));
@@ -0,0 +1,453 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cassert>
+
+
+namespace
+{
+// Below this number of particles per thread, dispatching them to other threads costs more than it saves
+constexpr std::size_t minParticlesPerThread = 16'384;
+
+// Particles are moved and turned into quads block by block, so that each block
+// is still in the cache when its quads are written
+constexpr std::size_t blockSize = 1024;
+
+// Call a function on contiguous slices of [0, count), one per thread; the calling thread takes part in the work
+template <typename F>
+void forEachSlice(std::size_t count, unsigned int threadCount, F&& function)
+{
+    const std::size_t sliceCount = std::clamp<std::size_t>(count / minParticlesPerThread, 1, threadCount);
+    if (sliceCount == 1)
+    {
+        function(std::size_t{0}, count);
+        return;
+    }
+
+    const std::size_t sliceSize = (count + sliceCount - 1) / sliceCount;
+    sf::TaskScheduler::getDefault().parallelFor(0, count, std::forward<F>(function), sliceSize);
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(std::size_t capacity) :
+m_capacity(capacity),
+m_positionsX(capacity),
+m_positionsY(capacity),
+m_velocitiesX(capacity),
+m_velocitiesY(capacity),
+m_lifetimes(capacity),
+m_durations(capacity),
+m_colors(capacity)
+{
+    // The triangles of the quads never change, two for each particle
+    m_indices.reserve(capacity * 6);
+
+    for (std::size_t i = 0; i < capacity; ++i)
+    {
+        const auto first = static_cast<std::uint32_t>(i * 4);
+        for (const std::uint32_t corner : {0u, 1u, 2u, 1u, 3u, 2u})
+            m_indices.push_back(first + corner);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::emit(Vector2f position, Vector2f velocity, Color color, Time lifetime)
+{
+    if ((m_count == m_capacity) || (lifetime <= Time::Zero))
+        return false;
+
+    const std::size_t index = m_count++;
+    m_positionsX[index]     = position.x;
+    m_positionsY[index]     = position.y;
+    m_velocitiesX[index]    = velocity.x;
+    m_velocitiesY[index]    = velocity.y;
+    m_lifetimes[index]      = lifetime.asSeconds();
+    m_durations[index]      = lifetime.asSeconds();
+    m_colors[index]         = color;
+
+    m_bufferCurrent  = false;
+    m_stagingCurrent = false;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time elapsed)
+{
+    const float seconds = elapsed.asSeconds();
+
+    // Remove the expired particles by moving the last ones into their slot,
+    // so that the live particles always occupy the beginning of the arrays
+    for (std::size_t i = 0; i < m_count;)
+    {
+        if (m_lifetimes[i] > seconds)
+        {
+            ++i;
+            continue;
+        }
+
+        const std::size_t last = --m_count;
+        m_positionsX[i]        = m_positionsX[last];
+        m_positionsY[i]        = m_positionsY[last];
+        m_velocitiesX[i]       = m_velocitiesX[last];
+        m_velocitiesY[i]       = m_velocitiesY[last];
+        m_lifetimes[i]         = m_lifetimes[last];
+        m_durations[i]         = m_durations[last];
+        m_colors[i]            = m_colors[last];
+    }
+
+    m_bufferCurrent  = false;
+    m_stagingCurrent = false;
+
+    if (m_count == 0)
+        return;
+
+    // Particles that were last drawn from the vertex buffer will most likely be drawn from it again:
+    // write their quads straight into its memory, the quads are then never written anywhere else
+    Vertex* vertices = nullptr;
+#ifndef SFML_OPENGL_ES
+    if (m_drawnFromBuffer && m_vertexBuffer && (m_vertexBuffer->getNativeHandle() != 0))
+        vertices = m_vertexBuffer->map();
+#endif
+
+    forEachSlice(m_count,
+                 m_threadCount,
+                 [this, seconds, vertices](std::size_t begin, std::size_t end)
+                 { updateRange(begin, end, seconds, vertices); });
+
+    if (vertices)
+        m_bufferCurrent = m_vertexBuffer->unmap();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::clear()
+{
+    m_count = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getCapacity() const
+{
+    return m_capacity;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getParticlePosition(std::size_t index) const
+{
+    assert(index < m_count && "ParticleSystem::getParticlePosition() Index is out of bounds");
+    return {m_positionsX[index], m_positionsY[index]};
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTexture(const Texture* texture, bool resetRect)
+{
+    if (texture)
+    {
+        // Recompute the texture area if requested, or if there was no texture & rect before
+        if (resetRect || (!m_texture && (m_textureRect == IntRect())))
+            setTextureRect(IntRect({0, 0}, Vector2i(texture->getSize())));
+    }
+
+    // Assign the new texture
+    m_texture = texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTextureRect(const IntRect& rect)
+{
+    m_textureRect    = rect;
+    m_bufferCurrent  = false;
+    m_stagingCurrent = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setParticleSize(Vector2f size)
+{
+    m_particleSize   = size;
+    m_bufferCurrent  = false;
+    m_stagingCurrent = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAcceleration(Vector2f acceleration)
+{
+    m_acceleration = acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setFadeOutEnabled(bool enabled)
+{
+    m_fadeOut        = enabled;
+    m_bufferCurrent  = false;
+    m_stagingCurrent = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setThreadCount(unsigned int count)
+{
+    m_threadCount = std::max(count, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ParticleSystem::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& ParticleSystem::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getParticleSize() const
+{
+    return m_particleSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getAcceleration() const
+{
+    return m_acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::isFadeOutEnabled() const
+{
+    return m_fadeOut;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ParticleSystem::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_count == 0)
+        return;
+
+    states.transform *= getTransform();
+    states.texture        = m_texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    const std::size_t vertexCount = m_count * 4;
+    const std::size_t indexCount  = m_count * 6;
+
+    // Stream the vertices to the graphics card, if it supports the required buffers;
+    // targets drawn on the CPU can't use buffers, they read the vertices in place
+    const auto uploadToBuffers = [&]
+    {
+        if (target.isSoftware() || !VertexBuffer::isAvailable() || !IndexBuffer::isAvailable() ||
+            !IndexBuffer::isUint32Available())
+            return false;
+
+        // Indices never change, upload them once
+        if (!m_indexBuffer)
+            m_indexBuffer.emplace(IndexBuffer::Type::Uint32, IndexBuffer::Usage::Static);
+
+        if ((m_indexBuffer->getIndexCount() == 0) &&
+            (!m_indexBuffer->create(m_indices.size()) || !m_indexBuffer->update(m_indices.data(), m_indices.size())))
+            return false;
+
+        if (!m_vertexBuffer)
+            m_vertexBuffer.emplace(PrimitiveType::Triangles, VertexBuffer::Usage::Stream);
+
+        if (m_bufferCurrent)
+            return true;
+
+        if ((m_vertexBuffer->getNativeHandle() == 0) && !m_vertexBuffer->create(m_capacity * 4))
+            return false;
+
+#ifdef SFML_OPENGL_ES
+        // Buffers can't be mapped, the quads are uploaded from system memory
+        if (!m_vertexBuffer->update(getStagedVertices(), vertexCount, 0))
+            return false;
+#else
+        // Mapping a stream buffer orphans its previous storage, so we never wait for the GPU to finish drawing it
+        Vertex* const mapped = m_vertexBuffer->map();
+        if (!mapped)
+            return false;
+
+        forEachSlice(m_count,
+                     m_threadCount,
+                     [this, mapped](std::size_t begin, std::size_t end) { writeVertices(begin, end, mapped); });
+
+        if (!m_vertexBuffer->unmap())
+            return false;
+#endif
+
+        m_bufferCurrent = true;
+        return true;
+    };
+
+    m_drawnFromBuffer = uploadToBuffers();
+
+    if (m_drawnFromBuffer)
+    {
+        target.draw(*m_vertexBuffer, *m_indexBuffer, 0, indexCount, states);
+    }
+    else
+    {
+        target.draw(getStagedVertices(), vertexCount, m_indices.data(), indexCount, PrimitiveType::Triangles, states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const Vertex* ParticleSystem::getStagedVertices() const
+{
+    if (!m_stagingCurrent)
+    {
+        // The staging array is only needed when the quads can't be written to the vertex buffer
+        m_vertices.resize(m_capacity * 4);
+
+        forEachSlice(m_count,
+                     m_threadCount,
+                     [this](std::size_t begin, std::size_t end) { writeVertices(begin, end, m_vertices.data()); });
+
+        m_stagingCurrent = true;
+    }
+
+    return m_vertices.data();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::updateRange(std::size_t begin, std::size_t end, float elapsed, Vertex* vertices)
+{
+    // Work on raw pointers so that the compiler doesn't reload the arrays at each iteration
+    float* const positionsX  = m_positionsX.data();
+    float* const positionsY  = m_positionsY.data();
+    float* const velocitiesX = m_velocitiesX.data();
+    float* const velocitiesY = m_velocitiesY.data();
+    float* const lifetimes   = m_lifetimes.data();
+
+    const Vector2f velocityDelta = m_acceleration * elapsed;
+
+    for (std::size_t blockBegin = begin; blockBegin < end; blockBegin += blockSize)
+    {
+        const std::size_t blockEnd = std::min(blockBegin + blockSize, end);
+
+        // Branch-free loop over separate arrays, which compilers can vectorize
+        for (std::size_t i = blockBegin; i < blockEnd; ++i)
+        {
+            velocitiesX[i] += velocityDelta.x;
+            velocitiesY[i] += velocityDelta.y;
+            positionsX[i] += velocitiesX[i] * elapsed;
+            positionsY[i] += velocitiesY[i] * elapsed;
+            lifetimes[i] -= elapsed;
+        }
+
+        if (vertices)
+            writeVertices(blockBegin, blockEnd, vertices);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::writeVertices(std::size_t begin, std::size_t end, Vertex* vertices) const
+{
+    // Work on raw pointers, otherwise writing the vertices forces the compiler to reload the arrays
+    const float* const positionsX = m_positionsX.data();
+    const float* const positionsY = m_positionsY.data();
+    const float* const lifetimes  = m_lifetimes.data();
+    const float* const durations  = m_durations.data();
+    const Color* const colors     = m_colors.data();
+    const bool         fadeOut    = m_fadeOut;
+
+    const Vector2f halfSize = m_particleSize / 2.f;
+    const Vector2f topRight(halfSize.x, -halfSize.y);
+    const Vector2f bottomLeft(-halfSize.x, halfSize.y);
+
+    const FloatRect rect(m_textureRect);
+    const Vector2f  texTopLeft     = rect.position;
+    const Vector2f  texTopRight    = rect.position + Vector2f(rect.size.x, 0.f);
+    const Vector2f  texBottomLeft  = rect.position + Vector2f(0.f, rect.size.y);
+    const Vector2f  texBottomRight = rect.position + rect.size;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        Color color = colors[i];
+        if (fadeOut)
+        {
+            const float ratio = std::clamp(lifetimes[i] / durations[i], 0.f, 1.f);
+            color.a           = static_cast<std::uint8_t>(static_cast<float>(color.a) * ratio);
+        }
+
+        // Whole vertices are written, and never read back: mapped buffer memory may be slow to read
+        const Vector2f center(positionsX[i], positionsY[i]);
+        Vertex* const  quad = vertices + i * 4;
+        quad[0]             = Vertex{center - halfSize, color, texTopLeft};
+        quad[1]             = Vertex{center + topRight, color, texTopRight};
+        quad[2]             = Vertex{center + bottomLeft, color, texBottomLeft};
+        quad[3]             = Vertex{center + halfSize, color, texBottomRight};
+    }
+}
+
+} // namespace sf
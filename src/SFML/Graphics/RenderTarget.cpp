@@ -28,10 +28,14 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/SoftwareRasterizer.hpp>
+#include <SFML/Graphics/StatesCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 
 #include <SFML/Window/Context.hpp>
 
@@ -39,13 +43,18 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
-#include <mutex>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <optional>
 #include <ostream>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
 
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 
 
 namespace
@@ -53,36 +62,12 @@ namespace
 // A nested named namespace is used here to allow unity builds of SFML.
 namespace RenderTargetImpl
 {
-// Mutex to protect ID generation and our context-RenderTarget-map
-std::recursive_mutex& getMutex()
-{
-    static std::recursive_mutex mutex;
-    return mutex;
-}
-
-// Unique identifier, used for identifying RenderTargets when
+// Unique identifier, used for identifying RenderTargets and their views when
 // tracking the currently active RenderTarget within a given context
 std::uint64_t getUniqueId()
 {
-    const std::lock_guard lock(getMutex());
-    static std::uint64_t  id = 1; // start at 1, zero is "no RenderTarget"
-    return id++;
-}
-
-// Map to help us detect whether a different RenderTarget
-// has been activated within a single context
-using ContextRenderTargetMap = std::unordered_map<std::uint64_t, std::uint64_t>;
-ContextRenderTargetMap& getContextRenderTargetMap()
-{
-    static ContextRenderTargetMap contextRenderTargetMap;
-    return contextRenderTargetMap;
-}
-
-// Check if a RenderTarget with the given ID is active in the current context
-bool isActive(std::uint64_t id)
-{
-    const auto it = getContextRenderTargetMap().find(sf::Context::getActiveContextId());
-    return (it != getContextRenderTargetMap().end()) && (it->second == id);
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no RenderTarget"
+    return id.fetch_add(1, std::memory_order_relaxed);
 }
 
 // Convert an sf::BlendMode::Factor constant to the corresponding OpenGL constant.
@@ -191,6 +176,208 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Compute the bounding rectangle of the area of the world visible through a view,
+// taking its viewport and scissor into account; std::nullopt if nothing is visible
+std::optional<sf::FloatRect> computeVisibleArea(const sf::View& view)
+{
+    const sf::FloatRect& viewport = view.getViewport();
+
+    // Part of the viewport that is both inside the target and not scissored out
+    std::optional<sf::FloatRect> visible = viewport.findIntersection(sf::FloatRect({0, 0}, {1, 1}));
+    if (visible)
+        visible = visible->findIntersection(view.getScissor());
+    if (!visible)
+        return std::nullopt;
+
+    // Convert it to normalized device coordinates (Y axis pointing up), then back to world coordinates
+    const sf::Vector2f min((visible->position.x - viewport.position.x) / viewport.size.x * 2.f - 1.f,
+                           1.f - (visible->position.y + visible->size.y - viewport.position.y) / viewport.size.y * 2.f);
+    const sf::Vector2f max((visible->position.x + visible->size.x - viewport.position.x) / viewport.size.x * 2.f - 1.f,
+                           1.f - (visible->position.y - viewport.position.y) / viewport.size.y * 2.f);
+
+    return view.getInverseTransform().transformRect(sf::FloatRect(min, max - min));
+}
+
+
+// Convert an sf::PrimitiveType constant to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr sf::priv::EnumArray<sf::PrimitiveType, GLenum, 6> modes =
+        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[type];
+}
+
+// Convert an sf::VertexLayout::Format to the corresponding OpenGL constant.
+GLenum formatToGlConstant(sf::VertexLayout::Format format)
+{
+    return (format == sf::VertexLayout::Format::Short) ? GL_SHORT : GL_FLOAT;
+}
+
+// Read a 2-component attribute stored in the given format
+sf::Vector2f readAttribute(const std::byte* data, sf::VertexLayout::Format format)
+{
+    if (format == sf::VertexLayout::Format::Short)
+    {
+        sf::Vector2<std::int16_t> value;
+        std::memcpy(&value, data, sizeof(value));
+        return sf::Vector2f(value);
+    }
+
+    sf::Vector2f value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+// Expand vertices of any layout to sf::Vertex, for targets which can only read the latter
+std::vector<sf::Vertex> expandVertices(const void* vertices, std::size_t vertexCount, const sf::VertexLayout& layout)
+{
+    std::vector<sf::Vertex> result(vertexCount);
+    const auto*             data = static_cast<const std::byte*>(vertices);
+
+    for (sf::Vertex& vertex : result)
+    {
+        vertex.position = readAttribute(data + layout.positionOffset, layout.positionFormat);
+
+        if (layout.colorOffset)
+            std::memcpy(&vertex.color, data + *layout.colorOffset, sizeof(vertex.color));
+        else
+            vertex.color = layout.color;
+
+        if (layout.texCoordsOffset)
+            vertex.texCoords = readAttribute(data + *layout.texCoordsOffset, layout.texCoordsFormat);
+
+        data += layout.stride;
+    }
+
+    return result;
+}
+
+#ifndef SFML_OPENGL_ES
+
+// Vertex attribute of an instance, read from the vertices encoding it
+struct InstanceAttribute
+{
+    const char* name;       //!< Name of the attribute in the shader
+    GLint       size;       //!< Number of components
+    GLenum      type;       //!< Type of the components
+    GLboolean   normalized; //!< Are the components normalized integers?
+    std::size_t offset;     //!< Offset of the attribute from the first vertex of the instance
+};
+
+// Layout of an instance, see RenderTarget::encodeInstance
+constexpr std::array<InstanceAttribute, 6> instanceAttributes{{
+    {"sf_instanceTransform0", 2, GL_FLOAT, GL_FALSE, 0},                            // vertex 0, position
+    {"sf_instanceColor", 4, GL_UNSIGNED_BYTE, GL_TRUE, 8},                          // vertex 0, color
+    {"sf_instanceTransform1", 2, GL_FLOAT, GL_FALSE, 12},                           // vertex 0, texCoords
+    {"sf_instanceTransform2", 2, GL_FLOAT, GL_FALSE, sizeof(sf::Vertex)},           // vertex 1, position
+    {"sf_instanceTexturePosition", 2, GL_FLOAT, GL_FALSE, sizeof(sf::Vertex) + 12}, // vertex 1, texCoords
+    {"sf_instanceTextureSize", 2, GL_FLOAT, GL_FALSE, 2 * sizeof(sf::Vertex)}}};    // vertex 2, position
+
+// Built-in shaders applying the instance attributes, used when no shader is provided
+constexpr std::string_view instancingVertexShader = R"(
+attribute vec2 sf_instanceTransform0;
+attribute vec2 sf_instanceTransform1;
+attribute vec2 sf_instanceTransform2;
+attribute vec4 sf_instanceColor;
+attribute vec2 sf_instanceTexturePosition;
+attribute vec2 sf_instanceTextureSize;
+
+void main()
+{
+    vec2 position = sf_instanceTransform0 * gl_Vertex.x + sf_instanceTransform1 * gl_Vertex.y + sf_instanceTransform2;
+    vec2 texCoords = sf_instanceTexturePosition + gl_MultiTexCoord0.xy * sf_instanceTextureSize;
+
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    gl_TexCoord[0] = gl_TextureMatrix[0] * vec4(texCoords, 0.0, 1.0);
+    gl_FrontColor = gl_Color * sf_instanceColor;
+}
+)";
+
+constexpr std::string_view instancingTexturedFragmentShader = R"(
+uniform sampler2D texture;
+
+void main()
+{
+    gl_FragColor = gl_Color * texture2D(texture, gl_TexCoord[0].xy);
+}
+)";
+
+constexpr std::string_view instancingUntexturedFragmentShader = R"(
+void main()
+{
+    gl_FragColor = gl_Color;
+}
+)";
+
+// Get the built-in instancing shader of the context owning a states cache, compiled on first use
+const sf::Shader* getInstancingShader(sf::priv::StatesCache& cache, bool textured)
+{
+    if (!cache.instancingShadersLoaded)
+    {
+        const auto load = [](std::string_view fragmentShader, bool bindTexture) -> std::unique_ptr<sf::Shader>
+        {
+            auto shader = std::make_unique<sf::Shader>();
+            if (!shader->loadFromMemory(instancingVertexShader, fragmentShader))
+                return nullptr;
+
+            if (bindTexture)
+                shader->setUniform("texture", sf::Shader::CurrentTexture);
+
+            return shader;
+        };
+
+        // The shaders are destroyed together with the context, while it is active
+        cache.texturedInstancingShader   = load(instancingTexturedFragmentShader, true);
+        cache.untexturedInstancingShader = load(instancingUntexturedFragmentShader, false);
+        cache.instancingShadersLoaded    = true;
+    }
+
+    return textured ? cache.texturedInstancingShader.get() : cache.untexturedInstancingShader.get();
+}
+
+// Entry points of ARB_instanced_arrays, which glad doesn't load
+struct InstancedArrays
+{
+    using DrawArraysInstanced = void(GLAD_API_PTR*)(GLenum, GLint, GLsizei, GLsizei);
+    using VertexAttribDivisor = void(GLAD_API_PTR*)(GLuint, GLuint);
+
+    DrawArraysInstanced drawArraysInstanced{}; //!< glDrawArraysInstanced, null if instancing is not supported
+    VertexAttribDivisor vertexAttribDivisor{}; //!< glVertexAttribDivisor, null if instancing is not supported
+};
+
+// Retrieve the entry points of ARB_instanced_arrays, or of their core equivalents
+const InstancedArrays& getInstancedArrays()
+{
+    static const InstancedArrays instancedArrays = []
+    {
+        InstancedArrays result;
+
+        const auto load = [&result](const char* drawArraysInstanced, const char* vertexAttribDivisor)
+        {
+            result.drawArraysInstanced = reinterpret_cast<InstancedArrays::DrawArraysInstanced>(
+                sf::Context::getFunction(drawArraysInstanced));
+            result.vertexAttribDivisor = reinterpret_cast<InstancedArrays::VertexAttribDivisor>(
+                sf::Context::getFunction(vertexAttribDivisor));
+        };
+
+        if (GLEXT_GL_VERSION_3_3)
+            load("glDrawArraysInstanced", "glVertexAttribDivisor");
+        else if (sf::Context::isExtensionAvailable("GL_ARB_instanced_arrays"))
+            load("glDrawArraysInstancedARB", "glVertexAttribDivisorARB");
+
+        // Some implementations advertise the extension without providing all of its entry points
+        if (!result.drawArraysInstanced || !result.vertexAttribDivisor)
+            result = InstancedArrays();
+
+        return result;
+    }();
+
+    return instancedArrays;
+}
+
+#endif // SFML_OPENGL_ES
 } // namespace RenderTargetImpl
 } // namespace
 
@@ -200,13 +387,19 @@ namespace sf
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (priv::SoftwareRasterizer* rasterizer = getSoftwareRasterizer())
+    {
+        rasterizer->clear(*this, color, std::nullopt);
+        return;
+    }
+
+    if (ensureActive())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
 
         // Apply the view (scissor testing can affect clearing)
-        if (!m_cache.enable || m_cache.viewChanged)
+        if (!m_cache->enable || (m_cache->lastViewId != m_viewId))
             applyCurrentView();
 
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
@@ -218,13 +411,19 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (priv::SoftwareRasterizer* rasterizer = getSoftwareRasterizer())
+    {
+        rasterizer->clear(*this, std::nullopt, stencilValue);
+        return;
+    }
+
+    if (ensureActive())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
 
         // Apply the view (scissor testing can affect clearing)
-        if (!m_cache.enable || m_cache.viewChanged)
+        if (!m_cache->enable || (m_cache->lastViewId != m_viewId))
             applyCurrentView();
 
         glCheck(glClearStencil(static_cast<int>(stencilValue.value)));
@@ -236,13 +435,19 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (priv::SoftwareRasterizer* rasterizer = getSoftwareRasterizer())
+    {
+        rasterizer->clear(*this, color, stencilValue);
+        return;
+    }
+
+    if (ensureActive())
     {
         // Unbind texture to fix RenderTexture preventing clear
         applyTexture(nullptr);
 
         // Apply the view (scissor testing can affect clearing)
-        if (!m_cache.enable || m_cache.viewChanged)
+        if (!m_cache->enable || (m_cache->lastViewId != m_viewId))
             applyCurrentView();
 
         glCheck(glClearColor(color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f));
@@ -255,8 +460,8 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
-    m_view              = view;
-    m_cache.viewChanged = true;
+    m_view   = view;
+    m_viewId = RenderTargetImpl::getUniqueId();
 }
 
 
@@ -338,9 +543,43 @@ Vector2i RenderTarget::mapCoordsToPixel(Vector2f point, const View& view) const
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setCullingEnabled(bool enabled)
+{
+    m_cullingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCullingEnabled() const
+{
+    return m_cullingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t RenderTarget::getCulledDrawCount() const
+{
+    return m_culledDrawCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetCulledDrawCount()
+{
+    m_culledDrawCount = 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
 {
+    if (m_cullingEnabled && isCulled(drawable, states))
+    {
+        ++m_culledDrawCount;
+        return;
+    }
+
     drawable.draw(*this, states);
 }
 
@@ -352,68 +591,91 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (priv::SoftwareRasterizer* rasterizer = getSoftwareRasterizer())
     {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
-
-        if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
-
-        setupDraw(useVertexCache, states);
+        rasterizer->draw(*this, vertices, vertexCount, type, states, states.texture ? states.texture->m_cacheId : 0);
+        return;
+    }
 
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
-        {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
-        }
+    if (ensureActive())
+    {
+        setupClientVertices(vertices, vertexCount, states);
+        drawPrimitives(type, 0, vertexCount);
+        cleanupDraw(states);
+    }
+}
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
-        {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const void*         vertices,
+                        std::size_t         vertexCount,
+                        const VertexLayout& layout,
+                        PrimitiveType       type,
+                        const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    if (!layout.isValid())
+    {
+        err() << "Invalid vertex layout, drawing skipped" << std::endl;
+        return;
+    }
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
+    if (priv::SoftwareRasterizer* rasterizer = getSoftwareRasterizer())
+    {
+        const std::vector<Vertex> expanded  = RenderTargetImpl::expandVertices(vertices, vertexCount, layout);
+        const std::uint64_t       textureId = states.texture ? states.texture->m_cacheId : 0;
+        rasterizer->draw(*this, expanded.data(), vertexCount, type, states, textureId);
+        return;
+    }
 
+    if (ensureActive())
+    {
+        // Vertices are never pre-transformed, so that they can be read in place
+        setupDraw(false, states);
+        applyVertexLayout(layout, static_cast<const std::byte*>(vertices), states.texture || states.shader);
         drawPrimitives(type, 0, vertexCount);
         cleanupDraw(states);
 
         // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+        m_cache->useVertexCache = false;
     }
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint16_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    drawIndexed(vertices, vertexCount, indices, sizeof(std::uint16_t), indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint32_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // 32-bit indices not supported?
+    if (!getSoftwareRasterizer() && !IndexBuffer::isUint32Available())
+    {
+        err() << "32-bit indices are not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    drawIndexed(vertices, vertexCount, indices, sizeof(std::uint32_t), indexCount, type, states);
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
 {
@@ -424,6 +686,13 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& st
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states)
 {
+    // Vertex buffers live in video memory, software targets can't read them
+    if (getSoftwareRasterizer())
+    {
+        err() << "sf::VertexBuffer can't be drawn by a software render target, drawing skipped" << std::endl;
+        return;
+    }
+
     // VertexBuffer not supported?
     if (!VertexBuffer::isAvailable())
     {
@@ -442,7 +711,14 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     if (!vertexCount || !vertexBuffer.getNativeHandle())
         return;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    // Mapped buffers can't be drawn
+    if (vertexBuffer.isMapped())
+    {
+        err() << "Cannot draw a mapped sf::VertexBuffer, drawing skipped" << std::endl;
+        return;
+    }
+
+    if (ensureActive())
     {
         setupDraw(false, states);
 
@@ -450,12 +726,7 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         VertexBuffer::bind(&vertexBuffer);
 
         // Always enable texture coordinates
-        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
-            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+        applyVertexLayout(vertexBuffer.getLayout(), nullptr, true);
 
         drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
 
@@ -465,9 +736,276 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         cleanupDraw(states);
 
         // Update the cache
-        m_cache.useVertexCache        = false;
-        m_cache.texCoordsArrayEnabled = true;
+        m_cache->useVertexCache = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // Vertex buffers live in video memory, software targets can't read them
+    if (getSoftwareRasterizer())
+    {
+        err() << "sf::VertexBuffer can't be drawn by a software render target, drawing skipped" << std::endl;
+        return;
+    }
+
+    // IndexBuffer not supported?
+    if (!IndexBuffer::isAvailable())
+    {
+        err() << "sf::IndexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    // Mapped buffers can't be drawn
+    if (vertexBuffer.isMapped())
+    {
+        err() << "Cannot draw a mapped sf::VertexBuffer, drawing skipped" << std::endl;
+        return;
+    }
+
+    if (ensureActive())
+    {
+        setupDraw(false, states);
+
+        // Bind vertex and index buffers
+        VertexBuffer::bind(&vertexBuffer);
+        IndexBuffer::bind(&indexBuffer);
+
+        // Always enable texture coordinates
+        applyVertexLayout(vertexBuffer.getLayout(), nullptr, true);
+
+        // With an index buffer bound, the "pointer" is an offset in the buffer
+        const std::size_t indexSize = indexBuffer.getIndexSize();
+        drawIndexedPrimitives(vertexBuffer.getPrimitiveType(),
+                              reinterpret_cast<const void*>(firstIndex * indexSize),
+                              indexSize,
+                              indexCount);
+
+        // Unbind vertex and index buffers
+        IndexBuffer::bind(nullptr);
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache->useVertexCache = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstanced(const VertexBuffer& mesh,
+                                 const VertexBuffer& instanceData,
+                                 std::size_t         instanceCount,
+                                 const RenderStates& states)
+{
+    // Vertex buffers live in video memory, software targets can't read them
+    if (getSoftwareRasterizer())
+    {
+        err() << "Instanced drawing is not available for software render targets, drawing skipped" << std::endl;
+        return;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    // Instanced drawing not supported?
+    if (!VertexBuffer::isAvailable() || !Shader::isAvailable() || !GLEXT_vertex_shader)
+    {
+        err() << "Instanced drawing is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Instances are encoded as sf::Vertex, see encodeInstance
+    if (instanceData.getLayout() != VertexLayout::Default)
+    {
+        err() << "Instance data must use the default vertex layout, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Clamp instanceCount to the number of instances stored in the instance data
+    instanceCount = std::min(instanceCount, instanceData.getVertexCount() / InstanceVertexCount);
+
+    // Nothing to draw?
+    if (!instanceCount || !mesh.getVertexCount() || !mesh.getNativeHandle() || !instanceData.getNativeHandle())
+        return;
+
+    // Mapped buffers can't be drawn
+    if (mesh.isMapped() || instanceData.isMapped())
+    {
+        err() << "Cannot draw a mapped sf::VertexBuffer, drawing skipped" << std::endl;
+        return;
+    }
+
+    if (ensureActive())
+    {
+        // Use the built-in shader if none is provided
+        RenderStates instanceStates = states;
+        if (!instanceStates.shader)
+            instanceStates.shader = RenderTargetImpl::getInstancingShader(*m_cache, states.texture != nullptr);
+
+        // Built-in shader failed to compile? The error has already been reported
+        if (!instanceStates.shader)
+            return;
+
+        setupDraw(false, instanceStates);
+
+        // Find the instance attributes used by the shader, they are looked up once per program
+        std::array<GLint, RenderTargetImpl::instanceAttributes.size()> locations{};
+        for (std::size_t i = 0; i < locations.size(); ++i)
+            locations[i] = instanceStates.shader->getAttributeLocation(RenderTargetImpl::instanceAttributes[i].name);
+
+        const RenderTargetImpl::InstancedArrays& instancedArrays = RenderTargetImpl::getInstancedArrays();
+        const std::byte*                         instances       = nullptr;
+
+        VertexBuffer::bind(&instanceData);
+
+        if (instancedArrays.drawArraysInstanced)
+        {
+            // Source the instance attributes from the instance data, advancing once per instance
+            for (std::size_t i = 0; i < locations.size(); ++i)
+            {
+                if (locations[i] < 0)
+                    continue;
+
+                const RenderTargetImpl::InstanceAttribute& attribute = RenderTargetImpl::instanceAttributes[i];
+                const auto                                 location  = static_cast<GLuint>(locations[i]);
+
+                glCheck(GLEXT_glEnableVertexAttribArray(location));
+                glCheck(GLEXT_glVertexAttribPointer(location,
+                                                    attribute.size,
+                                                    attribute.type,
+                                                    attribute.normalized,
+                                                    static_cast<GLsizei>(InstanceVertexCount * sizeof(Vertex)),
+                                                    reinterpret_cast<const void*>(attribute.offset)));
+                glCheck(instancedArrays.vertexAttribDivisor(location, 1));
+            }
+        }
+        else
+        {
+            // No hardware instancing: read the instances back, they are applied one after the other
+            instances = static_cast<const std::byte*>(
+                glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY)));
+        }
+
+        VertexBuffer::bind(&mesh);
+
+        // Always enable texture coordinates
+        applyVertexLayout(mesh.getLayout(), nullptr, true);
+
+        const GLenum  mode        = RenderTargetImpl::primitiveTypeToGlConstant(mesh.getPrimitiveType());
+        const GLsizei vertexCount = static_cast<GLsizei>(mesh.getVertexCount());
+
+        if (instancedArrays.drawArraysInstanced)
+        {
+            glCheck(instancedArrays.drawArraysInstanced(mode, 0, vertexCount, static_cast<GLsizei>(instanceCount)));
+
+            // Restore the instance attributes, so that they don't leak into the next draws
+            for (const GLint location : locations)
+            {
+                if (location < 0)
+                    continue;
+
+                glCheck(instancedArrays.vertexAttribDivisor(static_cast<GLuint>(location), 0));
+                glCheck(GLEXT_glDisableVertexAttribArray(static_cast<GLuint>(location)));
+            }
+        }
+        else if (instances)
+        {
+            for (std::size_t instance = 0; instance < instanceCount; ++instance)
+            {
+                const std::byte* data = instances + instance * InstanceVertexCount * sizeof(Vertex);
+
+                // Attributes with a disabled array keep a constant value for the whole draw call
+                for (std::size_t i = 0; i < locations.size(); ++i)
+                {
+                    if (locations[i] < 0)
+                        continue;
+
+                    const RenderTargetImpl::InstanceAttribute& attribute = RenderTargetImpl::instanceAttributes[i];
+                    const auto                                 location  = static_cast<GLuint>(locations[i]);
+
+                    if (attribute.type == GL_UNSIGNED_BYTE)
+                    {
+                        Color color;
+                        std::memcpy(&color, data + attribute.offset, sizeof(color));
+                        glCheck(GLEXT_glVertexAttrib4Nub(location, color.r, color.g, color.b, color.a));
+                    }
+                    else
+                    {
+                        Vector2f value;
+                        std::memcpy(&value, data + attribute.offset, sizeof(value));
+                        glCheck(GLEXT_glVertexAttrib2f(location, value.x, value.y));
+                    }
+                }
+
+                glCheck(glDrawArrays(mode, 0, vertexCount));
+            }
+
+            VertexBuffer::bind(&instanceData);
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+        }
+        else
+        {
+            err() << "Failed to read the instance data, drawing skipped" << std::endl;
+        }
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(instanceStates);
+
+        // Update the cache
+        m_cache->useVertexCache = false;
     }
+
+#else
+
+    (void)mesh;
+    (void)instanceData;
+    (void)instanceCount;
+    (void)states;
+
+    err() << "Instanced drawing is not available, drawing skipped" << std::endl;
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<Vertex, RenderTarget::InstanceVertexCount> RenderTarget::encodeInstance(const Transform& transform,
+                                                                                   Color            color,
+                                                                                   const FloatRect& textureRect)
+{
+    // The 4x4 matrix is stored in column-major order
+    const float* matrix = transform.getMatrix();
+
+    return {Vertex{{matrix[0], matrix[1]}, color, {matrix[4], matrix[5]}},
+            Vertex{{matrix[12], matrix[13]}, Color::White, textureRect.position},
+            Vertex{textureRect.size, Color::White, {}}};
 }
 
 
@@ -480,39 +1018,48 @@ bool RenderTarget::isSrgb() const
 
 
 ////////////////////////////////////////////////////////////
-bool RenderTarget::setActive(bool active)
+bool RenderTarget::isSoftware() const
 {
-    // Mark this RenderTarget as active or no longer active in the tracking map
-    const std::lock_guard lock(RenderTargetImpl::getMutex());
+    // Looking the rasterizer up doesn't modify the target
+    return const_cast<RenderTarget&>(*this).getSoftwareRasterizer() != nullptr;
+}
 
-    const std::uint64_t contextId = Context::getActiveContextId();
 
-    using RenderTargetImpl::getContextRenderTargetMap;
-    auto&      contextRenderTargetMap = getContextRenderTargetMap();
-    const auto it                     = contextRenderTargetMap.find(contextId);
+////////////////////////////////////////////////////////////
+bool RenderTarget::setActive(bool active)
+{
+    // Mark this RenderTarget as active or no longer active in the states cache of the current context
+    priv::StatesCache* cache = priv::getActiveStatesCache();
 
     if (active)
     {
-        if (it == contextRenderTargetMap.end())
-        {
-            contextRenderTargetMap[contextId] = m_id;
+        // Nothing to track without a context
+        if (!cache)
+            return true;
 
-            m_cache.glStatesSet = false;
-            m_cache.enable      = false;
+        if (!cache->activeRenderTargetId)
+        {
+            // No RenderTarget was active in this context, the user may
+            // have changed any OpenGL state in the meantime
+            cache->glStatesSet = false;
+            cache->enable      = false;
+            cache->glState.setTrusted(false);
         }
-        else if (it->second != m_id)
+        else if (cache->activeRenderTargetId != m_id)
         {
-            it->second = m_id;
-
-            m_cache.enable = false;
+            // Another RenderTarget was active in this context, the states it left
+            // are known so only the ones specific to this RenderTarget are re-applied
+            cache->renderTargetChanged = true;
         }
+
+        cache->activeRenderTargetId = m_id;
+        m_cache                     = cache;
     }
-    else
+    else if (cache && (cache->activeRenderTargetId == m_id))
     {
-        if (it != contextRenderTargetMap.end())
-            contextRenderTargetMap.erase(it);
-
-        m_cache.enable = false;
+        cache->activeRenderTargetId = 0;
+        cache->enable               = false;
+        cache->glState.setTrusted(false);
     }
 
     return true;
@@ -522,7 +1069,11 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    // Software targets have no OpenGL states
+    if (getSoftwareRasterizer())
+        return;
+
+    if (ensureActive())
     {
 #ifdef SFML_DEBUG
         // make sure that the user didn't leave an unchecked OpenGL error
@@ -553,7 +1104,11 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    // Software targets have no OpenGL states
+    if (getSoftwareRasterizer())
+        return;
+
+    if (ensureActive())
     {
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
@@ -565,6 +1120,9 @@ void RenderTarget::popGLStates()
         glCheck(glPopClientAttrib());
         glCheck(glPopAttrib());
 #endif
+
+        // The user's states are back, they can't be known anymore
+        m_cache->glState.setTrusted(false);
     }
 }
 
@@ -572,6 +1130,10 @@ void RenderTarget::popGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::resetGLStates()
 {
+    // Software targets have no OpenGL states
+    if (getSoftwareRasterizer())
+        return;
+
     // Check here to make sure a context change does not happen after activate(true)
     const bool shaderAvailable       = Shader::isAvailable();
     const bool vertexBufferAvailable = VertexBuffer::isAvailable();
@@ -585,36 +1147,40 @@ void RenderTarget::resetGLStates()
     }
 #endif
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (ensureActive())
     {
         // Make sure that extensions are initialized
         priv::ensureExtensionsInit();
 
+        // The current OpenGL states are unknown, all of them are set below
+        // and from now on every change goes through the shadow
+        priv::GLStateShadow& glState = m_cache->glState;
+        glState.invalidate();
+        glState.setTrusted(true);
+
         // Make sure that the texture unit which is active is the number 0
         if (GLEXT_multitexture)
         {
             glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
-            glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+            glState.setActiveTextureUnit(0);
         }
 
         // Define the default OpenGL states
-        glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_LIGHTING));
-        glCheck(glDisable(GL_STENCIL_TEST));
-        glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_ALPHA_TEST));
-        glCheck(glDisable(GL_SCISSOR_TEST));
-        glCheck(glEnable(GL_TEXTURE_2D));
-        glCheck(glEnable(GL_BLEND));
+        glState.setEnabled(GL_CULL_FACE, false);
+        glState.setEnabled(GL_LIGHTING, false);
+        glState.setEnabled(GL_STENCIL_TEST, false);
+        glState.setEnabled(GL_DEPTH_TEST, false);
+        glState.setEnabled(GL_ALPHA_TEST, false);
+        glState.setEnabled(GL_SCISSOR_TEST, false);
+        glState.setEnabled(GL_TEXTURE_2D, true);
+        glState.setEnabled(GL_BLEND, true);
         glCheck(glMatrixMode(GL_MODELVIEW));
-        glCheck(glLoadIdentity());
-        glCheck(glEnableClientState(GL_VERTEX_ARRAY));
-        glCheck(glEnableClientState(GL_COLOR_ARRAY));
-        glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-        glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
-        m_cache.scissorEnabled = false;
-        m_cache.stencilEnabled = false;
-        m_cache.glStatesSet    = true;
+        glState.loadIdentity(GL_MODELVIEW);
+        glState.setClientStateEnabled(GL_VERTEX_ARRAY, true);
+        glState.setClientStateEnabled(GL_COLOR_ARRAY, true);
+        glState.setClientStateEnabled(GL_TEXTURE_COORD_ARRAY, true);
+        glState.setColorMask(true);
+        m_cache->glStatesSet = true;
 
         // Apply the default SFML states
         applyBlendMode(BlendAlpha);
@@ -624,74 +1190,102 @@ void RenderTarget::resetGLStates()
             applyShader(nullptr);
 
         if (vertexBufferAvailable)
-            glCheck(VertexBuffer::bind(nullptr));
+            VertexBuffer::bind(nullptr);
 
-        m_cache.texCoordsArrayEnabled = true;
+        m_cache->texCoordsArrayEnabled = true;
 
-        m_cache.useVertexCache = false;
+        m_cache->useVertexCache = false;
 
-        // Set the default view
+        // Set the default view and make sure the sRGB encoding is applied on next draw
         setView(getView());
+        m_cache->renderTargetChanged = true;
 
-        m_cache.enable = true;
+        m_cache->enable = true;
     }
 }
 
 
+////////////////////////////////////////////////////////////
+RenderTarget::StateChangeStatistics RenderTarget::getStateChangeStatistics()
+{
+    if (const priv::StatesCache* cache = priv::getActiveStatesCache())
+        return {cache->glState.getIssuedCount(), cache->glState.getSkippedCount()};
+
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetStateChangeStatistics()
+{
+    if (priv::StatesCache* cache = priv::getActiveStatesCache())
+        cache->glState.resetCounters();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::initialize()
 {
     // Setup the default and current views
     m_defaultView = View(FloatRect({0, 0}, Vector2f(getSize())));
-    m_view        = m_defaultView;
-
-    // Set GL states only on first draw, so that we don't pollute user's states
-    m_cache.glStatesSet = false;
+    setView(m_defaultView);
 
     // Generate a unique ID for this RenderTarget to track
     // whether it is active within a specific context
+    // GL states will be set on first draw if the context doesn't
+    // have them yet, so that we don't pollute user's states
     m_id = RenderTargetImpl::getUniqueId();
 }
 
 
+////////////////////////////////////////////////////////////
+priv::SoftwareRasterizer* RenderTarget::getSoftwareRasterizer()
+{
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isActive()
+{
+    m_cache = priv::getActiveStatesCache();
+    return m_cache && (m_cache->activeRenderTargetId == m_id);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::ensureActive()
+{
+    // The states cache of a context is required for any OpenGL call
+    return (isActive() || setActive(true)) && m_cache;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
     // Set the viewport
     const IntRect viewport    = getViewport(m_view);
     const int     viewportTop = static_cast<int>(getSize().y) - (viewport.position.y + viewport.size.y);
-    glCheck(glViewport(viewport.position.x, viewportTop, viewport.size.x, viewport.size.y));
+    m_cache->glState.setViewport(viewport.position.x, viewportTop, viewport.size.x, viewport.size.y);
 
     // Set the scissor rectangle and enable/disable scissor testing
     if (m_view.getScissor() == FloatRect({0, 0}, {1, 1}))
     {
-        if (!m_cache.enable || m_cache.scissorEnabled)
-        {
-            glCheck(glDisable(GL_SCISSOR_TEST));
-            m_cache.scissorEnabled = false;
-        }
+        m_cache->glState.setEnabled(GL_SCISSOR_TEST, false);
     }
     else
     {
         const IntRect pixelScissor = getScissor(m_view);
         const int     scissorTop   = static_cast<int>(getSize().y) - (pixelScissor.position.y + pixelScissor.size.y);
-        glCheck(glScissor(pixelScissor.position.x, scissorTop, pixelScissor.size.x, pixelScissor.size.y));
-
-        if (!m_cache.enable || !m_cache.scissorEnabled)
-        {
-            glCheck(glEnable(GL_SCISSOR_TEST));
-            m_cache.scissorEnabled = true;
-        }
+        m_cache->glState.setScissor(pixelScissor.position.x, scissorTop, pixelScissor.size.x, pixelScissor.size.y);
+        m_cache->glState.setEnabled(GL_SCISSOR_TEST, true);
     }
 
     // Set the projection matrix
-    glCheck(glMatrixMode(GL_PROJECTION));
-    glCheck(glLoadMatrixf(m_view.getTransform().getMatrix()));
-
-    // Go back to model-view mode
-    glCheck(glMatrixMode(GL_MODELVIEW));
+    m_cache->glState.loadMatrix(GL_PROJECTION, m_view.getTransform().getMatrix());
 
-    m_cache.viewChanged = false;
+    m_cache->lastViewId = m_viewId;
 }
 
 
@@ -701,30 +1295,16 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     using RenderTargetImpl::equationToGlConstant;
     using RenderTargetImpl::factorToGlConstant;
 
-    // Apply the blend mode, falling back to the non-separate versions if necessary
-    if (GLEXT_blend_func_separate)
-    {
-        glCheck(GLEXT_glBlendFuncSeparate(factorToGlConstant(mode.colorSrcFactor),
-                                          factorToGlConstant(mode.colorDstFactor),
-                                          factorToGlConstant(mode.alphaSrcFactor),
-                                          factorToGlConstant(mode.alphaDstFactor)));
-    }
-    else
-    {
-        glCheck(glBlendFunc(factorToGlConstant(mode.colorSrcFactor), factorToGlConstant(mode.colorDstFactor)));
-    }
+    // Apply the blend mode, the shadow falls back to the non-separate versions if necessary
+    m_cache->glState.setBlendFunc(factorToGlConstant(mode.colorSrcFactor),
+                                  factorToGlConstant(mode.colorDstFactor),
+                                  factorToGlConstant(mode.alphaSrcFactor),
+                                  factorToGlConstant(mode.alphaDstFactor));
 
     if (GLEXT_blend_minmax || GLEXT_blend_subtract)
     {
-        if (GLEXT_blend_equation_separate)
-        {
-            glCheck(GLEXT_glBlendEquationSeparate(equationToGlConstant(mode.colorEquation),
-                                                  equationToGlConstant(mode.alphaEquation)));
-        }
-        else
-        {
-            glCheck(GLEXT_glBlendEquation(equationToGlConstant(mode.colorEquation)));
-        }
+        m_cache->glState.setBlendEquation(equationToGlConstant(mode.colorEquation),
+                                          equationToGlConstant(mode.alphaEquation));
     }
     else if ((mode.colorEquation != BlendMode::Equation::Add) || (mode.alphaEquation != BlendMode::Equation::Add))
     {
@@ -744,7 +1324,7 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
         }
     }
 
-    m_cache.lastBlendMode = mode;
+    m_cache->lastBlendMode = mode;
 }
 
 
@@ -757,31 +1337,23 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
     // Fast path if we have a default (disabled) stencil mode
     if (mode == StencilMode())
     {
-        if (!m_cache.enable || m_cache.stencilEnabled)
-        {
-            glCheck(glDisable(GL_STENCIL_TEST));
-            glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
-
-            m_cache.stencilEnabled = false;
-        }
+        m_cache->glState.setEnabled(GL_STENCIL_TEST, false);
+        m_cache->glState.setColorMask(true);
     }
     else
     {
         // Apply the stencil mode
-        if (!m_cache.enable || !m_cache.stencilEnabled)
-            glCheck(glEnable(GL_STENCIL_TEST));
-
-        glCheck(glStencilOp(GL_KEEP,
-                            stencilOperationToGlConstant(mode.stencilUpdateOperation),
-                            stencilOperationToGlConstant(mode.stencilUpdateOperation)));
-        glCheck(glStencilFunc(stencilFunctionToGlConstant(mode.stencilComparison),
-                              static_cast<int>(mode.stencilReference.value),
-                              mode.stencilMask.value));
-
-        m_cache.stencilEnabled = true;
+        m_cache->glState.setEnabled(GL_STENCIL_TEST, true);
+
+        m_cache->glState.setStencilOp(GL_KEEP,
+                                      stencilOperationToGlConstant(mode.stencilUpdateOperation),
+                                      stencilOperationToGlConstant(mode.stencilUpdateOperation));
+        m_cache->glState.setStencilFunc(stencilFunctionToGlConstant(mode.stencilComparison),
+                                        static_cast<int>(mode.stencilReference.value),
+                                        mode.stencilMask.value);
     }
 
-    m_cache.lastStencilMode = mode;
+    m_cache->lastStencilMode = mode;
 }
 
 
@@ -791,9 +1363,9 @@ void RenderTarget::applyTransform(const Transform& transform)
     // No need to call glMatrixMode(GL_MODELVIEW), it is always the
     // current mode (for optimization purpose, since it's the most used)
     if (transform == Transform::Identity)
-        glCheck(glLoadIdentity());
+        m_cache->glState.loadIdentity(GL_MODELVIEW);
     else
-        glCheck(glLoadMatrixf(transform.getMatrix()));
+        m_cache->glState.loadMatrix(GL_MODELVIEW, transform.getMatrix());
 }
 
 
@@ -802,8 +1374,8 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 {
     Texture::bind(texture, coordinateType);
 
-    m_cache.lastTextureId      = texture ? texture->m_cacheId : 0;
-    m_cache.lastCoordinateType = coordinateType;
+    m_cache->lastTextureId      = texture ? texture->m_cacheId : 0;
+    m_cache->lastCoordinateType = coordinateType;
 }
 
 
@@ -822,24 +1394,21 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 #ifndef SFML_OPENGL_ES
     // Enable or disable sRGB encoding
     // This is needed for drivers that do not check the format of the surface drawn to before applying sRGB conversion
-    if (!m_cache.enable)
-    {
-        if (isSrgb())
-            glCheck(glEnable(GL_FRAMEBUFFER_SRGB));
-        else
-            glCheck(glDisable(GL_FRAMEBUFFER_SRGB));
-    }
+    if (!m_cache->enable || m_cache->renderTargetChanged)
+        m_cache->glState.setEnabled(GL_FRAMEBUFFER_SRGB, isSrgb());
 #endif
 
+    m_cache->renderTargetChanged = false;
+
     // First set the persistent OpenGL states if it's the very first call
-    if (!m_cache.glStatesSet)
+    if (!m_cache->glStatesSet)
         resetGLStates();
 
     if (useVertexCache)
     {
         // Since vertices are transformed, we must use an identity transform to render them
-        if (!m_cache.enable || !m_cache.useVertexCache)
-            glCheck(glLoadIdentity());
+        if (!m_cache->enable || !m_cache->useVertexCache)
+            m_cache->glState.loadIdentity(GL_MODELVIEW);
     }
     else
     {
@@ -847,23 +1416,23 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     }
 
     // Apply the view
-    if (!m_cache.enable || m_cache.viewChanged)
+    if (!m_cache->enable || (m_cache->lastViewId != m_viewId))
         applyCurrentView();
 
     // Apply the blend mode
-    if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
+    if (!m_cache->enable || (states.blendMode != m_cache->lastBlendMode))
         applyBlendMode(states.blendMode);
 
     // Apply the stencil mode
-    if (!m_cache.enable || (states.stencilMode != m_cache.lastStencilMode))
+    if (!m_cache->enable || (states.stencilMode != m_cache->lastStencilMode))
         applyStencilMode(states.stencilMode);
 
     // Mask the color buffer off if necessary
     if (states.stencilMode.stencilOnly)
-        glCheck(glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE));
+        m_cache->glState.setColorMask(false);
 
     // Apply the texture
-    if (!m_cache.enable || (states.texture && states.texture->m_fboAttachment))
+    if (!m_cache->enable || (states.texture && states.texture->m_fboAttachment))
     {
         // If the texture is an FBO attachment, always rebind it
         // in order to inform the OpenGL driver that we want changes
@@ -876,7 +1445,7 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     else
     {
         const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
-        if (textureId != m_cache.lastTextureId || states.coordinateType != m_cache.lastCoordinateType)
+        if (textureId != m_cache->lastTextureId || states.coordinateType != m_cache->lastCoordinateType)
             applyTexture(states.texture, states.coordinateType);
     }
 
@@ -886,19 +1455,190 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCulled(const Drawable& drawable, const RenderStates& states)
+{
+    const std::optional<FloatRect> cullingBounds = drawable.getCullingBounds();
+
+    // Drawable that doesn't support culling?
+    if (!cullingBounds)
+        return false;
+
+    // The visible area only changes with the view
+    if (m_cullingViewId != m_viewId)
+    {
+        m_visibleArea   = RenderTargetImpl::computeVisibleArea(m_view);
+        m_cullingViewId = m_viewId;
+    }
+
+    if (!m_visibleArea)
+        return true;
+
+    // Edges are inclusive, so that flat bounds (e.g. of a horizontal line) touching the area aren't culled
+    const FloatRect bounds = states.transform.transformRect(*cullingBounds);
+    const Vector2f  min    = m_visibleArea->position;
+    const Vector2f  max    = m_visibleArea->position + m_visibleArea->size;
+
+    return (bounds.position.x > max.x) || (bounds.position.x + bounds.size.x < min.x) || (bounds.position.y > max.y) ||
+           (bounds.position.y + bounds.size.y < min.y);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setupClientVertices(const Vertex* vertices, std::size_t vertexCount, const RenderStates& states)
+{
+    // Check if the vertex count is low enough so that we can pre-transform them
+    const bool useVertexCache = (vertexCount <= m_cache->vertexCache.size());
+
+    if (useVertexCache)
+    {
+        // Pre-transform the vertices and store them into the vertex cache
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            Vertex& vertex   = m_cache->vertexCache[i];
+            vertex.position  = states.transform * vertices[i].position;
+            vertex.color     = vertices[i].color;
+            vertex.texCoords = vertices[i].texCoords;
+        }
+    }
+
+    setupDraw(useVertexCache, states);
+
+    // Colors may have been disabled by a vertex layout without them
+    m_cache->glState.setClientStateEnabled(GL_COLOR_ARRAY, true);
+
+    // Check if texture coordinates array is needed, and update client state accordingly
+    const bool enableTexCoordsArray = (states.texture || states.shader);
+    m_cache->glState.setClientStateEnabled(GL_TEXTURE_COORD_ARRAY, enableTexCoordsArray);
+
+    // If we switch between non-cache and cache mode or enable texture
+    // coordinates we need to set up the pointers to the vertices' components
+    if (!m_cache->enable || !useVertexCache || !m_cache->useVertexCache)
+    {
+        const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+        // If we pre-transform the vertices, we must use our internal vertex cache
+        if (useVertexCache)
+            data = reinterpret_cast<const std::byte*>(m_cache->vertexCache.data());
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+        if (enableTexCoordsArray)
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+    }
+    else if (enableTexCoordsArray && !m_cache->texCoordsArrayEnabled)
+    {
+        // If we enter this block, we are already using our internal vertex cache
+        const auto* data = reinterpret_cast<const std::byte*>(m_cache->vertexCache.data());
+
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+    }
+
+    // Update the cache
+    m_cache->useVertexCache        = useVertexCache;
+    m_cache->texCoordsArrayEnabled = enableTexCoordsArray;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::applyVertexLayout(const VertexLayout& layout, const std::byte* data, bool useTexCoords)
+{
+    const auto stride = static_cast<GLsizei>(layout.stride);
+
+    glCheck(glVertexPointer(2,
+                            RenderTargetImpl::formatToGlConstant(layout.positionFormat),
+                            stride,
+                            data + layout.positionOffset));
+
+    // Without a color attribute, all the vertices share the layout's color
+    m_cache->glState.setClientStateEnabled(GL_COLOR_ARRAY, layout.colorOffset.has_value());
+    if (layout.colorOffset)
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, stride, data + *layout.colorOffset));
+    else
+        glCheck(glColor4ub(layout.color.r, layout.color.g, layout.color.b, layout.color.a));
+
+    const bool enableTexCoordsArray = useTexCoords && layout.texCoordsOffset.has_value();
+    m_cache->glState.setClientStateEnabled(GL_TEXTURE_COORD_ARRAY, enableTexCoordsArray);
+    if (enableTexCoordsArray)
+    {
+        glCheck(glTexCoordPointer(2,
+                                  RenderTargetImpl::formatToGlConstant(layout.texCoordsFormat),
+                                  stride,
+                                  data + *layout.texCoordsOffset));
+    }
+
+    m_cache->texCoordsArrayEnabled = enableTexCoordsArray;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexed(const Vertex*       vertices,
+                               std::size_t         vertexCount,
+                               const void*         indices,
+                               std::size_t         indexSize,
+                               std::size_t         indexCount,
+                               PrimitiveType       type,
+                               const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    if (priv::SoftwareRasterizer* rasterizer = getSoftwareRasterizer())
+    {
+        rasterizer->drawIndexed(*this,
+                                vertices,
+                                vertexCount,
+                                indices,
+                                indexSize,
+                                indexCount,
+                                type,
+                                states,
+                                states.texture ? states.texture->m_cacheId : 0);
+        return;
+    }
+
+    if (ensureActive())
+    {
+        setupClientVertices(vertices, vertexCount, states);
+
+        // Client-side indices are only read if no index buffer is bound
+        IndexBuffer::bind(nullptr);
+
+        drawIndexedPrimitives(type, indices, indexSize, indexCount);
+        cleanupDraw(states);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr priv::EnumArray<PrimitiveType, GLenum, 6> modes =
-        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[type];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type,
+                                         const void*   indices,
+                                         std::size_t   indexSize,
+                                         std::size_t   indexCount)
+{
+    // Find the OpenGL primitive type
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
+
+    // Find the OpenGL index type
+    const GLenum indexType = (indexSize == sizeof(std::uint32_t)) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
+    // Draw the primitives
+    glCheck(glDrawElements(mode, static_cast<GLsizei>(indexCount), indexType, indices));
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
@@ -913,10 +1653,10 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 
     // Mask the color buffer back on if necessary
     if (states.stencilMode.stencilOnly)
-        glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+        m_cache->glState.setColorMask(true);
 
     // Re-enable the cache at the end of the draw if it was disabled
-    m_cache.enable = true;
+    m_cache->enable = true;
 }
 
 } // namespace sf
@@ -926,9 +1666,10 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 // Render states caching strategies
 //
 // * View
-//   If SetView was called since last draw, the projection
-//   matrix is updated. We don't need more, the view doesn't
-//   change frequently.
+//   If SetView was called since last draw, or if the view of
+//   another render target was applied in the meantime, the
+//   projection matrix is updated. We don't need more, the view
+//   doesn't change frequently.
 //
 // * Transform
 //   The transform matrix is usually expensive because each
@@ -953,8 +1694,25 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 // * Shader
 //   Shaders are very hard to optimize, because they have
 //   parameters that can be hard (if not impossible) to track,
-//   like matrices or textures. The only optimization that we
-//   do is that we avoid setting a null shader if there was
-//   already none for the previous draw.
+//   like matrices or textures. We avoid setting a null shader
+//   if there was already none for the previous draw, and the
+//   textures of a shader are only bound again if they changed.
+//
+// * Raw OpenGL states
+//   Every capability, client array, texture unit, program and
+//   vertex buffer binding goes through a shadow of the context
+//   states, which skips the calls that wouldn't change anything.
+//   The shadow is only trusted between resetGLStates() and the
+//   next deactivation or popGLStates(), since the user may call
+//   OpenGL directly at any other time.
+//
+// * Context switches
+//   The cache belongs to the OpenGL context rather than to the
+//   render target, since that's where the states live. When
+//   another render target is activated in the same context,
+//   only the view and the sRGB encoding are applied again.
+//   The cache of the current context is found through a
+//   thread-local record, so that checking whether a render
+//   target is active doesn't need any lock.
 //
 ////////////////////////////////////////////////////////////
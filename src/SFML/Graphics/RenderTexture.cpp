@@ -155,11 +155,18 @@ bool RenderTexture::generateMipmap()
 ////////////////////////////////////////////////////////////
 bool RenderTexture::setActive(bool active)
 {
-    // Update RenderTarget tracking
-    if (m_impl && m_impl->activate(active))
-        return RenderTarget::setActive(active);
+    if (!m_impl)
+        return false;
+
+    // Update RenderTarget tracking while the context is still current
+    if (!active && !RenderTarget::setActive(false))
+        return false;
+
+    if (!m_impl->activate(active))
+        return false;
 
-    return false;
+    // Update RenderTarget tracking
+    return !active || RenderTarget::setActive(true);
 }
 
 
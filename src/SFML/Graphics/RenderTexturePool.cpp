@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderTexturePoolImpl
+{
+// Check whether two sets of settings result in interchangeable render-textures
+bool isCompatible(const sf::ContextSettings& left, const sf::ContextSettings& right)
+{
+    return (left.depthBits == right.depthBits) && (left.stencilBits == right.stencilBits) &&
+           (left.antiAliasingLevel == right.antiAliasingLevel) && (left.sRgbCapable == right.sRgbCapable);
+}
+
+// Estimate the video memory used by a render-texture
+std::size_t estimateMemoryUsage(const sf::RenderTexture& renderTexture, const sf::ContextSettings& settings)
+{
+    const sf::Vector2u size   = renderTexture.getTexture().getSize();
+    const std::size_t  pixels = std::size_t{size.x} * std::size_t{size.y};
+
+    // The target texture always uses 4 bytes per pixel
+    std::size_t memoryUsage = pixels * 4;
+
+    // Anti-aliasing adds a multisample color buffer, and multiplies the depth/stencil storage
+    const std::size_t samples = std::max(settings.antiAliasingLevel, 1u);
+    if (settings.antiAliasingLevel)
+        memoryUsage += pixels * 4 * samples;
+
+    // Depth and stencil buffers are packed (24/8 bits) when both are requested
+    if (settings.depthBits || settings.stencilBits)
+    {
+        const std::size_t bytesPerSample = settings.depthBits ? 4 : 1;
+        memoryUsage += pixels * bytesPerSample * samples;
+    }
+
+    return memoryUsage;
+}
+} // namespace RenderTexturePoolImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool(RenderTexturePool&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool& RenderTexturePool::operator=(RenderTexturePool&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(Vector2u size, const ContextSettings& settings)
+{
+    // Look for an idle render-texture that we can hand out again
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry)
+                                 {
+                                     return !entry.acquired && (entry.size == size) &&
+                                            RenderTexturePoolImpl::isCompatible(entry.settings, settings);
+                                 });
+
+    if (it != m_entries.end())
+    {
+        RenderTexture& renderTexture = *it->renderTexture;
+
+        // Undo whatever the previous user changed
+        renderTexture.setView(renderTexture.getDefaultView());
+        renderTexture.setSmooth(false);
+        renderTexture.setRepeated(false);
+
+        it->acquired = true;
+        return &renderTexture;
+    }
+
+    // None available, create a new one
+    auto renderTexture = std::make_unique<RenderTexture>();
+    if (!renderTexture->resize(size, settings))
+    {
+        err() << "Failed to acquire render texture from pool" << std::endl;
+        return nullptr;
+    }
+
+    Entry& entry        = m_entries.emplace_back();
+    entry.memoryUsage   = RenderTexturePoolImpl::estimateMemoryUsage(*renderTexture, settings);
+    entry.renderTexture = std::move(renderTexture);
+    entry.size          = size;
+    entry.settings      = settings;
+    entry.acquired      = true;
+
+    return entry.renderTexture.get();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(const RenderTexture& renderTexture)
+{
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry) { return entry.renderTexture.get() == &renderTexture; });
+
+    if ((it != m_entries.end()) && it->acquired)
+    {
+        it->acquired    = false;
+        it->releaseTime = m_clock.getElapsedTime();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::releaseAll()
+{
+    const Time now = m_clock.getElapsedTime();
+
+    for (Entry& entry : m_entries)
+    {
+        if (entry.acquired)
+        {
+            entry.acquired    = false;
+            entry.releaseTime = now;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::trim(Time maxIdleTime)
+{
+    const Time        now   = m_clock.getElapsedTime();
+    const std::size_t count = m_entries.size();
+
+    m_entries.erase(std::remove_if(m_entries.begin(),
+                                   m_entries.end(),
+                                   [&](const Entry& entry)
+                                   { return !entry.acquired && (now - entry.releaseTime >= maxIdleTime); }),
+                    m_entries.end());
+
+    return count - m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getActiveCount() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return entry.acquired; }));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getIdleCount() const
+{
+    return m_entries.size() - getActiveCount();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getMemoryUsage() const
+{
+    std::size_t memoryUsage = 0;
+
+    for (const Entry& entry : m_entries)
+        memoryUsage += entry.memoryUsage;
+
+    return memoryUsage;
+}
+
+} // namespace sf
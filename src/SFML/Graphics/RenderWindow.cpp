@@ -84,11 +84,15 @@ bool RenderWindow::isSrgb() const
 ////////////////////////////////////////////////////////////
 bool RenderWindow::setActive(bool active)
 {
+    // Update RenderTarget tracking while the context is still current
+    if (!active && !RenderTarget::setActive(false))
+        return false;
+
     bool result = Window::setActive(active);
 
     // Update RenderTarget tracking
-    if (result)
-        result = RenderTarget::setActive(active);
+    if (result && active)
+        result = RenderTarget::setActive(true);
 
     // If FBOs are available, make sure none are bound when we
     // try to draw to the default framebuffer of the RenderWindow
@@ -29,24 +29,44 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/StatesCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
+#include <SFML/Window/Context.hpp>
 #include <SFML/Window/GlResource.hpp>
 
 #include <SFML/System/Err.hpp>
+#include <SFML/System/ErrCapture.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/PackFile.hpp>
 #include <SFML/System/Utils.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <cassert>
 #include <cstdint>
 
 #ifndef SFML_OPENGL_ES
@@ -65,6 +85,19 @@
 
 namespace
 {
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderImpl
+{
+// Thread-safe unique identifier generator,
+// is used for states cache (see RenderTarget)
+std::uint64_t getUniqueId() noexcept
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no program"
+
+    return id.fetch_add(1);
+}
+} // namespace ShaderImpl
+
 // Retrieve the maximum number of texture units available
 std::size_t getMaxTextureUnits()
 {
@@ -79,26 +112,6 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
-// Read the contents of a file into an array of char
-bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
-{
-    if (auto file = std::ifstream(filename, std::ios_base::binary))
-    {
-        file.seekg(0, std::ios_base::end);
-        const std::ifstream::pos_type size = file.tellg();
-        if (size > 0)
-        {
-            file.seekg(0, std::ios_base::beg);
-            buffer.resize(static_cast<std::size_t>(size));
-            file.read(buffer.data(), static_cast<std::streamsize>(size));
-        }
-        buffer.push_back('\0');
-        return true;
-    }
-
-    return false;
-}
-
 // Read the contents of a stream into an array of char
 bool getStreamContents(sf::InputStream& stream, std::vector<char>& buffer)
 {
@@ -121,6 +134,30 @@ bool getStreamContents(sf::InputStream& stream, std::vector<char>& buffer)
     return success;
 }
 
+// Read the contents of a file into an array of char
+bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
+{
+    // Entries of mounted pack files take precedence over the file system
+    if (const std::unique_ptr<sf::InputStream> stream = sf::PackFile::openMountedStream(filename))
+        return getStreamContents(*stream, buffer);
+
+    if (auto file = std::ifstream(filename, std::ios_base::binary))
+    {
+        file.seekg(0, std::ios_base::end);
+        const std::ifstream::pos_type size = file.tellg();
+        if (size > 0)
+        {
+            file.seekg(0, std::ios_base::beg);
+            buffer.resize(static_cast<std::size_t>(size));
+            file.read(buffer.data(), static_cast<std::streamsize>(size));
+        }
+        buffer.push_back('\0');
+        return true;
+    }
+
+    return false;
+}
+
 // Transforms an array of 2D vectors into a contiguous array of scalars
 std::vector<float> flatten(const sf::Vector2f* vectorArray, std::size_t length)
 {
@@ -168,242 +205,1006 @@ std::vector<float> flatten(const sf::Glsl::Vec4* vectorArray, std::size_t length
 
     return contiguous;
 }
-} // namespace
 
+// Number of components of each uniform type, indexed by sf::Shader::UniformType
+constexpr std::array<std::size_t, 10> uniformComponentCounts{1, 2, 3, 4, 1, 2, 3, 4, 9, 16};
 
-namespace sf
-{
-////////////////////////////////////////////////////////////
-struct Shader::UniformBinder
-{
-    ////////////////////////////////////////////////////////////
-    /// \brief Constructor: set up state before uniform is set
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder(Shader& shader, const std::string& name) : currentProgram(castToGlHandle(shader.m_shaderProgram))
-    {
-        if (currentProgram)
-        {
-            // Enable program object
-            savedProgram = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
-            if (currentProgram != savedProgram)
-                glCheck(GLEXT_glUseProgramObject(currentProgram));
+// Whether each uniform type is float-based, indexed by sf::Shader::UniformType
+constexpr std::array<bool, 10> uniformFloatTypes{true, true, true, true, false, false, false, false, true, true};
 
-            // Store uniform location for further use outside constructor
-            location = shader.getUniformLocation(name);
-        }
-    }
+// Program binary cache settings and statistics, shared by all shaders
+struct BinaryCache
+{
+    std::mutex                 mutex;
+    std::filesystem::path      directory;
+    std::atomic<std::uint64_t> hits{};
+    std::atomic<std::uint64_t> misses{};
+    std::atomic<std::uint64_t> rejected{};
+};
 
-    ////////////////////////////////////////////////////////////
-    /// \brief Destructor: restore state after uniform is set
-    ///
-    ////////////////////////////////////////////////////////////
-    ~UniformBinder()
-    {
-        // Disable program object
-        if (currentProgram && (currentProgram != savedProgram))
-            glCheck(GLEXT_glUseProgramObject(savedProgram));
-    }
+BinaryCache& getBinaryCache()
+{
+    static BinaryCache cache;
+    return cache;
+}
 
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy constructor
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder(const UniformBinder&) = delete;
+// Header of the files stored in the program binary cache
+struct BinaryCacheHeader
+{
+    std::array<char, 8> magic{};
+    std::uint32_t       version{};
+    std::uint32_t       format{};
+    std::uint64_t       key{};
+};
 
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy assignment
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder& operator=(const UniformBinder&) = delete;
+constexpr std::array<char, 8> binaryCacheMagic{'S', 'F', 'M', 'L', 'P', 'R', 'O', 'G'};
+constexpr std::uint32_t       binaryCacheVersion = 1;
 
-    TransientContextLock lock;           //!< Lock to keep context active while uniform is bound
-    GLEXT_GLhandle       savedProgram{}; //!< Handle to the previously active program object
-    GLEXT_GLhandle       currentProgram; //!< Handle to the program object of the modified sf::Shader instance
-    GLint                location{-1};   //!< Uniform location, used by the surrounding sf::Shader code
+// Location of a program in the binary cache
+struct BinaryCacheEntry
+{
+    std::filesystem::path path;
+    std::uint64_t         key{};
 };
 
+// Outcome of an attempt to load a program from the binary cache
+enum class BinaryCacheResult
+{
+    Missing,
+    Accepted,
+    Rejected
+};
 
-////////////////////////////////////////////////////////////
-Shader::Shader(const std::filesystem::path& filename, Type type)
+// Add bytes to a 64-bit FNV-1a hash
+void hashBytes(std::uint64_t& hash, const void* data, std::size_t size)
 {
-    if (!loadFromFile(filename, type))
-        throw sf::Exception("Failed to load shader from file");
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
 }
 
-
-////////////////////////////////////////////////////////////
-Shader::Shader(const std::filesystem::path& vertexShaderFilename, const std::filesystem::path& fragmentShaderFilename)
+// Extract the major version number at the start of a GL_VERSION string, 0 if there is none
+int parseGlMajorVersion(std::string_view version)
 {
-    if (!loadFromFile(vertexShaderFilename, fragmentShaderFilename))
-        throw sf::Exception("Failed to load shader from files");
+    int major = 0;
+    std::from_chars(version.data(), version.data() + version.size(), major);
+    return major;
 }
 
-
-////////////////////////////////////////////////////////////
-Shader::Shader(const std::filesystem::path& vertexShaderFilename,
-               const std::filesystem::path& geometryShaderFilename,
-               const std::filesystem::path& fragmentShaderFilename)
+// Find the cache entry of a program, identified by its sources and by the driver and context that compile it
+std::optional<BinaryCacheEntry> getBinaryCacheEntry(std::string_view vertexShaderCode,
+                                                    std::string_view geometryShaderCode,
+                                                    std::string_view fragmentShaderCode)
 {
-    if (!loadFromFile(vertexShaderFilename, geometryShaderFilename, fragmentShaderFilename))
-        throw sf::Exception("Failed to load shader from files");
-}
+    if (!sf::Shader::isBinaryCacheAvailable())
+        return std::nullopt;
 
+    const std::filesystem::path directory = sf::Shader::getBinaryCacheDirectory();
+    if (directory.empty())
+        return std::nullopt;
 
-////////////////////////////////////////////////////////////
-Shader::Shader(std::string_view shader, Type type)
-{
-    if (!loadFromMemory(shader, type))
-        throw sf::Exception("Failed to load shader from memory");
-}
+    std::uint64_t hash       = 14695981039346656037ull;
+    const auto    hashString = [&hash](std::string_view string)
+    {
+        const std::uint64_t length = string.size();
+        hashBytes(hash, &length, sizeof(length));
+        hashBytes(hash, string.data(), string.size());
+    };
 
+    hashString(vertexShaderCode);
+    hashString(geometryShaderCode);
+    hashString(fragmentShaderCode);
 
-////////////////////////////////////////////////////////////
-Shader::Shader(std::string_view vertexShader, std::string_view fragmentShader)
-{
-    if (!loadFromMemory(vertexShader, fragmentShader))
-        throw sf::Exception("Failed to load shader from memory");
-}
+    // GL_VERSION holds the version of the context, and often its profile
+    std::string_view                version;
+    constexpr std::array<GLenum, 4> driverStrings{GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION};
+    for (const GLenum name : driverStrings)
+    {
+        const GLubyte*         string = glCheck(glGetString(name));
+        const std::string_view value  = string ? reinterpret_cast<const char*>(string) : "";
+        hashString(value);
 
+        if (name == GL_VERSION)
+            version = value;
+    }
 
-////////////////////////////////////////////////////////////
-Shader::Shader(std::string_view vertexShader, std::string_view geometryShader, std::string_view fragmentShader)
-{
-    if (!loadFromMemory(vertexShader, geometryShader, fragmentShader))
-        throw sf::Exception("Failed to load shader from memory");
-}
+    // The profile and flags are queried from OpenGL, as sf::Context::getActiveContext() doesn't see window
+    // contexts: synchronous loads and loads on the compiler thread's context then compute the same key.
+    // Context flags were introduced in OpenGL 3.0 and profiles in 3.2, older contexts reject the queries
+    std::array<GLint, 2> contextValues{};
+    const int            majorVersion = parseGlMajorVersion(version);
+    if (majorVersion >= 3)
+    {
+        glCheck(glGetIntegerv(GL_CONTEXT_FLAGS, &contextValues[0]));
 
+        GLint minorVersion = 0;
+        glCheck(glGetIntegerv(GL_MINOR_VERSION, &minorVersion));
+        if ((majorVersion > 3) || (minorVersion >= 2))
+            glCheck(glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &contextValues[1]));
+    }
 
-////////////////////////////////////////////////////////////
-Shader::Shader(InputStream& stream, Type type)
-{
-    if (!loadFromStream(stream, type))
-        throw sf::Exception("Failed to load shader from stream");
-}
+    hashBytes(hash, contextValues.data(), sizeof(contextValues));
 
+    std::ostringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
 
-////////////////////////////////////////////////////////////
-Shader::Shader(InputStream& vertexShaderStream, InputStream& fragmentShaderStream)
-{
-    if (!loadFromStream(vertexShaderStream, fragmentShaderStream))
-        throw sf::Exception("Failed to load shader from streams");
+    return BinaryCacheEntry{directory / filename.str(), hash};
 }
 
-
-////////////////////////////////////////////////////////////
-Shader::Shader(InputStream& vertexShaderStream, InputStream& geometryShaderStream, InputStream& fragmentShaderStream)
+// Load a program binary from the cache
+BinaryCacheResult loadProgramBinary(GLuint program, const BinaryCacheEntry& entry)
 {
-    if (!loadFromStream(vertexShaderStream, geometryShaderStream, fragmentShaderStream))
-        throw sf::Exception("Failed to load shader from streams");
-}
+    std::ifstream file(entry.path, std::ios_base::binary);
+    if (!file)
+        return BinaryCacheResult::Missing;
 
+    // Entries written by another version of SFML, or whose key collides, are simply overwritten
+    BinaryCacheHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || (header.magic != binaryCacheMagic) ||
+        (header.version != binaryCacheVersion) || (header.key != entry.key))
+        return BinaryCacheResult::Missing;
 
-////////////////////////////////////////////////////////////
-Shader::~Shader()
-{
-    const TransientContextLock lock;
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (binary.empty())
+        return BinaryCacheResult::Missing;
 
-    // Destroy effect program
-    if (m_shaderProgram)
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
-}
+    // Passing a format that the driver doesn't support is an error, check it first
+    GLint formatCount = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+    std::vector<GLint> formats(static_cast<std::size_t>(std::max(formatCount, 0)));
+    if (!formats.empty())
+        glCheck(glGetIntegerv(GLEXT_GL_PROGRAM_BINARY_FORMATS, formats.data()));
 
-////////////////////////////////////////////////////////////
-Shader::Shader(Shader&& source) noexcept :
-m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
-m_currentTexture(std::exchange(source.m_currentTexture, -1)),
-m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
-{
+    if (std::find(formats.begin(), formats.end(), static_cast<GLint>(header.format)) == formats.end())
+        return BinaryCacheResult::Rejected;
+
+    // The driver is free to refuse a binary, for example after an update
+    glCheck(GLEXT_glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size())));
+
+    GLint success = 0;
+    glCheck(GLEXT_glGetProgramiv(program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    return (success == GL_FALSE) ? BinaryCacheResult::Rejected : BinaryCacheResult::Accepted;
 }
 
-////////////////////////////////////////////////////////////
-Shader& Shader::operator=(Shader&& right) noexcept
+// Store the binary of a linked program in the cache
+void saveProgramBinary(GLuint program, const BinaryCacheEntry& entry, std::ostream& log)
 {
-    // Make sure we aren't moving ourselves.
-    if (&right == this)
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(program, GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            format = 0;
+    glCheck(GLEXT_glGetProgramBinary(program, length, nullptr, &format, binary.data()));
+
+    std::error_code error;
+    std::filesystem::create_directories(entry.path.parent_path(), error);
+    if (error)
     {
-        return *this;
+        log << "Failed to create the shader binary cache directory: " << error.message() << '\n'
+            << sf::formatDebugPathInfo(entry.path.parent_path()) << std::endl;
+        return;
     }
 
-    if (m_shaderProgram)
+    // Write to a temporary file first, so that other processes never read a partial entry.
+    // Its name is random, so that processes storing the same entry at the same time don't write to the same file.
+    thread_local std::mt19937_64 random(std::random_device{}());
+    std::ostringstream           suffix;
+    suffix << '.' << std::hex << random() << ".tmp";
+
+    std::filesystem::path temporaryPath = entry.path;
+    temporaryPath += suffix.str();
+
+    BinaryCacheHeader header;
+    header.magic   = binaryCacheMagic;
+    header.version = binaryCacheVersion;
+    header.format  = format;
+    header.key     = entry.key;
+
     {
-        // Destroy effect program
-        const TransientContextLock lock;
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+        std::ofstream file(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+
+        if (!file)
+        {
+            log << "Failed to write the shader binary cache entry\n"
+                << sf::formatDebugPathInfo(temporaryPath) << std::endl;
+            file.close();
+            std::filesystem::remove(temporaryPath, error);
+            return;
+        }
     }
 
-    // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0u);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
-    return *this;
+    std::filesystem::rename(temporaryPath, entry.path, error);
+    if (error)
+    {
+        log << "Failed to store the shader binary cache entry: " << error.message() << '\n'
+            << sf::formatDebugPathInfo(entry.path) << std::endl;
+        std::filesystem::remove(temporaryPath, error);
+    }
 }
 
-////////////////////////////////////////////////////////////
-bool Shader::loadFromFile(const std::filesystem::path& filename, Type type)
+// Make sure that the system supports the requested kinds of shaders
+bool checkShaderSupport(bool geometry)
 {
-    // Read the file
-    std::vector<char> shader;
-    if (!getFileContents(filename, shader))
+    if (!sf::Shader::isAvailable())
     {
-        err() << "Failed to open shader file\n" << formatDebugPathInfo(filename) << std::endl;
+        sf::err() << "Failed to create a shader: your system doesn't support shaders "
+                  << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
         return false;
     }
 
-    // Compile the shader program
-    if (type == Type::Vertex)
-        return compile(shader.data(), {}, {});
+    if (geometry && !sf::Shader::isGeometryAvailable())
+    {
+        sf::err() << "Failed to create a shader: your system doesn't support geometry shaders "
+                  << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)"
+                  << std::endl;
+        return false;
+    }
 
-    if (type == Type::Geometry)
-        return compile({}, shader.data(), {});
+    return true;
+}
 
-    return compile({}, {}, shader.data());
+// Tell whether the driver can compile and link programs in the background
+bool isParallelCompileAvailable()
+{
+    static const bool available = (sf::Context::isExtensionAvailable("GL_KHR_parallel_shader_compile") ||
+                                   sf::Context::isExtensionAvailable("GL_ARB_parallel_shader_compile")) &&
+                                  GLEXT_glGetProgramiv;
+
+    return available;
 }
 
+// Program submitted to the driver, whose link status hasn't been checked yet
+struct ProgramLink
+{
+    GLEXT_GLhandle                  program{};   // Program object
+    std::array<GLEXT_GLhandle, 3>   shaders{};   // Vertex, geometry and fragment shader objects, if any
+    std::optional<BinaryCacheEntry> cacheEntry;  // Where to store the program once linked
+    bool                            fromCache{}; // Was the program loaded from the binary cache?
+};
 
-////////////////////////////////////////////////////////////
-bool Shader::loadFromFile(const std::filesystem::path& vertexShaderFilename,
-                          const std::filesystem::path& fragmentShaderFilename)
+constexpr std::array<const char*, 3> shaderTypeNames{"vertex", "geometry", "fragment"};
+
+// Submit the shaders of a program to the driver, without waiting for the result
+ProgramLink submitProgram(std::string_view vertexShaderCode,
+                          std::string_view geometryShaderCode,
+                          std::string_view fragmentShaderCode)
 {
-    // Read the vertex shader file
-    std::vector<char> vertexShader;
-    if (!getFileContents(vertexShaderFilename, vertexShader))
+    ProgramLink link;
+    link.program = glCheck(GLEXT_glCreateProgramObject());
+
+    // Try to load the program from the binary cache first
+    BinaryCache& binaryCache = getBinaryCache();
+    link.cacheEntry          = getBinaryCacheEntry(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    if (link.cacheEntry)
     {
-        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
-        return false;
+        switch (loadProgramBinary(castFromGlHandle(link.program), *link.cacheEntry))
+        {
+            case BinaryCacheResult::Accepted:
+                ++binaryCache.hits;
+                link.fromCache = true;
+                return link;
+
+            case BinaryCacheResult::Rejected:
+                // Start over with a fresh program, the rejected binary is replaced once linked
+                ++binaryCache.rejected;
+                glCheck(GLEXT_glDeleteObject(link.program));
+                link.program = glCheck(GLEXT_glCreateProgramObject());
+                break;
+
+            case BinaryCacheResult::Missing:
+                break;
+        }
+
+        // Ask the driver to keep the binary around, so that it can be stored once linked
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(link.program),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
     }
 
-    // Read the fragment shader file
-    std::vector<char> fragmentShader;
-    if (!getFileContents(fragmentShaderFilename, fragmentShader))
+    const std::array<std::pair<GLenum, std::string_view>, 3> sources{
+        {{GLEXT_GL_VERTEX_SHADER, vertexShaderCode},
+         {GLEXT_GL_GEOMETRY_SHADER, geometryShaderCode},
+         {GLEXT_GL_FRAGMENT_SHADER, fragmentShaderCode}}};
+
+    for (std::size_t i = 0; i < sources.size(); ++i)
     {
-        err() << "Failed to open fragment shader file\n" << formatDebugPathInfo(fragmentShaderFilename) << std::endl;
-        return false;
+        const auto [shaderType, shaderCode] = sources[i];
+        if (shaderCode.empty())
+            continue;
+
+        // Create and compile the shader, its status is checked once the program is linked
+        const GLEXT_GLhandle shader           = glCheck(GLEXT_glCreateShaderObject(shaderType));
+        const GLcharARB*     sourceCode       = shaderCode.data();
+        const auto           sourceCodeLength = static_cast<GLint>(shaderCode.length());
+        glCheck(GLEXT_glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
+        glCheck(GLEXT_glCompileShader(shader));
+        glCheck(GLEXT_glAttachObject(link.program, shader));
+        link.shaders[i] = shader;
     }
 
-    // Compile the shader program
-    return compile(vertexShader.data(), {}, fragmentShader.data());
+    // Link the program
+    glCheck(GLEXT_glLinkProgram(link.program));
+
+    return link;
 }
 
+// Tell whether the driver has finished linking a submitted program
+bool isProgramLinked(const ProgramLink& link)
+{
+    if (link.fromCache || !isParallelCompileAvailable())
+        return true;
+
+    GLint completed = GL_FALSE;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(link.program), GLEXT_GL_COMPLETION_STATUS, &completed));
+    return completed != GL_FALSE;
+}
 
-////////////////////////////////////////////////////////////
-bool Shader::loadFromFile(const std::filesystem::path& vertexShaderFilename,
-                          const std::filesystem::path& geometryShaderFilename,
-                          const std::filesystem::path& fragmentShaderFilename)
+// Release the objects of a submitted program
+void cancelProgram(ProgramLink& link)
 {
-    // Read the vertex shader file
-    std::vector<char> vertexShader;
-    if (!getFileContents(vertexShaderFilename, vertexShader))
+    for (GLEXT_GLhandle& shader : link.shaders)
     {
-        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
-        return false;
+        if (shader)
+            glCheck(GLEXT_glDeleteObject(shader));
+        shader = {};
     }
 
-    // Read the geometry shader file
-    std::vector<char> geometryShader;
-    if (!getFileContents(geometryShaderFilename, geometryShader))
+    glCheck(GLEXT_glDeleteObject(link.program));
+    link.program = {};
+}
+
+// Check the result of a submitted program, waiting for it if necessary
+// Returns the linked program, or 0 if it failed (the errors are written to the log)
+unsigned int finishProgram(ProgramLink& link, std::ostream& log)
+{
+    // Check the compile logs
+    bool compiled = true;
+    for (std::size_t i = 0; i < link.shaders.size(); ++i)
+    {
+        const GLEXT_GLhandle shader = link.shaders[i];
+        if (!shader)
+            continue;
+
+        GLint success = 0;
+        glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            std::array<char, 1024> infoLog{};
+            glCheck(GLEXT_glGetInfoLog(shader, static_cast<GLsizei>(infoLog.size()), nullptr, infoLog.data()));
+            log << "Failed to compile " << shaderTypeNames[i] << " shader:" << '\n' << infoLog.data() << std::endl;
+            compiled = false;
+        }
+    }
+
+    if (!compiled)
+    {
+        cancelProgram(link);
+        return 0;
+    }
+
+    // The shaders are not needed anymore, they are destroyed along with the program
+    for (GLEXT_GLhandle& shader : link.shaders)
+    {
+        if (shader)
+            glCheck(GLEXT_glDeleteObject(shader));
+        shader = {};
+    }
+
+    if (!link.fromCache)
+    {
+        // Check the link log
+        GLint success = 0;
+        glCheck(GLEXT_glGetObjectParameteriv(link.program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            std::array<char, 1024> infoLog{};
+            glCheck(GLEXT_glGetInfoLog(link.program, static_cast<GLsizei>(infoLog.size()), nullptr, infoLog.data()));
+            log << "Failed to link shader:" << '\n' << infoLog.data() << std::endl;
+            cancelProgram(link);
+            return 0;
+        }
+
+        // Store the linked program in the binary cache
+        if (link.cacheEntry)
+        {
+            ++getBinaryCache().misses;
+            saveProgramBinary(castFromGlHandle(link.program), *link.cacheEntry, log);
+        }
+    }
+
+    return castFromGlHandle(std::exchange(link.program, GLEXT_GLhandle{}));
+}
+
+// Program compiled by the compiler thread
+struct CompileJob
+{
+    enum class State
+    {
+        Pending,  // Waiting to be compiled, or being compiled
+        Done,     // Compiled, the result is available
+        Abandoned // Not needed anymore, the compiler thread destroys the result
+    };
+
+    std::string        vertexShaderCode;
+    std::string        geometryShaderCode;
+    std::string        fragmentShaderCode;
+    std::atomic<State> state{State::Pending};
+    unsigned int       program{}; // Linked program, 0 on failure; written before the state becomes Done
+    std::string        log;       // Errors to report; written before the state becomes Done
+};
+
+// Thread compiling the programs of all the shaders when the driver can't do it in the background,
+// with an OpenGL context of its own, shared with all the others
+class ProgramCompiler
+{
+public:
+    static ProgramCompiler& getInstance()
+    {
+        static ProgramCompiler compiler;
+        return compiler;
+    }
+
+    ~ProgramCompiler()
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+
+        m_condition.notify_one();
+        m_thread.join();
+    }
+
+    ProgramCompiler(const ProgramCompiler&) = delete;
+
+    ProgramCompiler& operator=(const ProgramCompiler&) = delete;
+
+    void submit(std::shared_ptr<CompileJob> job)
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_jobs.push_back(std::move(job));
+        }
+
+        m_condition.notify_one();
+    }
+
+private:
+    ProgramCompiler() : m_thread(&ProgramCompiler::run, this)
+    {
+    }
+
+    void run()
+    {
+        const sf::Context context;
+
+        for (;;)
+        {
+            std::shared_ptr<CompileJob> job;
+
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                if (m_stop)
+                    return;
+
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            if (job->state.load(std::memory_order_acquire) != CompileJob::State::Abandoned)
+                compile(*job);
+        }
+    }
+
+    static void compile(CompileJob& job)
+    {
+        // Errors are reported by the thread that polls the shader, sf::err() is not thread-safe
+        sf::priv::ErrCapture capture;
+
+        ProgramLink link = submitProgram(job.vertexShaderCode, job.geometryShaderCode, job.fragmentShaderCode);
+        job.program      = finishProgram(link, sf::err());
+
+        // Make sure the program is complete before other contexts use it
+        glCheck(glFinish());
+
+        job.log = capture.take();
+
+        // Nobody will use the program if the shader gave up on it in the meantime
+        auto pending = CompileJob::State::Pending;
+        if (!job.state.compare_exchange_strong(pending, CompileJob::State::Done, std::memory_order_acq_rel) &&
+            job.program)
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(job.program)));
+    }
+
+    std::mutex                              m_mutex;
+    std::condition_variable                 m_condition;
+    std::deque<std::shared_ptr<CompileJob>> m_jobs;
+    bool                                    m_stop{};
+    std::thread                             m_thread; // Last, so that it starts once the other members are ready
+};
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Shader::UniformBinder
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor: set up state before uniform is set
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit UniformBinder(const Shader& shader) :
+    currentProgram(shader.m_shaderProgram),
+    currentProgramId(shader.m_cacheId)
+    {
+        if (currentProgram)
+        {
+            // Enable program object, querying the previous one only if it isn't known
+            glState = &priv::getActiveGLStateShadow();
+
+            if (const std::optional<std::uint64_t> programId = glState->getProgramId())
+            {
+                savedProgram   = glState->getProgram();
+                savedProgramId = *programId;
+                programChanged = (currentProgramId != savedProgramId);
+            }
+            else
+            {
+                // The shadow isn't trusted, the identifier of the saved program doesn't matter
+                savedProgram   = castFromGlHandle(glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT)));
+                programChanged = (currentProgram != savedProgram);
+            }
+
+            if (programChanged)
+                glState->useProgram(currentProgram, currentProgramId);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor: restore state after uniform is set
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBinder()
+    {
+        // Disable program object
+        if (programChanged)
+            glState->useProgram(savedProgram, savedProgramId);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBinder(const UniformBinder&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBinder& operator=(const UniformBinder&) = delete;
+
+    TransientContextLock lock;             //!< Lock to keep context active while uniform is bound
+    priv::GLStateShadow* glState{};        //!< OpenGL state shadow of the active context
+    unsigned int         savedProgram{};   //!< Handle to the previously active program object
+    std::uint64_t        savedProgramId{}; //!< Unique identifier of the previously active program object
+    bool                 programChanged{}; //!< Was the program object of the modified sf::Shader instance enabled?
+    unsigned int         currentProgram;   //!< Handle to the program object of the modified sf::Shader instance
+    std::uint64_t        currentProgramId; //!< Unique identifier of the program object of the modified sf::Shader instance
+};
+
+
+////////////////////////////////////////////////////////////
+struct Shader::PendingProgram
+{
+    std::optional<ProgramLink>  link; //!< Program being linked by the driver in the background
+    std::shared_ptr<CompileJob> job;  //!< Program being compiled by the compiler thread
+};
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader() = default;
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(const std::filesystem::path& filename, Type type)
+{
+    if (!loadFromFile(filename, type))
+        throw sf::Exception("Failed to load shader from file");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(const std::filesystem::path& vertexShaderFilename, const std::filesystem::path& fragmentShaderFilename)
+{
+    if (!loadFromFile(vertexShaderFilename, fragmentShaderFilename))
+        throw sf::Exception("Failed to load shader from files");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(const std::filesystem::path& vertexShaderFilename,
+               const std::filesystem::path& geometryShaderFilename,
+               const std::filesystem::path& fragmentShaderFilename)
+{
+    if (!loadFromFile(vertexShaderFilename, geometryShaderFilename, fragmentShaderFilename))
+        throw sf::Exception("Failed to load shader from files");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(std::string_view shader, Type type)
+{
+    if (!loadFromMemory(shader, type))
+        throw sf::Exception("Failed to load shader from memory");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(std::string_view vertexShader, std::string_view fragmentShader)
+{
+    if (!loadFromMemory(vertexShader, fragmentShader))
+        throw sf::Exception("Failed to load shader from memory");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(std::string_view vertexShader, std::string_view geometryShader, std::string_view fragmentShader)
+{
+    if (!loadFromMemory(vertexShader, geometryShader, fragmentShader))
+        throw sf::Exception("Failed to load shader from memory");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(InputStream& stream, Type type)
+{
+    if (!loadFromStream(stream, type))
+        throw sf::Exception("Failed to load shader from stream");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(InputStream& vertexShaderStream, InputStream& fragmentShaderStream)
+{
+    if (!loadFromStream(vertexShaderStream, fragmentShaderStream))
+        throw sf::Exception("Failed to load shader from streams");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader(InputStream& vertexShaderStream, InputStream& geometryShaderStream, InputStream& fragmentShaderStream)
+{
+    if (!loadFromStream(vertexShaderStream, geometryShaderStream, fragmentShaderStream))
+        throw sf::Exception("Failed to load shader from streams");
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::~Shader()
+{
+    // Discard the program being loaded asynchronously
+    cancelPendingProgram();
+
+    const TransientContextLock lock;
+
+    // Destroy effect program
+    if (m_shaderProgram)
+        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+}
+
+////////////////////////////////////////////////////////////
+Shader::Shader(Shader&& source) noexcept :
+m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
+m_cacheId(std::exchange(source.m_cacheId, 0)),
+m_currentTexture(std::exchange(source.m_currentTexture, -1)),
+m_textures(std::move(source.m_textures)),
+m_uniforms(std::move(source.m_uniforms)),
+m_attributes(std::move(source.m_attributes)),
+m_names(std::move(source.m_names)),
+m_uniformBlocks(std::move(source.m_uniformBlocks)),
+m_stagedUniforms(std::move(source.m_stagedUniforms)),
+m_stagedUniformsDirty(std::exchange(source.m_stagedUniformsDirty, false)),
+m_uniformUploadDeferred(source.m_uniformUploadDeferred),
+m_pendingProgram(std::move(source.m_pendingProgram))
+{
+}
+
+////////////////////////////////////////////////////////////
+Shader& Shader::operator=(Shader&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+    {
+        return *this;
+    }
+
+    // Discard the program being loaded asynchronously
+    cancelPendingProgram();
+
+    if (m_shaderProgram)
+    {
+        // Destroy effect program
+        const TransientContextLock lock;
+        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+    }
+
+    // Move the contents of right.
+    m_shaderProgram         = std::exchange(right.m_shaderProgram, 0u);
+    m_cacheId               = std::exchange(right.m_cacheId, 0);
+    m_currentTexture        = std::exchange(right.m_currentTexture, -1);
+    m_textures              = std::move(right.m_textures);
+    m_uniforms              = std::move(right.m_uniforms);
+    m_attributes            = std::move(right.m_attributes);
+    m_names                 = std::move(right.m_names);
+    m_uniformBlocks         = std::move(right.m_uniformBlocks);
+    m_stagedUniforms        = std::move(right.m_stagedUniforms);
+    m_stagedUniformsDirty   = std::exchange(right.m_stagedUniformsDirty, false);
+    m_uniformUploadDeferred = right.m_uniformUploadDeferred;
+    m_pendingProgram        = std::move(right.m_pendingProgram);
+    return *this;
+}
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFile(const std::filesystem::path& filename, Type type)
+{
+    // Read the file
+    std::vector<char> shader;
+    if (!getFileContents(filename, shader))
+    {
+        err() << "Failed to open shader file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Compile the shader program
+    if (type == Type::Vertex)
+        return compile(shader.data(), {}, {});
+
+    if (type == Type::Geometry)
+        return compile({}, shader.data(), {});
+
+    return compile({}, {}, shader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFile(const std::filesystem::path& vertexShaderFilename,
+                          const std::filesystem::path& fragmentShaderFilename)
+{
+    // Read the vertex shader file
+    std::vector<char> vertexShader;
+    if (!getFileContents(vertexShaderFilename, vertexShader))
+    {
+        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Read the fragment shader file
+    std::vector<char> fragmentShader;
+    if (!getFileContents(fragmentShaderFilename, fragmentShader))
+    {
+        err() << "Failed to open fragment shader file\n" << formatDebugPathInfo(fragmentShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Compile the shader program
+    return compile(vertexShader.data(), {}, fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFile(const std::filesystem::path& vertexShaderFilename,
+                          const std::filesystem::path& geometryShaderFilename,
+                          const std::filesystem::path& fragmentShaderFilename)
+{
+    // Read the vertex shader file
+    std::vector<char> vertexShader;
+    if (!getFileContents(vertexShaderFilename, vertexShader))
+    {
+        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Read the geometry shader file
+    std::vector<char> geometryShader;
+    if (!getFileContents(geometryShaderFilename, geometryShader))
+    {
+        err() << "Failed to open geometry shader file\n" << formatDebugPathInfo(geometryShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Read the fragment shader file
+    std::vector<char> fragmentShader;
+    if (!getFileContents(fragmentShaderFilename, fragmentShader))
+    {
+        err() << "Failed to open fragment shader file\n" << formatDebugPathInfo(fragmentShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Compile the shader program
+    return compile(vertexShader.data(), geometryShader.data(), fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromMemory(std::string_view shader, Type type)
+{
+    // Compile the shader program
+    if (type == Type::Vertex)
+        return compile(shader, {}, {});
+
+    if (type == Type::Geometry)
+        return compile({}, shader, {});
+
+    return compile({}, {}, shader);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromMemory(std::string_view vertexShader, std::string_view fragmentShader)
+{
+    // Compile the shader program
+    return compile(vertexShader, {}, fragmentShader);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromMemory(std::string_view vertexShader, std::string_view geometryShader, std::string_view fragmentShader)
+{
+    // Compile the shader program
+    return compile(vertexShader, geometryShader, fragmentShader);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromStream(InputStream& stream, Type type)
+{
+    // Read the shader code from the stream
+    std::vector<char> shader;
+    if (!getStreamContents(stream, shader))
+    {
+        err() << "Failed to read shader from stream" << std::endl;
+        return false;
+    }
+
+    // Compile the shader program
+    if (type == Type::Vertex)
+        return compile(shader.data(), {}, {});
+
+    if (type == Type::Geometry)
+        return compile({}, shader.data(), {});
+
+    return compile({}, {}, shader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& fragmentShaderStream)
+{
+    // Read the vertex shader code from the stream
+    std::vector<char> vertexShader;
+    if (!getStreamContents(vertexShaderStream, vertexShader))
+    {
+        err() << "Failed to read vertex shader from stream" << std::endl;
+        return false;
+    }
+
+    // Read the fragment shader code from the stream
+    std::vector<char> fragmentShader;
+    if (!getStreamContents(fragmentShaderStream, fragmentShader))
+    {
+        err() << "Failed to read fragment shader from stream" << std::endl;
+        return false;
+    }
+
+    // Compile the shader program
+    return compile(vertexShader.data(), {}, fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& geometryShaderStream, InputStream& fragmentShaderStream)
+{
+    // Read the vertex shader code from the stream
+    std::vector<char> vertexShader;
+    if (!getStreamContents(vertexShaderStream, vertexShader))
+    {
+        err() << "Failed to read vertex shader from stream" << std::endl;
+        return false;
+    }
+
+    // Read the geometry shader code from the stream
+    std::vector<char> geometryShader;
+    if (!getStreamContents(geometryShaderStream, geometryShader))
+    {
+        err() << "Failed to read geometry shader from stream" << std::endl;
+        return false;
+    }
+
+    // Read the fragment shader code from the stream
+    std::vector<char> fragmentShader;
+    if (!getStreamContents(fragmentShaderStream, fragmentShader))
+    {
+        err() << "Failed to read fragment shader from stream" << std::endl;
+        return false;
+    }
+
+    // Compile the shader program
+    return compile(vertexShader.data(), geometryShader.data(), fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFileAsync(const std::filesystem::path& filename, Type type)
+{
+    // Read the file
+    std::vector<char> shader;
+    if (!getFileContents(filename, shader))
+    {
+        err() << "Failed to open shader file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Start compiling the shader program
+    if (type == Type::Vertex)
+        return compileAsync(shader.data(), {}, {});
+
+    if (type == Type::Geometry)
+        return compileAsync({}, shader.data(), {});
+
+    return compileAsync({}, {}, shader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                                    const std::filesystem::path& fragmentShaderFilename)
+{
+    // Read the vertex shader file
+    std::vector<char> vertexShader;
+    if (!getFileContents(vertexShaderFilename, vertexShader))
+    {
+        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Read the fragment shader file
+    std::vector<char> fragmentShader;
+    if (!getFileContents(fragmentShaderFilename, fragmentShader))
+    {
+        err() << "Failed to open fragment shader file\n" << formatDebugPathInfo(fragmentShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Start compiling the shader program
+    return compileAsync(vertexShader.data(), {}, fragmentShader.data());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFileAsync(const std::filesystem::path& vertexShaderFilename,
+                               const std::filesystem::path& geometryShaderFilename,
+                               const std::filesystem::path& fragmentShaderFilename)
+{
+    // Read the vertex shader file
+    std::vector<char> vertexShader;
+    if (!getFileContents(vertexShaderFilename, vertexShader))
+    {
+        err() << "Failed to open vertex shader file\n" << formatDebugPathInfo(vertexShaderFilename) << std::endl;
+        return false;
+    }
+
+    // Read the geometry shader file
+    std::vector<char> geometryShader;
+    if (!getFileContents(geometryShaderFilename, geometryShader))
     {
         err() << "Failed to open geometry shader file\n" << formatDebugPathInfo(geometryShaderFilename) << std::endl;
         return false;
@@ -417,329 +1218,498 @@ bool Shader::loadFromFile(const std::filesystem::path& vertexShaderFilename,
         return false;
     }
 
-    // Compile the shader program
-    return compile(vertexShader.data(), geometryShader.data(), fragmentShader.data());
+    // Start compiling the shader program
+    return compileAsync(vertexShader.data(), geometryShader.data(), fragmentShader.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::loadFromMemory(std::string_view shader, Type type)
+bool Shader::loadFromMemoryAsync(std::string_view shader, Type type)
 {
-    // Compile the shader program
+    // Start compiling the shader program
     if (type == Type::Vertex)
-        return compile(shader, {}, {});
+        return compileAsync(std::string(shader), {}, {});
 
     if (type == Type::Geometry)
-        return compile({}, shader, {});
+        return compileAsync({}, std::string(shader), {});
 
-    return compile({}, {}, shader);
+    return compileAsync({}, {}, std::string(shader));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::loadFromMemory(std::string_view vertexShader, std::string_view fragmentShader)
+bool Shader::loadFromMemoryAsync(std::string_view vertexShader, std::string_view fragmentShader)
 {
-    // Compile the shader program
-    return compile(vertexShader, {}, fragmentShader);
+    // Start compiling the shader program
+    return compileAsync(std::string(vertexShader), {}, std::string(fragmentShader));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::loadFromMemory(std::string_view vertexShader, std::string_view geometryShader, std::string_view fragmentShader)
+bool Shader::loadFromMemoryAsync(std::string_view vertexShader,
+                                 std::string_view geometryShader,
+                                 std::string_view fragmentShader)
 {
-    // Compile the shader program
-    return compile(vertexShader, geometryShader, fragmentShader);
+    // Start compiling the shader program
+    return compileAsync(std::string(vertexShader), std::string(geometryShader), std::string(fragmentShader));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::loadFromStream(InputStream& stream, Type type)
+bool Shader::isReady()
 {
-    // Read the shader code from the stream
-    std::vector<char> shader;
-    if (!getStreamContents(stream, shader))
+    if (!m_pendingProgram)
+        return true;
+
+    const TransientContextLock lock;
+
+    unsigned int program = 0;
+
+    if (m_pendingProgram->link)
     {
-        err() << "Failed to read shader from stream" << std::endl;
-        return false;
+        // Ask the driver without blocking
+        if (!isProgramLinked(*m_pendingProgram->link))
+            return false;
+
+        program = finishProgram(*m_pendingProgram->link, err());
+    }
+    else
+    {
+        const CompileJob& job = *m_pendingProgram->job;
+        if (job.state.load(std::memory_order_acquire) != CompileJob::State::Done)
+            return false;
+
+        if (!job.log.empty())
+            err() << job.log << std::flush;
+
+        program = job.program;
     }
 
-    // Compile the shader program
-    if (type == Type::Vertex)
-        return compile(shader.data(), {}, {});
+    m_pendingProgram.reset();
 
-    if (type == Type::Geometry)
-        return compile({}, shader.data(), {});
+    if (program)
+        setProgram(program);
 
-    return compile({}, {}, shader.data());
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& fragmentShaderStream)
+Shader::UniformHandle::UniformHandle(int location) : m_location(location)
 {
-    // Read the vertex shader code from the stream
-    std::vector<char> vertexShader;
-    if (!getStreamContents(vertexShaderStream, vertexShader))
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::UniformHandle::isValid() const
+{
+    return m_location != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniform(std::string_view name)
+{
+    if (!m_shaderProgram)
+        return {};
+
+    // Check the cache first, so that no context is activated for known uniforms
+    if (const auto it = m_uniforms.find(name); it != m_uniforms.end())
+        return UniformHandle(it->second);
+
+    const TransientContextLock lock;
+    return UniformHandle(getUniformLocation(name));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, float x)
+{
+    setUniform(getUniform(name), x);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, Glsl::Vec2 v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Vec3& v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Vec4& v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, int x)
+{
+    setUniform(getUniform(name), x);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, Glsl::Ivec2 v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Ivec3& v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Ivec4& v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, bool x)
+{
+    setUniform(getUniform(name), x);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, Glsl::Bvec2 v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Bvec3& v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Bvec4& v)
+{
+    setUniform(getUniform(name), v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Mat3& matrix)
+{
+    setUniform(getUniform(name), matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Glsl::Mat4& matrix)
+{
+    setUniform(getUniform(name), matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, const Texture& texture)
+{
+    if (!setUniformTexture(getUniform(name), texture))
     {
-        err() << "Failed to read vertex shader from stream" << std::endl;
+        err() << "Impossible to use texture " << std::quoted(name)
+              << " for shader: all available texture units are used" << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(const std::string& name, CurrentTextureType)
+{
+    setUniform(getUniform(name), CurrentTexture);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const float* scalarArray, std::size_t length)
+{
+    setUniformArray(getUniform(name), scalarArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const Glsl::Vec2* vectorArray, std::size_t length)
+{
+    setUniformArray(getUniform(name), vectorArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const Glsl::Vec3* vectorArray, std::size_t length)
+{
+    setUniformArray(getUniform(name), vectorArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const Glsl::Vec4* vectorArray, std::size_t length)
+{
+    setUniformArray(getUniform(name), vectorArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixArray, std::size_t length)
+{
+    setUniformArray(getUniform(name), matrixArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
+{
+    setUniformArray(getUniform(name), matrixArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::bindUniformBlock(const std::string& name, UniformBuffer& buffer)
+{
+    if (!m_shaderProgram)
+        return false;
+
+    // Make sure that we can use uniform buffers
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Failed to bind uniform block " << std::quoted(name)
+              << ": your system doesn't support uniform buffers "
+              << "(you should test UniformBuffer::isAvailable() before trying to use uniform blocks)" << std::endl;
         return false;
     }
 
-    // Read the fragment shader code from the stream
-    std::vector<char> fragmentShader;
-    if (!getStreamContents(fragmentShaderStream, fragmentShader))
+    const TransientContextLock lock;
+
+    // Find the index of the block in the shader
+    const GLuint blockIndex = glCheck(GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (blockIndex == GLEXT_GL_INVALID_INDEX)
     {
-        err() << "Failed to read fragment shader from stream" << std::endl;
+        err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
         return false;
     }
 
-    // Compile the shader program
-    return compile(vertexShader.data(), {}, fragmentShader.data());
+    // Each block reads from the binding point matching its index, the buffer is bound there when the shader is bound
+    glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, blockIndex, blockIndex));
+
+    if (blockIndex >= m_uniformBlocks.size())
+        m_uniformBlocks.resize(blockIndex + 1, nullptr);
+
+    m_uniformBlocks[blockIndex] = &buffer;
+
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& geometryShaderStream, InputStream& fragmentShaderStream)
+template <typename T>
+void Shader::setUniformValues(UniformHandle uniform, UniformType type, std::size_t count, const T* values)
 {
-    // Read the vertex shader code from the stream
-    std::vector<char> vertexShader;
-    if (!getStreamContents(vertexShaderStream, vertexShader))
+    // Empty arrays have nothing to upload
+    if (!m_shaderProgram || !uniform.isValid() || (count == 0))
+        return;
+
+    if (!m_uniformUploadDeferred)
     {
-        err() << "Failed to read vertex shader from stream" << std::endl;
-        return false;
+        const UniformBinder binder(*this);
+        uploadUniform(uniform.m_location, type, count, values);
+        return;
     }
 
-    // Read the geometry shader code from the stream
-    std::vector<char> geometryShader;
-    if (!getStreamContents(geometryShaderStream, geometryShader))
+    // Reuse the entry of the uniform if it was already staged, to avoid reallocating its storage
+    StagedUniform&    staged = m_stagedUniforms[uniform.m_location];
+    const std::size_t size   = count * uniformComponentCounts[static_cast<std::size_t>(type)];
+
+    staged.type  = type;
+    staged.count = count;
+    staged.dirty = true;
+
+    if constexpr (std::is_same_v<T, float>)
     {
-        err() << "Failed to read geometry shader from stream" << std::endl;
-        return false;
+        staged.floats.assign(values, values + size);
+        staged.ints.clear();
     }
-
-    // Read the fragment shader code from the stream
-    std::vector<char> fragmentShader;
-    if (!getStreamContents(fragmentShaderStream, fragmentShader))
+    else
     {
-        err() << "Failed to read fragment shader from stream" << std::endl;
-        return false;
+        staged.ints.assign(values, values + size);
+        staged.floats.clear();
     }
 
-    // Compile the shader program
-    return compile(vertexShader.data(), geometryShader.data(), fragmentShader.data());
+    m_stagedUniformsDirty = true;
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, float x)
+void Shader::setUniform(UniformHandle uniform, float x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1f(binder.location, x));
+    setUniformValues(uniform, UniformType::Float, 1, &x);
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, Glsl::Vec2 v)
+void Shader::setUniform(UniformHandle uniform, Glsl::Vec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2f(binder.location, v.x, v.y));
+    const std::array values{v.x, v.y};
+    setUniformValues(uniform, UniformType::Vec2, 1, values.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Vec3& v)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Vec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3f(binder.location, v.x, v.y, v.z));
+    const std::array values{v.x, v.y, v.z};
+    setUniformValues(uniform, UniformType::Vec3, 1, values.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Vec4& v)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Vec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4f(binder.location, v.x, v.y, v.z, v.w));
+    const std::array values{v.x, v.y, v.z, v.w};
+    setUniformValues(uniform, UniformType::Vec4, 1, values.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, int x)
+void Shader::setUniform(UniformHandle uniform, int x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1i(binder.location, x));
+    setUniformValues(uniform, UniformType::Int, 1, &x);
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, Glsl::Ivec2 v)
+void Shader::setUniform(UniformHandle uniform, Glsl::Ivec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2i(binder.location, v.x, v.y));
+    const std::array values{v.x, v.y};
+    setUniformValues(uniform, UniformType::Ivec2, 1, values.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Ivec3& v)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Ivec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3i(binder.location, v.x, v.y, v.z));
+    const std::array values{v.x, v.y, v.z};
+    setUniformValues(uniform, UniformType::Ivec3, 1, values.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Ivec4& v)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Ivec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4i(binder.location, v.x, v.y, v.z, v.w));
+    const std::array values{v.x, v.y, v.z, v.w};
+    setUniformValues(uniform, UniformType::Ivec4, 1, values.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, bool x)
+void Shader::setUniform(UniformHandle uniform, bool x)
 {
-    setUniform(name, static_cast<int>(x));
+    setUniform(uniform, static_cast<int>(x));
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, Glsl::Bvec2 v)
+void Shader::setUniform(UniformHandle uniform, Glsl::Bvec2 v)
 {
-    setUniform(name, Glsl::Ivec2(v));
+    setUniform(uniform, Glsl::Ivec2(v));
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Bvec3& v)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Bvec3& v)
 {
-    setUniform(name, Glsl::Ivec3(v));
+    setUniform(uniform, Glsl::Ivec3(v));
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Bvec4& v)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Bvec4& v)
 {
-    setUniform(name, Glsl::Ivec4(v));
+    setUniform(uniform, Glsl::Ivec4(v));
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Mat3& matrix)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Mat3& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    setUniformValues(uniform, UniformType::Mat3, 1, matrix.array.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Glsl::Mat4& matrix)
+void Shader::setUniform(UniformHandle uniform, const Glsl::Mat4& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    setUniformValues(uniform, UniformType::Mat4, 1, matrix.array.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, const Texture& texture)
+void Shader::setUniform(UniformHandle uniform, const Texture& texture)
 {
-    if (!m_shaderProgram)
-        return;
-
-    const TransientContextLock lock;
-
-    // Find the location of the variable in the shader
-    const int location = getUniformLocation(name);
-    if (location != -1)
-    {
-        // Store the location -> texture mapping
-        const auto it = m_textures.find(location);
-        if (it == m_textures.end())
-        {
-            // New entry, make sure there are enough texture units
-            if (m_textures.size() + 1 >= getMaxTextureUnits())
-            {
-                err() << "Impossible to use texture " << std::quoted(name)
-                      << " for shader: all available texture units are used" << std::endl;
-                return;
-            }
-
-            m_textures[location] = &texture;
-        }
-        else
-        {
-            // Location already used, just replace the texture
-            it->second = &texture;
-        }
-    }
+    if (!setUniformTexture(uniform, texture))
+        err() << "Impossible to use texture for shader: all available texture units are used" << std::endl;
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniform(const std::string& name, CurrentTextureType)
+void Shader::setUniform(UniformHandle uniform, CurrentTextureType)
 {
     if (!m_shaderProgram)
         return;
 
-    const TransientContextLock lock;
-
-    // Find the location of the variable in the shader
-    m_currentTexture = getUniformLocation(name);
+    m_currentTexture = uniform.m_location;
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const float* scalarArray, std::size_t length)
+void Shader::setUniformArray(UniformHandle uniform, const float* scalarArray, std::size_t length)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1fv(binder.location, static_cast<GLsizei>(length), scalarArray));
+    setUniformValues(uniform, UniformType::Float, length, scalarArray);
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const Glsl::Vec2* vectorArray, std::size_t length)
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Vec2* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    const std::vector<float> contiguous = flatten(vectorArray, length);
+    setUniformValues(uniform, UniformType::Vec2, length, contiguous.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const Glsl::Vec3* vectorArray, std::size_t length)
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Vec3* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    const std::vector<float> contiguous = flatten(vectorArray, length);
+    setUniformValues(uniform, UniformType::Vec3, length, contiguous.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const Glsl::Vec4* vectorArray, std::size_t length)
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Vec4* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    const std::vector<float> contiguous = flatten(vectorArray, length);
+    setUniformValues(uniform, UniformType::Vec4, length, contiguous.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixArray, std::size_t length)
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Mat3* matrixArray, std::size_t length)
 {
     static const std::size_t matrixSize = matrixArray[0].array.size();
 
@@ -747,14 +1717,12 @@ void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixAr
     for (std::size_t i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    setUniformValues(uniform, UniformType::Mat3, length, contiguous.data());
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
+void Shader::setUniformArray(UniformHandle uniform, const Glsl::Mat4* matrixArray, std::size_t length)
 {
     static const std::size_t matrixSize = matrixArray[0].array.size();
 
@@ -762,9 +1730,31 @@ void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixAr
     for (std::size_t i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    setUniformValues(uniform, UniformType::Mat4, length, contiguous.data());
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformUploadDeferred(bool deferred)
+{
+    if (m_uniformUploadDeferred == deferred)
+        return;
+
+    m_uniformUploadDeferred = deferred;
+
+    // Don't leave values behind, they would otherwise only be uploaded on the next bind
+    if (!deferred && m_stagedUniformsDirty)
+    {
+        const UniformBinder binder(*this);
+        uploadStagedUniforms();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isUniformUploadDeferred() const
+{
+    return m_uniformUploadDeferred;
 }
 
 
@@ -791,11 +1781,17 @@ void Shader::bind(const Shader* shader)
     if (shader && shader->m_shaderProgram)
     {
         // Enable the program
-        glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
+        priv::getActiveGLStateShadow().useProgram(shader->m_shaderProgram, shader->m_cacheId);
+
+        // Upload the uniform values that were deferred until now
+        shader->uploadStagedUniforms();
 
         // Bind the textures
         shader->bindTextures();
 
+        // Bind the uniform buffers
+        shader->bindUniformBlocks();
+
         // Bind the current texture
         if (shader->m_currentTexture != -1)
             glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
@@ -803,7 +1799,7 @@ void Shader::bind(const Shader* shader)
     else
     {
         // Bind no shader
-        glCheck(GLEXT_glUseProgramObject({}));
+        priv::getActiveGLStateShadow().useProgram(0, 0);
     }
 }
 
@@ -843,90 +1839,157 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& directory)
+{
+    BinaryCache&          binaryCache = getBinaryCache();
+    const std::lock_guard lock(binaryCache.mutex);
+    binaryCache.directory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    BinaryCache&          binaryCache = getBinaryCache();
+    const std::lock_guard lock(binaryCache.mutex);
+    return binaryCache.directory;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isBinaryCacheAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (!isAvailable() || !GLEXT_get_program_binary)
+            return false;
+
+        // Some drivers expose the extension without supporting any binary format
+        GLint formatCount = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+
+        return formatCount > 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::BinaryCacheStatistics Shader::getBinaryCacheStatistics()
+{
+    const BinaryCache& binaryCache = getBinaryCache();
+    return {binaryCache.hits.load(), binaryCache.misses.load(), binaryCache.rejected.load()};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::resetBinaryCacheStatistics()
+{
+    BinaryCache& binaryCache = getBinaryCache();
+    binaryCache.hits         = 0;
+    binaryCache.misses       = 0;
+    binaryCache.rejected     = 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
 {
+    // A synchronous load supersedes the asynchronous one
+    cancelPendingProgram();
+
     const TransientContextLock lock;
 
-    // First make sure that we can use shaders
-    if (!isAvailable())
-    {
-        err() << "Failed to create a shader: your system doesn't support shaders "
-              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
+    // First make sure that we can use the requested kinds of shaders
+    if (!checkShaderSupport(!geometryShaderCode.empty()))
         return false;
-    }
 
-    // Make sure we can use geometry shaders
-    if (!geometryShaderCode.empty() && !isGeometryAvailable())
-    {
-        err() << "Failed to create a shader: your system doesn't support geometry shaders "
-              << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)" << std::endl;
+    // Compile and link the program, and wait for the result
+    ProgramLink        link    = submitProgram(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    const unsigned int program = finishProgram(link, err());
+    if (!program)
         return false;
-    }
 
-    // Create the program
-    const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
+    setProgram(program);
+    return true;
+}
 
-    // Helper function for shader creation
-    const auto createAndAttachShader =
-        [shaderProgram](GLenum shaderType, const char* shaderTypeStr, std::string_view shaderCode)
-    {
-        // Create and compile the shader
-        const GLEXT_GLhandle shader           = glCheck(GLEXT_glCreateShaderObject(shaderType));
-        const GLcharARB*     sourceCode       = shaderCode.data();
-        const auto           sourceCodeLength = static_cast<GLint>(shaderCode.length());
-        glCheck(GLEXT_glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
-        glCheck(GLEXT_glCompileShader(shader));
 
-        // Check the compile log
-        GLint success = 0;
-        glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &success));
-        if (success == GL_FALSE)
-        {
-            std::array<char, 1024> log{};
-            glCheck(GLEXT_glGetInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data()));
-            err() << "Failed to compile " << shaderTypeStr << " shader:" << '\n' << log.data() << std::endl;
-            glCheck(GLEXT_glDeleteObject(shader));
-            glCheck(GLEXT_glDeleteObject(shaderProgram));
-            return false;
-        }
+////////////////////////////////////////////////////////////
+bool Shader::compileAsync(std::string vertexShaderCode, std::string geometryShaderCode, std::string fragmentShaderCode)
+{
+    // Only one load can be pending at a time
+    cancelPendingProgram();
 
-        // Attach the shader to the program, and delete it (not needed anymore)
-        glCheck(GLEXT_glAttachObject(shaderProgram, shader));
-        glCheck(GLEXT_glDeleteObject(shader));
-        return true;
-    };
+    const TransientContextLock lock;
 
-    // Create the vertex shader if needed
-    if (!vertexShaderCode.empty())
-        if (!createAndAttachShader(GLEXT_GL_VERTEX_SHADER, "vertex", vertexShaderCode))
-            return false;
+    // First make sure that we can use the requested kinds of shaders
+    if (!checkShaderSupport(!geometryShaderCode.empty()))
+        return false;
 
-    // Create the geometry shader if needed
-    if (!geometryShaderCode.empty())
-        if (!createAndAttachShader(GLEXT_GL_GEOMETRY_SHADER, "geometry", geometryShaderCode))
-            return false;
+    m_pendingProgram = std::make_unique<PendingProgram>();
 
-    // Create the fragment shader if needed
-    if (!fragmentShaderCode.empty())
-        if (!createAndAttachShader(GLEXT_GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
-            return false;
+    if (isParallelCompileAvailable())
+    {
+        // The driver compiles and links in the background, we only have to poll it
+        m_pendingProgram->link = submitProgram(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    }
+    else
+    {
+        // Compile in the compiler thread, using a context shared with all the others
+        auto job                = std::make_shared<CompileJob>();
+        job->vertexShaderCode   = std::move(vertexShaderCode);
+        job->geometryShaderCode = std::move(geometryShaderCode);
+        job->fragmentShaderCode = std::move(fragmentShaderCode);
+        m_pendingProgram->job   = job;
+        ProgramCompiler::getInstance().submit(std::move(job));
+    }
 
-    // Link the program
-    glCheck(GLEXT_glLinkProgram(shaderProgram));
+    return true;
+}
 
-    // Check the link log
-    GLint success = 0;
-    glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &success));
-    if (success == GL_FALSE)
+
+////////////////////////////////////////////////////////////
+void Shader::cancelPendingProgram()
+{
+    if (!m_pendingProgram)
+        return;
+
+    // Don't wait for the compiler thread: abandon the job, it then skips it or destroys its program.
+    // If the job is already done, its program is ours to destroy
+    unsigned int compiledProgram = 0;
+    if (CompileJob* job = m_pendingProgram->job.get())
     {
-        std::array<char, 1024> log{};
-        glCheck(GLEXT_glGetInfoLog(shaderProgram, static_cast<GLsizei>(log.size()), nullptr, log.data()));
-        err() << "Failed to link shader:" << '\n' << log.data() << std::endl;
-        glCheck(GLEXT_glDeleteObject(shaderProgram));
-        return false;
+        auto pending = CompileJob::State::Pending;
+        if (!job->state.compare_exchange_strong(pending, CompileJob::State::Abandoned, std::memory_order_acq_rel))
+            compiledProgram = job->program;
+    }
+
+    if (m_pendingProgram->link || compiledProgram)
+    {
+        const TransientContextLock lock;
+
+        if (m_pendingProgram->link)
+            cancelProgram(*m_pendingProgram->link);
+
+        if (compiledProgram)
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(compiledProgram)));
     }
 
+    m_pendingProgram.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setProgram(unsigned int shaderProgram)
+{
     // Destroy the shader if it was already created
     if (m_shaderProgram)
     {
@@ -938,53 +2001,202 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
     m_currentTexture = -1;
     m_textures.clear();
     m_uniforms.clear();
+    m_attributes.clear();
+    m_names.clear();
+    m_uniformBlocks.clear();
+    m_stagedUniforms.clear();
+    m_stagedUniformsDirty = false;
 
-    m_shaderProgram = castFromGlHandle(shaderProgram);
+    m_shaderProgram = shaderProgram;
+    m_cacheId       = shaderProgram ? ShaderImpl::getUniqueId() : 0;
 
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
-
-    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::bindTextures() const
 {
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
     auto it = m_textures.begin();
     for (std::size_t i = 0; i < m_textures.size(); ++i)
     {
         const auto index = static_cast<GLsizei>(i + 1);
         glCheck(GLEXT_glUniform1i(it->first, index));
-        glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0 + static_cast<GLenum>(index)));
+        glState.setActiveTextureUnit(static_cast<unsigned int>(index));
         Texture::bind(it->second);
         ++it;
     }
 
     // Make sure that the texture unit which is left active is the number 0
-    glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+    glState.setActiveTextureUnit(0);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
+    for (std::size_t i = 0; i < m_uniformBlocks.size(); ++i)
+    {
+        UniformBuffer* buffer = m_uniformBlocks[i];
+        if (!buffer || !buffer->m_buffer)
+            continue;
+
+        // Values shared by several shaders are only uploaded by the first one that is bound
+        buffer->uploadDirtyRange();
+        glState.bindUniformBuffer(static_cast<unsigned int>(i), buffer->m_buffer, buffer->m_cacheId);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+int Shader::getUniformLocation(std::string_view name)
+{
+    // Check the cache
+    if (const auto it = m_uniforms.find(name); it != m_uniforms.end())
+    {
+        // Already in cache, return it
+        return it->second;
+    }
+
+    // Not in cache, request the location from OpenGL; the cache keys view names stored
+    // in a deque, whose elements keep their address, so that lookups don't build strings
+    const std::string& nameString = m_names.emplace_back(name);
+    const int          location   = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), nameString.c_str());
+    m_uniforms.try_emplace(nameString, location);
+
+    if (location == -1)
+        err() << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
+
+    return location;
+}
+
+
+////////////////////////////////////////////////////////////
+int Shader::getAttributeLocation(std::string_view name) const
+{
+    if (const auto it = m_attributes.find(name); it != m_attributes.end())
+        return it->second;
+
+    // Unused attributes are not an error, they are cached as -1 too
+    const std::string& nameString = m_names.emplace_back(name);
+    const int location = glCheck(GLEXT_glGetAttribLocation(castToGlHandle(m_shaderProgram), nameString.c_str()));
+    m_attributes.try_emplace(nameString, location);
+
+    return location;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformTexture(UniformHandle uniform, const Texture& texture)
+{
+    if (!m_shaderProgram || !uniform.isValid())
+        return true;
+
+    // Store the location -> texture mapping
+    const auto it = m_textures.find(uniform.m_location);
+    if (it == m_textures.end())
+    {
+        // New entry, make sure there are enough texture units
+        const TransientContextLock lock;
+        if (m_textures.size() + 1 >= getMaxTextureUnits())
+            return false;
+
+        m_textures[uniform.m_location] = &texture;
+    }
+    else
+    {
+        // Location already used, just replace the texture
+        it->second = &texture;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::uploadStagedUniforms() const
+{
+    if (!m_stagedUniformsDirty)
+        return;
+
+    for (auto& [location, staged] : m_stagedUniforms)
+    {
+        if (!staged.dirty)
+            continue;
+
+        if (uniformFloatTypes[static_cast<std::size_t>(staged.type)])
+            uploadUniform(location, staged.type, staged.count, staged.floats.data());
+        else
+            uploadUniform(location, staged.type, staged.count, staged.ints.data());
+
+        staged.dirty = false;
+    }
+
+    m_stagedUniformsDirty = false;
 }
 
 
 ////////////////////////////////////////////////////////////
-int Shader::getUniformLocation(const std::string& name)
+void Shader::uploadUniform(int location, UniformType type, std::size_t count, const float* values)
 {
-    // Check the cache
-    if (const auto it = m_uniforms.find(name); it != m_uniforms.end())
+    const auto length = static_cast<GLsizei>(count);
+
+    switch (type)
     {
-        // Already in cache, return it
-        return it->second;
+        case UniformType::Float:
+            glCheck(GLEXT_glUniform1fv(location, length, values));
+            break;
+        case UniformType::Vec2:
+            glCheck(GLEXT_glUniform2fv(location, length, values));
+            break;
+        case UniformType::Vec3:
+            glCheck(GLEXT_glUniform3fv(location, length, values));
+            break;
+        case UniformType::Vec4:
+            glCheck(GLEXT_glUniform4fv(location, length, values));
+            break;
+        case UniformType::Mat3:
+            glCheck(GLEXT_glUniformMatrix3fv(location, length, GL_FALSE, values));
+            break;
+        case UniformType::Mat4:
+            glCheck(GLEXT_glUniformMatrix4fv(location, length, GL_FALSE, values));
+            break;
+        default:
+            assert(false && "Shader::uploadUniform() Invalid float-based uniform type");
+            break;
     }
+}
 
-    // Not in cache, request the location from OpenGL
-    const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), name.c_str());
-    m_uniforms.try_emplace(name, location);
 
-    if (location == -1)
-        err() << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
+////////////////////////////////////////////////////////////
+void Shader::uploadUniform(int location, UniformType type, std::size_t count, const int* values)
+{
+    const auto length = static_cast<GLsizei>(count);
 
-    return location;
+    switch (type)
+    {
+        case UniformType::Int:
+            glCheck(GLEXT_glUniform1iv(location, length, values));
+            break;
+        case UniformType::Ivec2:
+            glCheck(GLEXT_glUniform2iv(location, length, values));
+            break;
+        case UniformType::Ivec3:
+            glCheck(GLEXT_glUniform3iv(location, length, values));
+            break;
+        case UniformType::Ivec4:
+            glCheck(GLEXT_glUniform4iv(location, length, values));
+            break;
+        default:
+            assert(false && "Shader::uploadUniform() Invalid int-based uniform type");
+            break;
+    }
 }
 
 } // namespace sf
@@ -995,6 +2207,16 @@ int Shader::getUniformLocation(const std::string& name)
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct Shader::PendingProgram
+{
+};
+
+
+////////////////////////////////////////////////////////////
+Shader::Shader() = default;
+
+
 ////////////////////////////////////////////////////////////
 Shader::Shader(const std::filesystem::path& /* filename */, Type /* type */)
 {
@@ -1145,6 +2367,60 @@ bool Shader::loadFromStream(InputStream& /* vertexShaderStream */,
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFileAsync(const std::filesystem::path& /* filename */, Type /* type */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFileAsync(const std::filesystem::path& /* vertexShaderFilename */,
+                               const std::filesystem::path& /* fragmentShaderFilename */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromFileAsync(const std::filesystem::path& /* vertexShaderFilename */,
+                               const std::filesystem::path& /* geometryShaderFilename */,
+                               const std::filesystem::path& /* fragmentShaderFilename */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromMemoryAsync(std::string_view /* shader */, Type /* type */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromMemoryAsync(std::string_view /* vertexShader */, std::string_view /* fragmentShader */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::loadFromMemoryAsync(std::string_view /* vertexShader */,
+                                 std::string_view /* geometryShader */,
+                                 std::string_view /* fragmentShader */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isReady()
+{
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& /* name */, float)
 {
@@ -1277,6 +2553,179 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::bindUniformBlock(const std::string& /* name */, UniformBuffer& /* buffer */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle::UniformHandle(int location) : m_location(location)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::UniformHandle::isValid() const
+{
+    return m_location != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniform(std::string_view /* name */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, Glsl::Vec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, Glsl::Ivec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, Glsl::Bvec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, const Texture& /* texture */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* uniform */, CurrentTextureType)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const float* /* scalarArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Vec2* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Vec3* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Vec4* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Mat3* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* uniform */, const Glsl::Mat4* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformUploadDeferred(bool deferred)
+{
+    m_uniformUploadDeferred = deferred;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isUniformUploadDeferred() const
+{
+    return m_uniformUploadDeferred;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1304,6 +2753,39 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& /* directory */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getBinaryCacheDirectory()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isBinaryCacheAvailable()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::BinaryCacheStatistics Shader::getBinaryCacheStatistics()
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::resetBinaryCacheStatistics()
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view /* vertexShaderCode */,
                      std::string_view /* geometryShaderCode */,
@@ -1313,11 +2795,45 @@ bool Shader::compile(std::string_view /* vertexShaderCode */,
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shader::compileAsync(std::string /* vertexShaderCode */,
+                          std::string /* geometryShaderCode */,
+                          std::string /* fragmentShaderCode */)
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::cancelPendingProgram()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setProgram(unsigned int /* shaderProgram */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+}
+
+
+////////////////////////////////////////////////////////////
+int Shader::getAttributeLocation(std::string_view /* name */) const
+{
+    return -1;
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
@@ -252,6 +252,13 @@ void Shape::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Shape::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shape::updateFillColors()
 {
@@ -0,0 +1,896 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SoftwareRasterizer.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include <cmath>
+#include <cstring>
+
+
+namespace
+{
+// Height of the tiles that rows of pixels are grouped in when a draw is split across threads
+constexpr int tileHeight = 32;
+
+// Number of covered pixels below which it isn't worth giving a thread its own slice of a draw
+constexpr float minPixelsPerThread = 16'384.f;
+
+// Maximum number of texture copies kept around, the cache is flushed when it grows larger
+constexpr std::size_t maxCachedTextures = 64;
+
+
+////////////////////////////////////////////////////////////
+float edgeFunction(sf::Vector2f a, sf::Vector2f b, sf::Vector2f point)
+{
+    return (b.x - a.x) * (point.y - a.y) - (b.y - a.y) * (point.x - a.x);
+}
+
+
+////////////////////////////////////////////////////////////
+bool isTopLeftEdge(sf::Vector2f a, sf::Vector2f b)
+{
+    // With the y axis pointing down and a positive area, top edges
+    // are horizontal and go right, while left edges go up
+    const float dy = b.y - a.y;
+    return (dy < 0.f) || ((dy == 0.f) && (b.x > a.x));
+}
+
+
+////////////////////////////////////////////////////////////
+bool isInside(float weight, bool topLeft)
+{
+    // Pixels exactly on an edge belong to the triangle only if it is a top or left edge,
+    // so that pixels shared by adjacent triangles are drawn exactly once
+    return (weight > 0.f) || ((weight == 0.f) && topLeft);
+}
+
+
+////////////////////////////////////////////////////////////
+int toPixel(float coordinate, int minimum, int maximum)
+{
+    // Clamping first keeps the conversion defined for coordinates far outside the target
+    if (std::isnan(coordinate))
+        return minimum;
+
+    return static_cast<int>(std::clamp(coordinate, static_cast<float>(minimum), static_cast<float>(maximum)));
+}
+
+
+////////////////////////////////////////////////////////////
+bool ownsRow(int row, int slice, int sliceCount)
+{
+    return (sliceCount == 1) || ((row / tileHeight) % sliceCount == slice);
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t packColor(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+{
+    const std::array<std::uint8_t, 4> components{r, g, b, a};
+    std::uint32_t                     packed = 0;
+    std::memcpy(&packed, components.data(), sizeof(packed));
+    return packed;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t toComponent(float value)
+{
+    return static_cast<std::uint8_t>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+}
+
+
+////////////////////////////////////////////////////////////
+void blendAlphaSpan(std::uint32_t* pixels, std::size_t count, const std::array<std::uint32_t, 4>& color)
+{
+    // Integer version of sf::BlendAlpha for a single source color, written
+    // as a plain loop over the components so that compilers vectorize it
+    auto* const         components = reinterpret_cast<std::uint8_t*>(pixels);
+    const std::uint32_t alpha      = color[3];
+    const std::uint32_t inverse    = 255 - alpha;
+    const std::array<std::uint32_t, 4> source{color[0] * alpha, color[1] * alpha, color[2] * alpha, 255 * alpha};
+
+    for (std::size_t i = 0; i < count * 4; ++i)
+        components[i] = static_cast<std::uint8_t>((source[i % 4] + components[i] * inverse + 127) / 255);
+}
+
+
+////////////////////////////////////////////////////////////
+float factorValue(sf::BlendMode::Factor       factor,
+                  const std::array<float, 4>& source,
+                  const std::array<float, 4>& destination,
+                  std::size_t                 component)
+{
+    switch (factor)
+    {
+        case sf::BlendMode::Factor::Zero:
+            return 0.f;
+        case sf::BlendMode::Factor::One:
+            return 1.f;
+        case sf::BlendMode::Factor::SrcColor:
+            return source[component];
+        case sf::BlendMode::Factor::OneMinusSrcColor:
+            return 1.f - source[component];
+        case sf::BlendMode::Factor::DstColor:
+            return destination[component];
+        case sf::BlendMode::Factor::OneMinusDstColor:
+            return 1.f - destination[component];
+        case sf::BlendMode::Factor::SrcAlpha:
+            return source[3];
+        case sf::BlendMode::Factor::OneMinusSrcAlpha:
+            return 1.f - source[3];
+        case sf::BlendMode::Factor::DstAlpha:
+            return destination[3];
+        case sf::BlendMode::Factor::OneMinusDstAlpha:
+            return 1.f - destination[3];
+    }
+
+    return 0.f;
+}
+
+
+////////////////////////////////////////////////////////////
+float blend(sf::BlendMode::Equation equation,
+            float                   source,
+            float                   destination,
+            float                   sourceFactor,
+            float                   destinationFactor)
+{
+    switch (equation)
+    {
+        case sf::BlendMode::Equation::Add:
+            return source * sourceFactor + destination * destinationFactor;
+        case sf::BlendMode::Equation::Subtract:
+            return source * sourceFactor - destination * destinationFactor;
+        case sf::BlendMode::Equation::ReverseSubtract:
+            return destination * destinationFactor - source * sourceFactor;
+        // Like in OpenGL, min and max ignore the blending factors
+        case sf::BlendMode::Equation::Min:
+            return std::min(source, destination);
+        case sf::BlendMode::Equation::Max:
+            return std::max(source, destination);
+    }
+
+    return source;
+}
+
+
+////////////////////////////////////////////////////////////
+bool stencilTest(sf::StencilComparison comparison, std::uint32_t reference, std::uint32_t stored)
+{
+    switch (comparison)
+    {
+        case sf::StencilComparison::Never:
+            return false;
+        case sf::StencilComparison::Less:
+            return reference < stored;
+        case sf::StencilComparison::LessEqual:
+            return reference <= stored;
+        case sf::StencilComparison::Greater:
+            return reference > stored;
+        case sf::StencilComparison::GreaterEqual:
+            return reference >= stored;
+        case sf::StencilComparison::Equal:
+            return reference == stored;
+        case sf::StencilComparison::NotEqual:
+            return reference != stored;
+        case sf::StencilComparison::Always:
+            return true;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t stencilUpdate(sf::StencilUpdateOperation operation, std::uint8_t stored, std::uint8_t reference)
+{
+    switch (operation)
+    {
+        case sf::StencilUpdateOperation::Keep:
+            return stored;
+        case sf::StencilUpdateOperation::Zero:
+            return 0;
+        case sf::StencilUpdateOperation::Replace:
+            return reference;
+        case sf::StencilUpdateOperation::Increment:
+            return (stored == 255) ? stored : static_cast<std::uint8_t>(stored + 1);
+        case sf::StencilUpdateOperation::Decrement:
+            return (stored == 0) ? stored : static_cast<std::uint8_t>(stored - 1);
+        case sf::StencilUpdateOperation::Invert:
+            return static_cast<std::uint8_t>(~stored);
+    }
+
+    return stored;
+}
+
+
+////////////////////////////////////////////////////////////
+std::array<float, 4> sampleTexture(const sf::Image& image, sf::Vector2f texCoords, bool smooth, bool repeated)
+{
+    const sf::Vector2i  size(image.getSize());
+    const std::uint8_t* pixels = image.getPixelsPtr();
+
+    const auto wrap = [repeated](int coordinate, int extent)
+    {
+        if (!repeated)
+            return std::clamp(coordinate, 0, extent - 1);
+
+        const int wrapped = coordinate % extent;
+        return (wrapped < 0) ? wrapped + extent : wrapped;
+    };
+
+    const auto fetch = [&](int x, int y)
+    {
+        const std::size_t   index = static_cast<std::size_t>(wrap(y, size.y)) * static_cast<std::size_t>(size.x) +
+                                  static_cast<std::size_t>(wrap(x, size.x));
+        const std::uint8_t* texel = pixels + index * 4;
+        return std::array<float, 4>{texel[0] / 255.f, texel[1] / 255.f, texel[2] / 255.f, texel[3] / 255.f};
+    };
+
+    // Texture coordinates are clamped to a range that can't overflow, yet is large enough to wrap correctly
+    constexpr float limit = 1'000'000.f;
+
+    if (!smooth)
+        return fetch(static_cast<int>(std::clamp(std::floor(texCoords.x), -limit, limit)),
+                     static_cast<int>(std::clamp(std::floor(texCoords.y), -limit, limit)));
+
+    // Bilinear filtering between the 4 texels whose centers surround the sampled point
+    const float u  = std::clamp(texCoords.x - 0.5f, -limit, limit);
+    const float v  = std::clamp(texCoords.y - 0.5f, -limit, limit);
+    const float x0 = std::floor(u);
+    const float y0 = std::floor(v);
+    const float fx = u - x0;
+    const float fy = v - y0;
+    const int   ix = static_cast<int>(x0);
+    const int   iy = static_cast<int>(y0);
+
+    const std::array<float, 4> topLeft     = fetch(ix, iy);
+    const std::array<float, 4> topRight    = fetch(ix + 1, iy);
+    const std::array<float, 4> bottomLeft  = fetch(ix, iy + 1);
+    const std::array<float, 4> bottomRight = fetch(ix + 1, iy + 1);
+
+    std::array<float, 4> result{};
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        const float top    = topLeft[i] + (topRight[i] - topLeft[i]) * fx;
+        const float bottom = bottomLeft[i] + (bottomRight[i] - bottomLeft[i]) * fx;
+        result[i]          = top + (bottom - top) * fy;
+    }
+
+    return result;
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+SoftwareRasterizer::SoftwareRasterizer(Vector2u size) :
+m_size(size),
+m_pixels(static_cast<std::size_t>(size.x) * size.y),
+m_stencil(static_cast<std::size_t>(size.x) * size.y)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SoftwareRasterizer::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::setThreadCount(unsigned int count)
+{
+    m_threadCount = std::max(count, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoftwareRasterizer::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::clear(const RenderTarget&         target,
+                               std::optional<Color>        color,
+                               std::optional<StencilValue> stencilValue)
+{
+    const IntRect                bounds({0, 0}, Vector2i(m_size));
+    const std::optional<IntRect> area = bounds.findIntersection(target.getScissor(target.getView()));
+    if (!area)
+        return;
+
+    const std::uint32_t packed = color ? packColor(color->r, color->g, color->b, color->a) : 0;
+    const auto          width  = static_cast<std::size_t>(area->size.x);
+
+    for (int y = area->position.y; y < area->position.y + area->size.y; ++y)
+    {
+        const std::size_t begin = static_cast<std::size_t>(y) * m_size.x + static_cast<std::size_t>(area->position.x);
+
+        if (color)
+            std::fill_n(m_pixels.data() + begin, width, packed);
+
+        if (stencilValue)
+            std::fill_n(m_stencil.data() + begin, width, static_cast<std::uint8_t>(stencilValue->value));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::draw(const RenderTarget& target,
+                              const Vertex*       vertices,
+                              std::size_t         vertexCount,
+                              PrimitiveType       type,
+                              const RenderStates& states,
+                              std::uint64_t       textureId)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    if (states.shader)
+    {
+        err() << "Shaders are not supported by software render targets, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Primitives are clipped by the viewport, and fragments by the scissor rectangle
+    const View&                  view     = target.getView();
+    const IntRect                viewport = target.getViewport(view);
+    const std::optional<IntRect> visible  = viewport.findIntersection(target.getScissor(view));
+    const std::optional<IntRect> clip     = visible ? visible->findIntersection(IntRect({0, 0}, Vector2i(m_size)))
+                                                    : std::nullopt;
+    if (!clip)
+        return;
+
+    DrawState state;
+    state.clip           = *clip;
+    state.blendMode      = states.blendMode;
+    state.stencilMode    = states.stencilMode;
+    state.stencilEnabled = (states.stencilMode != StencilMode());
+
+    // Pixels given by the caller are used as they are, textures are read back from video memory
+    if (states.image)
+        state.texture = states.image;
+    else if (states.texture)
+        state.texture = getTextureImage(*states.texture, textureId);
+
+    if (state.texture && states.texture)
+    {
+        state.smooth   = states.texture->isSmooth();
+        state.repeated = states.texture->isRepeated();
+    }
+
+    Vector2f texCoordsScale(1.f, 1.f);
+    if (state.texture && (states.coordinateType == CoordinateType::Normalized))
+        texCoordsScale = Vector2f(state.texture->getSize());
+
+    // Map vertices to pixels: view and model transforms lead to normalized
+    // device coordinates, which are then mapped to the viewport with y pointing down
+    const Vector2f  halfViewport = Vector2f(viewport.size) / 2.f;
+    const Transform toViewport(halfViewport.x,
+                               0.f,
+                               static_cast<float>(viewport.position.x) + halfViewport.x,
+                               0.f,
+                               -halfViewport.y,
+                               static_cast<float>(viewport.position.y) + halfViewport.y,
+                               0.f,
+                               0.f,
+                               1.f);
+    const Transform transform = toViewport * view.getTransform() * states.transform;
+
+    std::vector<ScreenVertex> screenVertices(vertexCount);
+    Vector2f                  minimum = transform.transformPoint(vertices[0].position);
+    Vector2f                  maximum = minimum;
+
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        const Vertex& vertex = vertices[i];
+        ScreenVertex& screen = screenVertices[i];
+        screen.position      = transform.transformPoint(vertex.position);
+        screen.color         = {static_cast<float>(vertex.color.r),
+                                static_cast<float>(vertex.color.g),
+                                static_cast<float>(vertex.color.b),
+                                static_cast<float>(vertex.color.a)};
+        screen.texCoords     = vertex.texCoords.componentWiseMul(texCoordsScale);
+        minimum.x            = std::min(minimum.x, screen.position.x);
+        minimum.y            = std::min(minimum.y, screen.position.y);
+        maximum.x            = std::max(maximum.x, screen.position.x);
+        maximum.y            = std::max(maximum.y, screen.position.y);
+    }
+
+    // Estimate the number of covered pixels, to decide how many threads the draw deserves
+    const float coveredWidth  = std::clamp(maximum.x - minimum.x, 1.f, static_cast<float>(clip->size.x));
+    const float coveredHeight = std::clamp(maximum.y - minimum.y, 1.f, static_cast<float>(clip->size.y));
+    const int   tileCount     = (clip->size.y + tileHeight - 1) / tileHeight;
+    const auto  sliceCount    = std::clamp(static_cast<int>(coveredWidth * coveredHeight / minPixelsPerThread),
+                                       1,
+                                       std::min(static_cast<int>(m_threadCount), tileCount));
+
+    if (sliceCount == 1)
+    {
+        rasterize(state, screenVertices, type, 0, 1);
+        return;
+    }
+
+    // Each slice owns whole rows of pixels, so slices never write the same pixel
+    // and the order of the primitives is preserved for every pixel
+    const auto rasterizeSlices = [&](std::size_t first, std::size_t last)
+    {
+        for (std::size_t slice = first; slice < last; ++slice)
+            rasterize(state, screenVertices, type, static_cast<int>(slice), sliceCount);
+    };
+
+    TaskScheduler::getDefault().parallelFor(0, static_cast<std::size_t>(sliceCount), rasterizeSlices, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::drawIndexed(const RenderTarget& target,
+                                     const Vertex*       vertices,
+                                     std::size_t         vertexCount,
+                                     const void*         indices,
+                                     std::size_t         indexSize,
+                                     std::size_t         indexCount,
+                                     PrimitiveType       type,
+                                     const RenderStates& states,
+                                     std::uint64_t       textureId)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    // Primitive assembly works on a plain sequence of vertices, so resolve the indices first
+    std::vector<Vertex> expanded(indexCount);
+
+    for (std::size_t i = 0; i < indexCount; ++i)
+    {
+        const std::size_t index = (indexSize == sizeof(std::uint16_t)) ? static_cast<const std::uint16_t*>(indices)[i]
+                                                                        : static_cast<const std::uint32_t*>(indices)[i];
+
+        if (index >= vertexCount)
+        {
+            err() << "Vertex index " << index << " is out of range, drawing skipped" << std::endl;
+            return;
+        }
+
+        expanded[i] = vertices[index];
+    }
+
+    draw(target, expanded.data(), expanded.size(), type, states, textureId);
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* SoftwareRasterizer::getPixels() const
+{
+    return reinterpret_cast<const std::uint8_t*>(m_pixels.data());
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::rasterize(const DrawState&                 state,
+                                   const std::vector<ScreenVertex>& vertices,
+                                   PrimitiveType                    type,
+                                   int                              slice,
+                                   int                              sliceCount)
+{
+    const int clipLeft   = state.clip.position.x;
+    const int clipRight  = state.clip.position.x + state.clip.size.x;
+    const int clipTop    = state.clip.position.y;
+    const int clipBottom = state.clip.position.y + state.clip.size.y;
+
+    const auto drawTriangle = [&](const ScreenVertex& a, const ScreenVertex& b, const ScreenVertex& c)
+    {
+        const float top    = std::min({a.position.y, b.position.y, c.position.y});
+        const float bottom = std::max({a.position.y, b.position.y, c.position.y});
+        const int   first  = toPixel(std::floor(top), clipTop, clipBottom);
+        const int   last   = toPixel(std::floor(bottom) + 1.f, clipTop, clipBottom);
+
+        if (sliceCount == 1)
+        {
+            if (first < last)
+                rasterizeTriangle(state, a, b, c, first, last);
+            return;
+        }
+
+        // Only visit the tiles of this slice
+        for (int tile = first / tileHeight; tile * tileHeight < last; ++tile)
+        {
+            if (tile % sliceCount != slice)
+                continue;
+
+            const int rowBegin = std::max(first, tile * tileHeight);
+            const int rowEnd   = std::min(last, (tile + 1) * tileHeight);
+            rasterizeTriangle(state, a, b, c, rowBegin, rowEnd);
+        }
+    };
+
+    const std::size_t count = vertices.size();
+
+    switch (type)
+    {
+        case PrimitiveType::Points:
+        {
+            for (const ScreenVertex& vertex : vertices)
+            {
+                const int x = toPixel(std::floor(vertex.position.x), clipLeft - 1, clipRight);
+                const int y = toPixel(std::floor(vertex.position.y), clipTop - 1, clipBottom);
+
+                if (state.clip.contains({x, y}) && ownsRow(y, slice, sliceCount))
+                    shade(state, x, y, vertex.color, vertex.texCoords);
+            }
+            break;
+        }
+
+        case PrimitiveType::Lines:
+        {
+            for (std::size_t i = 1; i < count; i += 2)
+                rasterizeLine(state, vertices[i - 1], vertices[i], slice, sliceCount);
+            break;
+        }
+
+        case PrimitiveType::LineStrip:
+        {
+            for (std::size_t i = 1; i < count; ++i)
+                rasterizeLine(state, vertices[i - 1], vertices[i], slice, sliceCount);
+            break;
+        }
+
+        case PrimitiveType::Triangles:
+        {
+            for (std::size_t i = 2; i < count; i += 3)
+                drawTriangle(vertices[i - 2], vertices[i - 1], vertices[i]);
+            break;
+        }
+
+        case PrimitiveType::TriangleStrip:
+        {
+            for (std::size_t i = 2; i < count; ++i)
+                drawTriangle(vertices[i - 2], vertices[i - 1], vertices[i]);
+            break;
+        }
+
+        case PrimitiveType::TriangleFan:
+        {
+            for (std::size_t i = 2; i < count; ++i)
+                drawTriangle(vertices[0], vertices[i - 1], vertices[i]);
+            break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::rasterizeTriangle(const DrawState&    state,
+                                           const ScreenVertex& a,
+                                           const ScreenVertex& b,
+                                           const ScreenVertex& c,
+                                           int                 rowBegin,
+                                           int                 rowEnd)
+{
+    // Orient the triangle so that its area is positive, SFML doesn't cull back faces
+    const ScreenVertex* v0   = &a;
+    const ScreenVertex* v1   = &b;
+    const ScreenVertex* v2   = &c;
+    float               area = edgeFunction(v0->position, v1->position, v2->position);
+    if (area < 0.f)
+    {
+        std::swap(v1, v2);
+        area = -area;
+    }
+
+    // Degenerate or not finite?
+    if (!(area > 0.f) || !std::isfinite(area))
+        return;
+
+    const std::array<Vector2f, 3> positions{v0->position, v1->position, v2->position};
+
+    // Edge i is the one opposite to vertex i, its function is the barycentric weight of vertex i
+    const std::array<bool, 3> topLeft{isTopLeftEdge(positions[1], positions[2]),
+                                      isTopLeftEdge(positions[2], positions[0]),
+                                      isTopLeftEdge(positions[0], positions[1])};
+
+    const float minimumX  = std::min({positions[0].x, positions[1].x, positions[2].x});
+    const float maximumX  = std::max({positions[0].x, positions[1].x, positions[2].x});
+    const int   clipLeft  = state.clip.position.x;
+    const int   clipRight = state.clip.position.x + state.clip.size.x;
+    const int   left      = toPixel(std::floor(minimumX), clipLeft, clipRight);
+    const int   right     = toPixel(std::floor(maximumX) + 1.f, clipLeft, clipRight);
+
+    if (left >= right)
+        return;
+
+    const auto weights = [&positions](Vector2f point) -> std::array<float, 3>
+    {
+        return {edgeFunction(positions[1], positions[2], point),
+                edgeFunction(positions[2], positions[0], point),
+                edgeFunction(positions[0], positions[1], point)};
+    };
+
+    const auto inside = [&](int x, float centerY)
+    {
+        const std::array<float, 3> w = weights({static_cast<float>(x) + 0.5f, centerY});
+        return isInside(w[0], topLeft[0]) && isInside(w[1], topLeft[1]) && isInside(w[2], topLeft[2]);
+    };
+
+    // Untextured triangles of a single color, opaque or alpha-blended, don't need
+    // per-pixel interpolation: their spans are processed with vectorizable loops
+    const std::array<float, 4>&        color = v0->color;
+    const std::array<std::uint32_t, 4> uniform{static_cast<std::uint32_t>(color[0]),
+                                               static_cast<std::uint32_t>(color[1]),
+                                               static_cast<std::uint32_t>(color[2]),
+                                               static_cast<std::uint32_t>(color[3])};
+    const bool          simple  = !state.texture && !state.stencilEnabled && (v1->color == color) && (v2->color == color);
+    const bool          alpha   = (state.blendMode == BlendAlpha);
+    const bool          solid   = simple && ((state.blendMode == BlendNone) || (alpha && (uniform[3] == 255)));
+    const bool          blended = simple && alpha && !solid;
+    const std::uint32_t packed  = packColor(static_cast<std::uint8_t>(uniform[0]),
+                                            static_cast<std::uint8_t>(uniform[1]),
+                                            static_cast<std::uint8_t>(uniform[2]),
+                                            static_cast<std::uint8_t>(uniform[3]));
+
+    // Change of each weight when moving one pixel right
+    const std::array<float, 3> step{positions[1].y - positions[2].y,
+                                    positions[2].y - positions[0].y,
+                                    positions[0].y - positions[1].y};
+
+    const float inverseArea = 1.f / area;
+
+    for (int y = rowBegin; y < rowEnd; ++y)
+    {
+        const float centerY = static_cast<float>(y) + 0.5f;
+
+        // Along a row, each edge function is linear in x: solve for the span where all are positive
+        const std::array<float, 3> origin = weights({0.f, centerY});
+        int                        first  = left;
+        int                        last   = right - 1;
+        bool                       empty  = false;
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            if (step[i] > 0.f)
+                first = std::max(first, toPixel(std::ceil(-origin[i] / step[i] - 0.5f), left, right));
+            else if (step[i] < 0.f)
+                last = std::min(last, toPixel(std::floor(-origin[i] / step[i] - 0.5f), left - 1, right - 1));
+            else if (!isInside(origin[i], topLeft[i]))
+                empty = true;
+        }
+
+        if (empty)
+            continue;
+
+        // The analytic bounds may be off by a pixel due to rounding, the exact test decides
+        while ((first <= last) && !inside(first, centerY))
+            ++first;
+        while ((first <= last) && (first > left) && inside(first - 1, centerY))
+            --first;
+        while ((last >= first) && !inside(last, centerY))
+            --last;
+        while ((last >= first) && (last + 1 < right) && inside(last + 1, centerY))
+            ++last;
+
+        if (first > last)
+            continue;
+
+        std::uint32_t* const row = m_pixels.data() + static_cast<std::size_t>(y) * m_size.x;
+
+        if (solid)
+        {
+            std::fill(row + first, row + last + 1, packed);
+            continue;
+        }
+
+        if (blended)
+        {
+            blendAlphaSpan(row + first, static_cast<std::size_t>(last - first + 1), uniform);
+            continue;
+        }
+
+        std::array<float, 3> w = weights({static_cast<float>(first) + 0.5f, centerY});
+
+        for (int x = first; x <= last; ++x)
+        {
+            const float l0 = w[0] * inverseArea;
+            const float l1 = w[1] * inverseArea;
+            const float l2 = w[2] * inverseArea;
+
+            std::array<float, 4> interpolated{};
+            for (std::size_t i = 0; i < interpolated.size(); ++i)
+                interpolated[i] = l0 * v0->color[i] + l1 * v1->color[i] + l2 * v2->color[i];
+
+            const Vector2f texCoords = v0->texCoords * l0 + v1->texCoords * l1 + v2->texCoords * l2;
+
+            shade(state, x, y, interpolated, texCoords);
+
+            for (std::size_t i = 0; i < 3; ++i)
+                w[i] += step[i];
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::rasterizeLine(const DrawState&    state,
+                                       const ScreenVertex& a,
+                                       const ScreenVertex& b,
+                                       int                 slice,
+                                       int                 sliceCount)
+{
+    const Vector2f delta = b.position - a.position;
+    if (!std::isfinite(delta.x) || !std::isfinite(delta.y))
+        return;
+
+    // Step one pixel at a time along the major axis
+    const bool  xMajor = std::abs(delta.x) >= std::abs(delta.y);
+    const float length = xMajor ? delta.x : delta.y;
+    if (length == 0.f)
+        return;
+
+    const float start      = xMajor ? a.position.x : a.position.y;
+    const float minorStart = xMajor ? a.position.y : a.position.x;
+    const float minorDelta = xMajor ? delta.y : delta.x;
+    const int   clipBegin  = xMajor ? state.clip.position.x : state.clip.position.y;
+    const int   clipEnd    = clipBegin + (xMajor ? state.clip.size.x : state.clip.size.y);
+    const int   minorLimit = static_cast<int>(std::max(m_size.x, m_size.y));
+
+    // Like OpenGL, the pixel containing the end point is left out so that connected lines don't overlap;
+    // a pixel is lit if its center along the major axis is within [start, end)
+    int first = 0;
+    int last  = 0;
+    if (length > 0.f)
+    {
+        first = toPixel(std::ceil(start - 0.5f), clipBegin, clipEnd);
+        last  = toPixel(std::ceil(start + length - 0.5f), clipBegin, clipEnd);
+    }
+    else
+    {
+        first = toPixel(std::floor(start + length - 0.5f) + 1.f, clipBegin, clipEnd);
+        last  = toPixel(std::floor(start - 0.5f) + 1.f, clipBegin, clipEnd);
+    }
+
+    for (int major = first; major < last; ++major)
+    {
+        const float t     = (static_cast<float>(major) + 0.5f - start) / length;
+        const int   minor = toPixel(std::floor(minorStart + t * minorDelta), -1, minorLimit);
+        const int   x     = xMajor ? major : minor;
+        const int   y     = xMajor ? minor : major;
+
+        if (!state.clip.contains({x, y}) || !ownsRow(y, slice, sliceCount))
+            continue;
+
+        std::array<float, 4> color{};
+        for (std::size_t i = 0; i < color.size(); ++i)
+            color[i] = a.color[i] + (b.color[i] - a.color[i]) * t;
+
+        shade(state, x, y, color, a.texCoords + (b.texCoords - a.texCoords) * t);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRasterizer::shade(const DrawState&            state,
+                               int                         x,
+                               int                         y,
+                               const std::array<float, 4>& color,
+                               Vector2f                    texCoords)
+{
+    const std::size_t index = static_cast<std::size_t>(y) * m_size.x + static_cast<std::size_t>(x);
+
+    // Stencil test and update, with the same semantics as OpenGL
+    if (state.stencilEnabled)
+    {
+        std::uint8_t&       stored    = m_stencil[index];
+        const std::uint32_t mask      = state.stencilMode.stencilMask.value;
+        const std::uint32_t reference = state.stencilMode.stencilReference.value;
+
+        if (!stencilTest(state.stencilMode.stencilComparison, reference & mask, stored & mask))
+            return;
+
+        stored = stencilUpdate(state.stencilMode.stencilUpdateOperation, stored, static_cast<std::uint8_t>(reference));
+
+        if (state.stencilMode.stencilOnly)
+            return;
+    }
+
+    // Vertex color modulated by the texture
+    std::array<float, 4> source{color[0] / 255.f, color[1] / 255.f, color[2] / 255.f, color[3] / 255.f};
+
+    if (state.texture)
+    {
+        const std::array<float, 4> texel = sampleTexture(*state.texture, texCoords, state.smooth, state.repeated);
+        for (std::size_t i = 0; i < source.size(); ++i)
+            source[i] *= texel[i];
+    }
+
+    // Blending
+    auto* const                pixel = reinterpret_cast<std::uint8_t*>(m_pixels.data() + index);
+    const std::array<float, 4> destination{pixel[0] / 255.f, pixel[1] / 255.f, pixel[2] / 255.f, pixel[3] / 255.f};
+    const BlendMode&           mode = state.blendMode;
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        pixel[i] = toComponent(blend(mode.colorEquation,
+                                     source[i],
+                                     destination[i],
+                                     factorValue(mode.colorSrcFactor, source, destination, i),
+                                     factorValue(mode.colorDstFactor, source, destination, i)));
+    }
+
+    pixel[3] = toComponent(blend(mode.alphaEquation,
+                                 source[3],
+                                 destination[3],
+                                 factorValue(mode.alphaSrcFactor, source, destination, 3),
+                                 factorValue(mode.alphaDstFactor, source, destination, 3)));
+}
+
+
+////////////////////////////////////////////////////////////
+const Image* SoftwareRasterizer::getTextureImage(const Texture& texture, std::uint64_t textureId)
+{
+    // The pixels are read back only when the texture contents changed since the last draw
+    if (const auto it = m_textures.find(&texture); (it != m_textures.end()) && (it->second.id == textureId))
+        return &it->second.image;
+
+    if (m_textures.size() >= maxCachedTextures)
+        m_textures.clear();
+
+    Image image = texture.copyToImage();
+    if ((image.getSize().x == 0) || (image.getSize().y == 0))
+    {
+        err() << "Failed to read the pixels of the texture, drawing it untextured" << std::endl;
+        m_textures.erase(&texture);
+        return nullptr;
+    }
+
+    CachedTexture& cached = m_textures[&texture];
+    cached.id             = textureId;
+    cached.image          = std::move(image);
+    return &cached.image;
+}
+
+} // namespace sf::priv
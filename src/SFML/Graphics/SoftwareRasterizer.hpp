@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/StencilMode.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+class Texture;
+struct RenderStates;
+struct Vertex;
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief CPU implementation of the RenderTarget pipeline
+///
+/// Owns a RGBA color buffer and an 8-bit stencil buffer, and
+/// rasterizes primitives into them the way OpenGL would:
+/// pixel centers sampling, top-left fill rule, half-open lines.
+///
+/// Large draws are split in horizontal tiles which are
+/// rasterized in parallel; since each pixel belongs to a
+/// single tile, the result doesn't depend on the thread count.
+///
+////////////////////////////////////////////////////////////
+class SoftwareRasterizer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the rasterizer
+    ///
+    /// The color buffer is initialized to transparent black,
+    /// and the stencil buffer to zero.
+    ///
+    /// \param size Size of the buffers, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SoftwareRasterizer(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffers
+    ///
+    /// \return Size in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of threads used by a draw
+    ///
+    /// \param count Number of threads, 0 is treated as 1
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreadCount(unsigned int count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of threads used by a draw
+    ///
+    /// \return Number of threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the color and/or stencil buffers
+    ///
+    /// Like `glClear`, clearing is restricted to the scissor
+    /// rectangle of the target's current view.
+    ///
+    /// \param target       Render target whose view is used
+    /// \param color        Clear color, or `std::nullopt` to keep the color buffer
+    /// \param stencilValue Clear value, or `std::nullopt` to keep the stencil buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear(const RenderTarget& target, std::optional<Color> color, std::optional<StencilValue> stencilValue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices
+    ///
+    /// \param target      Render target whose view is used
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param textureId   Cache identifier of the contents of `states.texture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const RenderTarget& target,
+              const Vertex*       vertices,
+              std::size_t         vertexCount,
+              PrimitiveType       type,
+              const RenderStates& states,
+              std::uint64_t       textureId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by indexed vertices
+    ///
+    /// \param target      Render target whose view is used
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexSize   Size of a single index, in bytes (2 or 4)
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param textureId   Cache identifier of the contents of `states.texture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexed(const RenderTarget& target,
+                     const Vertex*       vertices,
+                     std::size_t         vertexCount,
+                     const void*         indices,
+                     std::size_t         indexSize,
+                     std::size_t         indexCount,
+                     PrimitiveType       type,
+                     const RenderStates& states,
+                     std::uint64_t       textureId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only pointer to the color buffer
+    ///
+    /// \return Pointer to the RGBA pixels, top row first
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::uint8_t* getPixels() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertex transformed to pixel coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ScreenVertex
+    {
+        Vector2f             position;  //!< Position in pixels, top-left origin
+        std::array<float, 4> color{};   //!< Color components, in [0, 255]
+        Vector2f             texCoords; //!< Texture coordinates, in texels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief States shared by all the fragments of a draw
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DrawState
+    {
+        IntRect      clip;             //!< Writable pixels: viewport, scissor and buffer bounds intersection
+        BlendMode    blendMode;        //!< Blending mode
+        StencilMode  stencilMode;      //!< Stencil mode
+        bool         stencilEnabled{}; //!< Is the stencil test or update active?
+        const Image* texture{};        //!< Pixels of the texture, or `nullptr` if untextured
+        bool         smooth{};         //!< Use bilinear filtering?
+        bool         repeated{};       //!< Wrap texture coordinates instead of clamping them?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached copy of the pixels of a texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CachedTexture
+    {
+        std::uint64_t id{};  //!< Cache identifier of the texture contents the copy was made from
+        Image         image; //!< Copy of the pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize a slice of the primitives of a draw
+    ///
+    /// Only the rows of pixels belonging to tiles assigned to
+    /// `slice` are written.
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterize(const DrawState&                 state,
+                   const std::vector<ScreenVertex>& vertices,
+                   PrimitiveType                    type,
+                   int                              slice,
+                   int                              sliceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize the rows [rowBegin, rowEnd) of a triangle
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterizeTriangle(const DrawState&    state,
+                           const ScreenVertex& a,
+                           const ScreenVertex& b,
+                           const ScreenVertex& c,
+                           int                 rowBegin,
+                           int                 rowEnd);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize the pixels of a line belonging to tiles assigned to `slice`
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterizeLine(const DrawState& state, const ScreenVertex& a, const ScreenVertex& b, int slice, int sliceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute and write the color of a single pixel
+    ///
+    ////////////////////////////////////////////////////////////
+    void shade(const DrawState& state, int x, int y, const std::array<float, 4>& color, Vector2f texCoords);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a copy of the pixels of a texture, updating the cache if needed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Image* getTextureImage(const Texture& texture, std::uint64_t textureId);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u                                          m_size;           //!< Size of the buffers
+    std::vector<std::uint32_t>                        m_pixels;         //!< Color buffer, one RGBA pixel per element
+    std::vector<std::uint8_t>                         m_stencil;        //!< Stencil buffer
+    unsigned int                                      m_threadCount{1}; //!< Maximum number of threads per draw
+    std::unordered_map<const Texture*, CachedTexture> m_textures;       //!< Copies of the textures drawn so far
+};
+
+} // namespace priv
+
+} // namespace sf
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SoftwareRasterizer.hpp>
+#include <SFML/Graphics/SoftwareRenderTexture.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Exception.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <ostream>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SoftwareRenderTexture::SoftwareRenderTexture() = default;
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTexture::SoftwareRenderTexture(Vector2u size)
+{
+    if (!resize(size))
+        throw sf::Exception("Failed to create software render texture");
+}
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTexture::~SoftwareRenderTexture() = default;
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTexture::SoftwareRenderTexture(SoftwareRenderTexture&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTexture& SoftwareRenderTexture::operator=(SoftwareRenderTexture&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool SoftwareRenderTexture::resize(Vector2u size)
+{
+    if ((size.x == 0) || (size.y == 0))
+    {
+        err() << "Failed to create software render texture, invalid size (" << size.x << "x" << size.y << ")"
+              << std::endl;
+        return false;
+    }
+
+    m_rasterizer = std::make_unique<priv::SoftwareRasterizer>(size);
+    m_rasterizer->setThreadCount(m_threadCount);
+
+    // We can now initialize the render target part
+    RenderTarget::initialize();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTexture::setThreadCount(unsigned int count)
+{
+    m_threadCount = std::max(count, 1u);
+
+    if (m_rasterizer)
+        m_rasterizer->setThreadCount(m_threadCount);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoftwareRenderTexture::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SoftwareRenderTexture::getSize() const
+{
+    return m_rasterizer ? m_rasterizer->getSize() : Vector2u();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoftwareRenderTexture::setActive(bool /* active */)
+{
+    return m_rasterizer != nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+Image SoftwareRenderTexture::copyToImage() const
+{
+    if (!m_rasterizer)
+        return {};
+
+    return Image(getSize(), m_rasterizer->getPixels());
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* SoftwareRenderTexture::getPixelsPtr() const
+{
+    if (!m_rasterizer)
+        return nullptr;
+
+    return m_rasterizer->getPixels();
+}
+
+
+////////////////////////////////////////////////////////////
+priv::SoftwareRasterizer* SoftwareRenderTexture::getSoftwareRasterizer()
+{
+    return m_rasterizer.get();
+}
+
+} // namespace sf
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/StatesCache.hpp>
+
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace StatesCacheImpl
+{
+// Gives access to the registration of objects bound to the lifetime of a context
+class ContextBoundObject : sf::GlResource
+{
+public:
+    using GlResource::registerUnsharedGlObject;
+};
+
+// Mutex to protect the context-StatesCache-map
+std::mutex& getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Map to find the states cache of a context that has already been
+// used by SFML, possibly from another thread
+using ContextStatesCacheMap = std::unordered_map<std::uint64_t, std::weak_ptr<sf::priv::StatesCache>>;
+ContextStatesCacheMap& getContextStatesCacheMap()
+{
+    static ContextStatesCacheMap contextStatesCacheMap;
+    return contextStatesCacheMap;
+}
+
+// Last context used on this thread, and its states cache
+// Context IDs are never reused, so the pointer can't be
+// dereferenced after the context has been destroyed
+struct ThreadRecord
+{
+    std::uint64_t          contextId{};
+    sf::priv::StatesCache* statesCache{};
+};
+
+ThreadRecord& getThreadRecord()
+{
+    thread_local ThreadRecord threadRecord;
+    return threadRecord;
+}
+} // namespace StatesCacheImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+StatesCache* getActiveStatesCache()
+{
+    const std::uint64_t contextId = Context::getActiveContextId();
+
+    // No context, no cache
+    if (!contextId)
+        return nullptr;
+
+    // Fast path: same context as last time on this thread
+    StatesCacheImpl::ThreadRecord& threadRecord = StatesCacheImpl::getThreadRecord();
+    if (threadRecord.contextId == contextId)
+        return threadRecord.statesCache;
+
+    // Slow path: look the cache up, creating it if this is the first time the context is used
+    const std::lock_guard lock(StatesCacheImpl::getMutex());
+
+    auto& contextStatesCacheMap = StatesCacheImpl::getContextStatesCacheMap();
+    auto  statesCache           = contextStatesCacheMap[contextId].lock();
+
+    if (!statesCache)
+    {
+        // Forget about the caches of contexts that have been destroyed in the meantime
+        for (auto it = contextStatesCacheMap.begin(); it != contextStatesCacheMap.end();)
+        {
+            if (it->second.expired())
+                it = contextStatesCacheMap.erase(it);
+            else
+                ++it;
+        }
+
+        statesCache                      = std::make_shared<StatesCache>();
+        contextStatesCacheMap[contextId] = statesCache;
+
+        // Tie the lifetime of the cache to the context
+        StatesCacheImpl::ContextBoundObject::registerUnsharedGlObject(statesCache);
+    }
+
+    threadRecord.contextId   = contextId;
+    threadRecord.statesCache = statesCache.get();
+
+    return threadRecord.statesCache;
+}
+
+
+////////////////////////////////////////////////////////////
+GLStateShadow& getActiveGLStateShadow()
+{
+    if (StatesCache* statesCache = getActiveStatesCache())
+        return statesCache->glState;
+
+    // Without a context there is nothing to shadow, every change is issued
+    thread_local GLStateShadow untrustedShadow;
+    return untrustedShadow;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/GLStateShadow.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <array>
+#include <memory>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Render states cache of a single OpenGL context
+///
+/// All the render targets drawing within a context share its
+/// cache, so that activating another render target only has
+/// to re-apply the states that really belong to the target
+/// (view and sRGB encoding) instead of all of them.
+///
+/// The cache is destroyed together with its context, while
+/// the context is active, so it also owns the OpenGL objects
+/// that SFML creates for its own use in the context.
+///
+////////////////////////////////////////////////////////////
+struct StatesCache
+{
+    std::uint64_t         activeRenderTargetId{};  //!< RenderTarget currently active in the context, 0 if none
+    std::uint64_t         lastViewId{};            //!< Identifier of the last applied view
+    bool                  enable{};                //!< Is the cache enabled?
+    bool                  glStatesSet{};           //!< Are our internal GL states set yet?
+    bool                  renderTargetChanged{};   //!< Has another RenderTarget been activated since last draw?
+    BlendMode             lastBlendMode;           //!< Cached blending mode
+    StencilMode           lastStencilMode;         //!< Cached stencil
+    std::uint64_t         lastTextureId{};         //!< Cached texture
+    CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
+    bool                  texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
+    bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
+    std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
+    GLStateShadow         glState;                 //!< Shadow of the raw OpenGL states
+
+    std::unique_ptr<Shader> texturedInstancingShader;   //!< Built-in shader of textured instanced draws
+    std::unique_ptr<Shader> untexturedInstancingShader; //!< Built-in shader of untextured instanced draws
+    bool                    instancingShadersLoaded{};  //!< Has loading the built-in instancing shaders been attempted?
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the states cache of the context active on the calling thread
+///
+/// The cache is created the first time a context asks for
+/// it and is destroyed together with the context. The lookup
+/// is lock-free as long as the calling thread keeps using
+/// the same context.
+///
+/// \return Pointer to the states cache, or `nullptr` if no context is active
+///
+////////////////////////////////////////////////////////////
+StatesCache* getActiveStatesCache();
+
+////////////////////////////////////////////////////////////
+/// \brief Get the OpenGL state shadow of the context active on the calling thread
+///
+/// If no context is active, an untrusted shadow is returned
+/// so that every state change is issued.
+///
+/// \return Reference to the OpenGL state shadow
+///
+////////////////////////////////////////////////////////////
+GLStateShadow& getActiveGLStateShadow();
+
+} // namespace sf::priv
@@ -92,13 +92,42 @@ m_characterSize(characterSize)
 }
 
 
+////////////////////////////////////////////////////////////
+Text::Text(const Font& font, U8StringView string, unsigned int characterSize) :
+m_utf8String(string),
+m_isUtf8(true),
+m_stringNeedConversion(true),
+m_font(&font),
+m_characterSize(characterSize)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setString(const String& string)
 {
-    if (m_string != string)
+    if (m_isUtf8 || (m_string != string))
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        m_string = string;
+        m_utf8String.clear();
+        m_isUtf8               = false;
+        m_stringNeedConversion = true;
+        m_geometryNeedUpdate   = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setString(U8StringView string)
+{
+    if (!m_isUtf8 || (U8StringView(m_utf8String) != string))
+    {
+        // Assigning reuses the storage of the previous string when it is large enough
+        m_utf8String.assign(string);
+        m_string.clear();
+        m_isUtf8               = true;
+        m_stringNeedConversion = true;
+        m_geometryNeedUpdate   = true;
     }
 }
 
@@ -208,10 +237,29 @@ void Text::setOutlineThickness(float thickness)
 ////////////////////////////////////////////////////////////
 const String& Text::getString() const
 {
+    if (m_isUtf8 && m_stringNeedConversion)
+    {
+        m_string               = String::fromUtf8(m_utf8String);
+        m_stringNeedConversion = false;
+    }
+
     return m_string;
 }
 
 
+////////////////////////////////////////////////////////////
+U8StringView Text::getUtf8String() const
+{
+    if (!m_isUtf8 && m_stringNeedConversion)
+    {
+        m_utf8String           = m_string.toUtf8();
+        m_stringNeedConversion = false;
+    }
+
+    return m_utf8String;
+}
+
+
 ////////////////////////////////////////////////////////////
 const Font& Text::getFont() const
 {
@@ -271,9 +319,6 @@ float Text::getOutlineThickness() const
 ////////////////////////////////////////////////////////////
 Vector2f Text::findCharacterPos(std::size_t index) const
 {
-    // Adjust the index if it's out of range
-    index = std::min(index, m_string.getSize());
-
     // Precompute the variables needed by the algorithm
     const bool  isBold          = m_style & Bold;
     float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
@@ -281,13 +326,12 @@ Vector2f Text::findCharacterPos(std::size_t index) const
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
 
-    // Compute the position
+    // Compute the position, an index out of range stops at the end of the string
     Vector2f      position;
     std::uint32_t prevChar = 0;
-    for (std::size_t i = 0; i < index; ++i)
-    {
-        const std::uint32_t curChar = m_string[i];
 
+    const auto advance = [&](const std::uint32_t curChar)
+    {
         // Apply the kerning offset
         position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
         prevChar = curChar;
@@ -297,19 +341,20 @@ Vector2f Text::findCharacterPos(std::size_t index) const
         {
             case U' ':
                 position.x += whitespaceWidth;
-                continue;
+                return;
             case U'\t':
                 position.x += whitespaceWidth * 4;
-                continue;
+                return;
             case U'\n':
                 position.y += lineSpacing;
                 position.x = 0;
-                continue;
+                return;
         }
 
         // For regular characters, add the advance offset of the glyph
         position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance + letterSpacing;
-    }
+    };
+    forEachCharacter(index, advance);
 
     // Transform the position to global coordinates
     return getTransform().transformPoint(position);
@@ -349,6 +394,38 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> Text::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename F>
+void Text::forEachCharacter(std::size_t count, F function) const
+{
+    if (m_isUtf8)
+    {
+        // Decode the UTF-8 string on the fly, without converting it first
+        const std::uint8_t* begin = m_utf8String.data();
+        const std::uint8_t* end   = begin + m_utf8String.size();
+        for (; (begin != end) && (count > 0); --count)
+        {
+            char32_t character = 0;
+            begin              = Utf8::decode(begin, end, character);
+            function(character);
+        }
+    }
+    else
+    {
+        count = std::min(count, m_string.getSize());
+        for (std::size_t i = 0; i < count; ++i)
+            function(m_string[i]);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
@@ -368,7 +445,7 @@ void Text::ensureGeometryUpdate() const
     m_bounds = FloatRect();
 
     // No text: nothing to draw
-    if (m_string.isEmpty())
+    if (m_isUtf8 ? m_utf8String.empty() : m_string.isEmpty())
         return;
 
     // Compute values related to the text style
@@ -398,11 +475,12 @@ void Text::ensureGeometryUpdate() const
     float         maxX     = 0.f;
     float         maxY     = 0.f;
     std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+
+    const auto addCharacter = [&](const std::uint32_t curChar)
     {
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
-            continue;
+            return;
 
         // Apply the kerning offset
         x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
@@ -453,7 +531,7 @@ void Text::ensureGeometryUpdate() const
             maxY = std::max(maxY, y);
 
             // Next glyph, no need to create a quad for whitespace
-            continue;
+            return;
         }
 
         // Apply the outline
@@ -482,7 +560,8 @@ void Text::ensureGeometryUpdate() const
 
         // Advance to the next character
         x += glyph.advance + letterSpacing;
-    }
+    };
+    forEachCharacter(String::InvalidPos, addCharacter);
 
     // If we're using outline, update the current bounds
     if (m_outlineThickness != 0)
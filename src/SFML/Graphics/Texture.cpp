@@ -28,6 +28,7 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/StatesCache.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
@@ -927,6 +928,13 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
         assert((glIsTexture(texture->m_texture) == GL_TRUE) &&
                "Texture to be bound is invalid, check if the texture is still being used after it has been destroyed");
 
+        // Nothing to do if the texture is already bound the same way to the active texture unit
+        // Textures attached to a framebuffer object are always bound again, in order to inform the
+        // OpenGL driver that we want changes made to them in other contexts to be visible here as well
+        if (!priv::getActiveGLStateShadow().changeTextureBinding({texture->m_cacheId, coordinateType, texture->m_pixelsFlipped},
+                                                                 texture->m_fboAttachment))
+            return;
+
         // Bind the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, texture->m_texture));
 
@@ -971,6 +979,10 @@ void Texture::bind(const Texture* texture, CoordinateType coordinateType)
     }
     else
     {
+        // Nothing to do if no texture is already bound to the active texture unit
+        if (!priv::getActiveGLStateShadow().changeTextureBinding({}))
+            return;
+
         // Bind no texture
         glCheck(glBindTexture(GL_TEXTURE_2D, 0));
 
@@ -0,0 +1,381 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Texture& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize) :
+TileMap(tileSize, mapSize, chunkSize)
+{
+    m_tileset = &tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Image& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize) :
+TileMap(tileSize, mapSize, chunkSize)
+{
+    m_tilesetImage = &tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap(Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize) :
+m_tileSize(tileSize),
+m_mapSize(mapSize),
+m_chunkSize(std::clamp(chunkSize, 1u, MaxChunkSize)),
+m_chunkCount((mapSize.x + m_chunkSize - 1) / m_chunkSize, (mapSize.y + m_chunkSize - 1) / m_chunkSize),
+m_tiles(std::size_t{mapSize.x} * mapSize.y, EmptyTile),
+m_chunks(std::size_t{m_chunkCount.x} * m_chunkCount.y)
+{
+    // All the chunks share the same triangles, two for each tile
+    const std::size_t quadCount = std::size_t{m_chunkSize} * m_chunkSize;
+    m_indices.reserve(quadCount * 6);
+
+    for (std::size_t i = 0; i < quadCount; ++i)
+    {
+        const auto first = static_cast<std::uint16_t>(i * 4);
+        for (const int corner : {0, 1, 2, 1, 3, 2})
+            m_indices.push_back(static_cast<std::uint16_t>(first + corner));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileset(const Texture& tileset)
+{
+    m_tileset      = &tileset;
+    m_tilesetImage = nullptr;
+
+    // Texture coordinates depend on the size of the tileset
+    for (Chunk& chunk : m_chunks)
+        chunk.dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTileset(const Image& tileset)
+{
+    m_tileset      = nullptr;
+    m_tilesetImage = &tileset;
+
+    for (Chunk& chunk : m_chunks)
+        chunk.dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TileMap::getTileset() const
+{
+    assert(m_tileset && "TileMap::getTileset() The tileset is an image");
+    return *m_tileset;
+}
+
+
+////////////////////////////////////////////////////////////
+const Image* TileMap::getTilesetImage() const
+{
+    return m_tilesetImage;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(Vector2u position, Tile tile)
+{
+    assert(position.x < m_mapSize.x && "TileMap::setTile() position.x is out of bounds");
+    assert(position.y < m_mapSize.y && "TileMap::setTile() position.y is out of bounds");
+
+    Tile& current = m_tiles[std::size_t{position.y} * m_mapSize.x + position.x];
+    if (current != tile)
+    {
+        current                   = tile;
+        getChunk(position).dirty = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTiles(Vector2u position, Vector2u size, const Tile* tiles)
+{
+    assert(position.x + size.x <= m_mapSize.x && "TileMap::setTiles() area is out of bounds");
+    assert(position.y + size.y <= m_mapSize.y && "TileMap::setTiles() area is out of bounds");
+    assert((tiles || size.x == 0 || size.y == 0) && "TileMap::setTiles() tiles must not be null");
+
+    for (unsigned int y = 0; y < size.y; ++y)
+    {
+        for (unsigned int x = 0; x < size.x; ++x)
+            setTile(position + Vector2u(x, y), tiles[std::size_t{y} * size.x + x]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::fill(Tile tile)
+{
+    std::fill(m_tiles.begin(), m_tiles.end(), tile);
+
+    for (Chunk& chunk : m_chunks)
+        chunk.dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::Tile TileMap::getTile(Vector2u position) const
+{
+    assert(position.x < m_mapSize.x && "TileMap::getTile() position.x is out of bounds");
+    assert(position.y < m_mapSize.y && "TileMap::getTile() position.y is out of bounds");
+
+    return m_tiles[std::size_t{position.y} * m_mapSize.x + position.x];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getMapSize() const
+{
+    return m_mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getDirtyChunkCount() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_chunks.begin(), m_chunks.end(), [](const Chunk& chunk) { return chunk.dirty; }));
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return {{0.f, 0.f}, Vector2f(m_mapSize.componentWiseMul(m_tileSize))};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_chunks.empty() || (m_tileSize.x == 0) || (m_tileSize.y == 0))
+        return;
+
+    states.transform *= getTransform();
+    states.texture        = m_tileset;
+    states.coordinateType = CoordinateType::Pixels;
+    states.image          = m_tilesetImage;
+
+    // Find the area of the map seen by the view, in local coordinates
+    const Transform toLocal = states.transform.getInverse() * target.getView().getInverseTransform();
+    const FloatRect area    = toLocal.transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+
+    // Skip the whole map if it's out of sight
+    if (!area.findIntersection(getLocalBounds()).has_value())
+        return;
+
+    // Convert the area to a range of chunks
+    const Vector2f chunkSize(m_tileSize * m_chunkSize);
+    const auto     toChunk = [](float coordinate, float size, unsigned int count)
+    {
+        const float chunk = std::clamp(std::floor(coordinate / size), 0.f, static_cast<float>(count - 1));
+        return static_cast<unsigned int>(chunk);
+    };
+
+    const Vector2f areaEnd = area.position + area.size;
+    const Vector2u first(toChunk(area.position.x, chunkSize.x, m_chunkCount.x),
+                         toChunk(area.position.y, chunkSize.y, m_chunkCount.y));
+    const Vector2u last(toChunk(areaEnd.x, chunkSize.x, m_chunkCount.x),
+                        toChunk(areaEnd.y, chunkSize.y, m_chunkCount.y));
+
+    // Upload the shared indices the first time the map is drawn by OpenGL; targets
+    // drawn on the CPU can't use buffers, the geometry is then kept on the CPU
+    const bool software = target.isSoftware();
+    if (!software && !m_indexBuffer && VertexBuffer::isAvailable() && IndexBuffer::isAvailable())
+    {
+        m_indexBuffer.emplace();
+        if (!m_indexBuffer->create(m_indices.size()) || !m_indexBuffer->update(m_indices.data(), m_indices.size()))
+            *m_indexBuffer = IndexBuffer();
+    }
+
+    const bool useBuffers = !software && m_indexBuffer && (m_indexBuffer->getIndexCount() != 0);
+
+    for (unsigned int y = first.y; y <= last.y; ++y)
+    {
+        for (unsigned int x = first.x; x <= last.x; ++x)
+        {
+            Chunk& chunk = m_chunks[std::size_t{y} * m_chunkCount.x + x];
+
+            // Chunks baked into a vertex buffer are rebuilt on the CPU when a software target draws them
+            if (chunk.dirty || (!useBuffers && (chunk.vertices.size() != chunk.quadCount * 4)))
+                bakeChunk(chunk, {x, y}, useBuffers);
+
+            if (chunk.quadCount == 0)
+                continue;
+
+            if (chunk.vertices.empty())
+            {
+                target.draw(*chunk.vertexBuffer, *m_indexBuffer, 0, chunk.quadCount * 6, states);
+            }
+            else
+            {
+                target.draw(chunk.vertices.data(),
+                            chunk.vertices.size(),
+                            m_indices.data(),
+                            chunk.quadCount * 6,
+                            PrimitiveType::Triangles,
+                            states);
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> TileMap::getCullingBounds() const
+{
+    return getGlobalBounds();
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::Chunk& TileMap::getChunk(Vector2u position)
+{
+    return m_chunks[std::size_t{position.y / m_chunkSize} * m_chunkCount.x + position.x / m_chunkSize];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTilesetSize() const
+{
+    return m_tileset ? m_tileset->getSize() : m_tilesetImage->getSize();
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::bakeChunk(Chunk& chunk, Vector2u position, bool upload) const
+{
+    std::vector<Vertex>& vertices = chunk.vertices;
+    vertices.clear();
+
+    // Tiles are laid out in rows in the tileset
+    const Vector2u     tilesetSize = getTilesetSize();
+    const unsigned int tilesPerRow = tilesetSize.x / m_tileSize.x;
+    const Vector2u     first       = position * m_chunkSize;
+    const Vector2u     last(std::min(first.x + m_chunkSize, m_mapSize.x), std::min(first.y + m_chunkSize, m_mapSize.y));
+    const Vector2f     size(m_tileSize);
+
+    for (unsigned int y = first.y; (y < last.y) && (tilesPerRow > 0); ++y)
+    {
+        for (unsigned int x = first.x; x < last.x; ++x)
+        {
+            const Tile tile = m_tiles[std::size_t{y} * m_mapSize.x + x];
+            if (tile == EmptyTile)
+                continue;
+
+            const Vector2f topLeft(Vector2u(x, y).componentWiseMul(m_tileSize));
+            const Vector2f texCoords(Vector2u(tile % tilesPerRow, tile / tilesPerRow).componentWiseMul(m_tileSize));
+
+            vertices.push_back({topLeft, Color::White, texCoords});
+            vertices.push_back({topLeft + Vector2f(size.x, 0.f), Color::White, texCoords + Vector2f(size.x, 0.f)});
+            vertices.push_back({topLeft + Vector2f(0.f, size.y), Color::White, texCoords + Vector2f(0.f, size.y)});
+            vertices.push_back({topLeft + size, Color::White, texCoords + size});
+        }
+    }
+
+    chunk.quadCount = vertices.size() / 4;
+    chunk.dirty     = false;
+
+    // Move the geometry to video memory if possible, otherwise keep it on the CPU
+    if (vertices.empty() || !upload)
+        return;
+
+    // Tiles are untinted and their texture coordinates are whole texels, so they are baked
+    // as 12-byte compact vertices, unless the tileset is too large for 16-bit coordinates
+    const bool compact = (tilesetSize.x <= INT16_MAX) && (tilesetSize.y <= INT16_MAX);
+
+    if (!chunk.vertexBuffer)
+        chunk.vertexBuffer.emplace(PrimitiveType::Triangles, VertexBuffer::Usage::Static);
+
+    VertexBuffer& vertexBuffer = *chunk.vertexBuffer;
+    if (vertexBuffer.getNativeHandle() == 0)
+    {
+        if (!vertexBuffer.setLayout(compact ? VertexLayout::Compact : VertexLayout::Default) ||
+            !vertexBuffer.create(vertices.size()))
+            return;
+    }
+
+    if (vertexBuffer.getLayout() == VertexLayout::Compact)
+    {
+        std::vector<CompactVertex> compactVertices;
+        compactVertices.reserve(vertices.size());
+        for (const Vertex& vertex : vertices)
+            compactVertices.push_back({vertex.position, Vector2<std::int16_t>(vertex.texCoords)});
+
+        if (!vertexBuffer.update(compactVertices.data(), compactVertices.size(), 0))
+            return;
+    }
+    else if (!vertexBuffer.update(vertices.data(), vertices.size(), 0))
+    {
+        return;
+    }
+
+    vertices.clear();
+    vertices.shrink_to_fit();
+}
+
+} // namespace sf
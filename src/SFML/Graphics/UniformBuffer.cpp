@@ -0,0 +1,597 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <ostream>
+#include <utility>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace UniformBufferImpl
+{
+// In the std140 layout, array elements and matrix columns are aligned to the size of a vec4
+constexpr std::size_t vec4Size = 4 * sizeof(float);
+
+GLenum usageToGlEnum(sf::UniformBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::UniformBuffer::Usage::Static:
+            return GLEXT_GL_STATIC_DRAW;
+        case sf::UniformBuffer::Usage::Dynamic:
+            return GLEXT_GL_DYNAMIC_DRAW;
+        default:
+            return GLEXT_GL_STREAM_DRAW;
+    }
+}
+
+// Base alignment and size of a block member, as defined by the std140 layout
+struct MemberLayout
+{
+    std::size_t alignment;
+    std::size_t size;
+};
+
+MemberLayout getMemberLayout(sf::UniformBuffer::Layout::Type type)
+{
+    using Type = sf::UniformBuffer::Layout::Type;
+
+    switch (type)
+    {
+        case Type::Vec2:
+        case Type::Ivec2:
+        case Type::Bvec2:
+            return {2 * sizeof(float), 2 * sizeof(float)};
+        case Type::Vec3:
+        case Type::Ivec3:
+        case Type::Bvec3:
+            return {vec4Size, 3 * sizeof(float)};
+        case Type::Vec4:
+        case Type::Ivec4:
+        case Type::Bvec4:
+            return {vec4Size, vec4Size};
+        case Type::Mat3:
+            return {vec4Size, 3 * vec4Size};
+        case Type::Mat4:
+            return {vec4Size, 4 * vec4Size};
+        default:
+            return {sizeof(float), sizeof(float)};
+    }
+}
+
+constexpr std::size_t alignUp(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Columns of a mat3 are padded to the size of a vec4
+std::array<float, 12> padMatrix(const sf::Glsl::Mat3& matrix)
+{
+    std::array<float, 12> padded{};
+    for (std::size_t column = 0; column < 3; ++column)
+        std::copy_n(&matrix.array[column * 3], 3, &padded[column * 4]);
+
+    return padded;
+}
+
+// Thread-safe unique identifier generator,
+// is used for the OpenGL state shadow (see GLStateShadow)
+std::uint64_t getUniqueId() noexcept
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no buffer"
+
+    return id.fetch_add(1);
+}
+} // namespace UniformBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::Layout::add(Type type)
+{
+    const auto [alignment, size] = UniformBufferImpl::getMemberLayout(type);
+
+    const std::size_t offset = UniformBufferImpl::alignUp(m_size, alignment);
+    m_size                   = offset + size;
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::Layout::addArray(Type type, std::size_t length)
+{
+    using UniformBufferImpl::vec4Size;
+
+    const std::size_t stride = UniformBufferImpl::alignUp(UniformBufferImpl::getMemberLayout(type).size, vec4Size);
+
+    const std::size_t offset = UniformBufferImpl::alignUp(m_size, vec4Size);
+    m_size                   = offset + stride * length;
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::Layout::getSize() const
+{
+    // The size of a block is rounded up to the size of a vec4, like structures
+    return UniformBufferImpl::alignUp(m_size, UniformBufferImpl::vec4Size);
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(Usage usage) : m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(UniformBuffer&& source) noexcept :
+m_buffer(std::exchange(source.m_buffer, 0u)),
+m_cacheId(std::exchange(source.m_cacheId, 0u)),
+m_data(std::move(source.m_data)),
+m_dirtyBegin(std::exchange(source.m_dirtyBegin, 0u)),
+m_dirtyEnd(std::exchange(source.m_dirtyEnd, 0u)),
+m_usage(source.m_usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(UniformBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+
+    m_buffer     = std::exchange(right.m_buffer, 0u);
+    m_cacheId    = std::exchange(right.m_cacheId, 0u);
+    m_data       = std::move(right.m_data);
+    m_dirtyBegin = std::exchange(right.m_dirtyBegin, 0u);
+    m_dirtyEnd   = std::exchange(right.m_dirtyEnd, 0u);
+    m_usage      = right.m_usage;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::create(std::size_t size)
+{
+    if (!isAvailable())
+        return false;
+
+    const TransientContextLock contextLock;
+
+    if (!m_buffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+        m_cacheId = UniformBufferImpl::getUniqueId();
+    }
+
+    if (!m_buffer)
+    {
+        err() << "Could not create uniform buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    m_data.assign(size, 0);
+    m_dirtyBegin = 0;
+    m_dirtyEnd   = 0;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_UNIFORM_BUFFER,
+                               static_cast<GLsizeiptrARB>(size),
+                               m_data.data(),
+                               UniformBufferImpl::usageToGlEnum(m_usage)));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getSize() const
+{
+    return m_data.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* UniformBuffer::getData() const
+{
+    return m_data.data();
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t size, std::size_t offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!data)
+        return false;
+
+    if (!write(offset, data, size))
+        return false;
+
+    uploadDirtyRange();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, float x)
+{
+    return write(offset, &x, sizeof(x));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, Glsl::Vec2 v)
+{
+    const std::array values{v.x, v.y};
+    return write(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Vec3& v)
+{
+    const std::array values{v.x, v.y, v.z};
+    return write(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Vec4& v)
+{
+    const std::array values{v.x, v.y, v.z, v.w};
+    return write(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, int x)
+{
+    return write(offset, &x, sizeof(x));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, Glsl::Ivec2 v)
+{
+    const std::array values{v.x, v.y};
+    return write(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Ivec3& v)
+{
+    const std::array values{v.x, v.y, v.z};
+    return write(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Ivec4& v)
+{
+    const std::array values{v.x, v.y, v.z, v.w};
+    return write(offset, values.data(), sizeof(values));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, bool x)
+{
+    // Booleans are stored as 32-bit integers in the std140 layout
+    return set(offset, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, Glsl::Bvec2 v)
+{
+    return set(offset, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Bvec3& v)
+{
+    return set(offset, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Bvec4& v)
+{
+    return set(offset, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Mat3& matrix)
+{
+    const std::array<float, 12> padded = UniformBufferImpl::padMatrix(matrix);
+    return write(offset, padded.data(), sizeof(padded));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::set(std::size_t offset, const Glsl::Mat4& matrix)
+{
+    return write(offset, matrix.array.data(), sizeof(matrix.array));
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::setArray(std::size_t offset, const float* scalarArray, std::size_t length)
+{
+    // std140 arrays occupy a full stride per element; check them as a whole so that nothing is partially written
+    if (!checkRange(offset, length * UniformBufferImpl::vec4Size))
+        return false;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (!set(offset + i * UniformBufferImpl::vec4Size, scalarArray[i]))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::setArray(std::size_t offset, const Glsl::Vec2* vectorArray, std::size_t length)
+{
+    if (!checkRange(offset, length * UniformBufferImpl::vec4Size))
+        return false;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (!set(offset + i * UniformBufferImpl::vec4Size, vectorArray[i]))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::setArray(std::size_t offset, const Glsl::Vec3* vectorArray, std::size_t length)
+{
+    if (!checkRange(offset, length * UniformBufferImpl::vec4Size))
+        return false;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (!set(offset + i * UniformBufferImpl::vec4Size, vectorArray[i]))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::setArray(std::size_t offset, const Glsl::Vec4* vectorArray, std::size_t length)
+{
+    if (!checkRange(offset, length * UniformBufferImpl::vec4Size))
+        return false;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (!set(offset + i * UniformBufferImpl::vec4Size, vectorArray[i]))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::setArray(std::size_t offset, const Glsl::Mat3* matrixArray, std::size_t length)
+{
+    if (!checkRange(offset, length * 3 * UniformBufferImpl::vec4Size))
+        return false;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (!set(offset + i * 3 * UniformBufferImpl::vec4Size, matrixArray[i]))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::setArray(std::size_t offset, const Glsl::Mat4* matrixArray, std::size_t length)
+{
+    if (!checkRange(offset, length * 4 * UniformBufferImpl::vec4Size))
+        return false;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (!set(offset + i * 4 * UniformBufferImpl::vec4Size, matrixArray[i]))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::upload()
+{
+    if (!m_buffer)
+        return false;
+
+    uploadDirtyRange();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::setUsage(Usage usage)
+{
+    m_usage = usage;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::Usage UniformBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::isAvailable()
+{
+    static const bool available = []
+    {
+        // Uniform blocks are only accessible through shaders
+        if (!Shader::isAvailable())
+            return false;
+
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_uniform_buffer_object != 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::checkRange(std::size_t offset, std::size_t size) const
+{
+    // Written this way so that huge offsets and sizes can't overflow
+    if ((offset > m_data.size()) || (size > m_data.size() - offset))
+    {
+        err() << "Failed to write to uniform buffer (range " << offset << "+" << size
+              << " is out of the buffer's " << m_data.size() << " bytes)" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::write(std::size_t offset, const void* data, std::size_t size)
+{
+    if (!checkRange(offset, size))
+        return false;
+
+    std::memcpy(m_data.data() + offset, data, size);
+
+    // Grow the range of bytes to upload
+    if (m_dirtyBegin == m_dirtyEnd)
+    {
+        m_dirtyBegin = offset;
+        m_dirtyEnd   = offset + size;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, offset);
+        m_dirtyEnd   = std::max(m_dirtyEnd, offset + size);
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::uploadDirtyRange()
+{
+    if (m_dirtyBegin == m_dirtyEnd)
+        return;
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_UNIFORM_BUFFER,
+                                  static_cast<GLintptrARB>(m_dirtyBegin),
+                                  static_cast<GLsizeiptrARB>(m_dirtyEnd - m_dirtyBegin),
+                                  m_data.data() + m_dirtyBegin));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_UNIFORM_BUFFER, 0));
+
+    m_dirtyBegin = 0;
+    m_dirtyEnd   = 0;
+}
+
+} // namespace sf
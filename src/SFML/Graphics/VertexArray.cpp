@@ -50,6 +50,7 @@ std::size_t VertexArray::getVertexCount() const
 Vertex& VertexArray::operator[](std::size_t index)
 {
     assert(index < m_vertices.size() && "Index is out of bounds");
+    m_cullingBounds.reset();
     return m_vertices[index];
 }
 
@@ -66,6 +67,7 @@ const Vertex& VertexArray::operator[](std::size_t index) const
 void VertexArray::clear()
 {
     m_vertices.clear();
+    m_cullingBounds.reset();
 }
 
 
@@ -73,6 +75,7 @@ void VertexArray::clear()
 void VertexArray::resize(std::size_t vertexCount)
 {
     m_vertices.resize(vertexCount);
+    m_cullingBounds.reset();
 }
 
 
@@ -80,6 +83,7 @@ void VertexArray::resize(std::size_t vertexCount)
 void VertexArray::append(const Vertex& vertex)
 {
     m_vertices.push_back(vertex);
+    m_cullingBounds.reset();
 }
 
 
@@ -139,4 +143,15 @@ void VertexArray::draw(RenderTarget& target, RenderStates states) const
         target.draw(m_vertices.data(), m_vertices.size(), m_primitiveType, states);
 }
 
+
+////////////////////////////////////////////////////////////
+std::optional<FloatRect> VertexArray::getCullingBounds() const
+{
+    // Culling may test the same unchanged array every frame, so its bounds are kept until a write access
+    if (!m_cullingBounds)
+        m_cullingBounds = getBounds();
+
+    return m_cullingBounds;
+}
+
 } // namespace sf
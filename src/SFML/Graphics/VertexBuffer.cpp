@@ -28,14 +28,17 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/StatesCache.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <SFML/System/Err.hpp>
 
+#include <atomic>
 #include <ostream>
 #include <utility>
 
+#include <cassert>
 #include <cstddef>
 #include <cstring>
 
@@ -57,6 +60,15 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
             return GLEXT_GL_STREAM_DRAW;
     }
 }
+
+// Thread-safe unique identifier generator,
+// is used for the OpenGL state shadow (see GLStateShadow)
+std::uint64_t getUniqueId() noexcept
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no buffer"
+
+    return id.fetch_add(1);
+}
 } // namespace VertexBufferImpl
 } // namespace
 
@@ -85,8 +97,11 @@ VertexBuffer::VertexBuffer(PrimitiveType type, Usage usage) : m_primitiveType(ty
 VertexBuffer::VertexBuffer(const VertexBuffer& copy) :
 GlResource(copy),
 m_primitiveType(copy.m_primitiveType),
-m_usage(copy.m_usage)
+m_usage(copy.m_usage),
+m_layout(copy.m_layout)
 {
+    assert(!copy.m_mapped && "VertexBuffer::VertexBuffer() cannot copy a mapped vertex buffer");
+
     if (copy.m_buffer && copy.m_size)
     {
         if (!create(copy.m_size))
@@ -122,7 +137,10 @@ bool VertexBuffer::create(std::size_t vertexCount)
     const TransientContextLock contextLock;
 
     if (!m_buffer)
+    {
         glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+        m_cacheId = VertexBufferImpl::getUniqueId();
+    }
 
     if (!m_buffer)
     {
@@ -130,14 +148,18 @@ bool VertexBuffer::create(std::size_t vertexCount)
         return false;
     }
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
+    glState.bindArrayBuffer(m_buffer, m_cacheId);
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                               static_cast<GLsizeiptrARB>(m_layout.stride * vertexCount),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    glState.bindArrayBuffer(0, 0);
 
-    m_size = vertexCount;
+    // Reallocating the storage of a mapped buffer unmaps it
+    m_size   = vertexCount;
+    m_mapped = false;
 
     return true;
 }
@@ -159,9 +181,22 @@ bool VertexBuffer::update(const Vertex* vertices)
 
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset)
+{
+    if (m_layout != VertexLayout::Default)
+    {
+        err() << "Could not update vertex buffer, its layout doesn't match sf::Vertex" << std::endl;
+        return false;
+    }
+
+    return update(static_cast<const void*>(vertices), vertexCount, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const void* vertices, std::size_t vertexCount, unsigned int offset)
 {
     // Sanity checks
-    if (!m_buffer)
+    if (!m_buffer || m_mapped)
         return false;
 
     if (!vertices)
@@ -172,13 +207,15 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     const TransientContextLock contextLock;
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
+    glState.bindArrayBuffer(m_buffer, m_cacheId);
 
     // Check if we need to resize or orphan the buffer
     if (vertexCount >= m_size)
     {
         glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                   static_cast<GLsizeiptrARB>(m_layout.stride * vertexCount),
                                    nullptr,
                                    VertexBufferImpl::usageToGlEnum(m_usage)));
 
@@ -186,11 +223,11 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
     }
 
     glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                  static_cast<GLintptrARB>(m_layout.stride * offset),
+                                  static_cast<GLsizeiptrARB>(m_layout.stride * vertexCount),
                                   vertices));
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    glState.bindArrayBuffer(0, 0);
 
     return true;
 }
@@ -205,9 +242,15 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
 #else
 
-    if (!m_buffer || !vertexBuffer.m_buffer)
+    if (!m_buffer || !vertexBuffer.m_buffer || m_mapped || vertexBuffer.m_mapped)
         return false;
 
+    if (m_layout != vertexBuffer.m_layout)
+    {
+        err() << "Could not copy vertex buffer, layouts don't match" << std::endl;
+        return false;
+    }
+
     const TransientContextLock contextLock;
 
     // Make sure that extensions are initialized
@@ -222,7 +265,7 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
                                           GLEXT_GL_COPY_WRITE_BUFFER,
                                           0,
                                           0,
-                                          static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
+                                          static_cast<GLsizeiptr>(m_layout.stride * vertexBuffer.m_size)));
 
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
@@ -230,27 +273,29 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
         return true;
     }
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
+    glState.bindArrayBuffer(m_buffer, m_cacheId);
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
+                               static_cast<GLsizeiptrARB>(m_layout.stride * vertexBuffer.m_size),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
 
     void* const destination = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_WRITE_ONLY));
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, vertexBuffer.m_buffer));
+    glState.bindArrayBuffer(vertexBuffer.m_buffer, vertexBuffer.m_cacheId);
 
     const void* const source = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
 
-    std::memcpy(destination, source, sizeof(Vertex) * vertexBuffer.m_size);
+    std::memcpy(destination, source, m_layout.stride * vertexBuffer.m_size);
 
     const GLboolean sourceResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    glState.bindArrayBuffer(m_buffer, m_cacheId);
 
     const GLboolean destinationResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    glState.bindArrayBuffer(0, 0);
 
     return (sourceResult == GL_TRUE) && (destinationResult == GL_TRUE);
 
@@ -258,6 +303,98 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 }
 
 
+////////////////////////////////////////////////////////////
+Vertex* VertexBuffer::map()
+{
+#ifdef SFML_OPENGL_ES
+
+    err() << "Could not map vertex buffer, mapping is not supported with OpenGL ES" << std::endl;
+    return nullptr;
+
+#else
+
+    if (!m_buffer || !m_size || m_mapped)
+        return nullptr;
+
+    if (m_layout != VertexLayout::Default)
+    {
+        err() << "Could not map vertex buffer, its layout doesn't match sf::Vertex" << std::endl;
+        return nullptr;
+    }
+
+    const TransientContextLock contextLock;
+
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
+    glState.bindArrayBuffer(m_buffer, m_cacheId);
+
+    GLenum access = GLEXT_GL_READ_WRITE;
+
+    // Orphan stream buffers, so that the driver doesn't have to
+    // wait for pending draws to finish using the previous contents
+    if (m_usage == Usage::Stream)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(m_layout.stride * m_size),
+                                   nullptr,
+                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+
+        access = GLEXT_GL_WRITE_ONLY;
+    }
+
+    void* const vertices = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, access));
+
+    glState.bindArrayBuffer(0, 0);
+
+    if (!vertices)
+    {
+        err() << "Could not map vertex buffer" << std::endl;
+        return nullptr;
+    }
+
+    m_mapped = true;
+
+    return static_cast<Vertex*>(vertices);
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::unmap()
+{
+#ifdef SFML_OPENGL_ES
+
+    return false;
+
+#else
+
+    if (!m_mapped)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    priv::GLStateShadow& glState = priv::getActiveGLStateShadow();
+
+    glState.bindArrayBuffer(m_buffer, m_cacheId);
+    const GLboolean result = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
+    glState.bindArrayBuffer(0, 0);
+
+    m_mapped = false;
+
+    return result == GL_TRUE;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::isMapped() const
+{
+    return m_mapped;
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 {
@@ -274,8 +411,11 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
 {
     std::swap(m_size, right.m_size);
     std::swap(m_buffer, right.m_buffer);
+    std::swap(m_cacheId, right.m_cacheId);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_mapped, right.m_mapped);
+    std::swap(m_layout, right.m_layout);
 }
 
 
@@ -294,7 +434,10 @@ void VertexBuffer::bind(const VertexBuffer* vertexBuffer)
 
     const TransientContextLock lock;
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, vertexBuffer ? vertexBuffer->m_buffer : 0));
+    if (vertexBuffer)
+        priv::getActiveGLStateShadow().bindArrayBuffer(vertexBuffer->m_buffer, vertexBuffer->m_cacheId);
+    else
+        priv::getActiveGLStateShadow().bindArrayBuffer(0, 0);
 }
 
 
@@ -326,6 +469,30 @@ VertexBuffer::Usage VertexBuffer::getUsage() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool VertexBuffer::setLayout(const VertexLayout& layout)
+{
+    if (!layout.isValid())
+    {
+        err() << "Could not set vertex buffer layout, the layout is invalid" << std::endl;
+        return false;
+    }
+
+    // Reinterpret the allocated memory with the new vertex size
+    m_size = m_size * m_layout.stride / layout.stride;
+    m_layout = layout;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const VertexLayout& VertexBuffer::getLayout() const
+{
+    return m_layout;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::isAvailable()
 {
@@ -346,7 +513,7 @@ bool VertexBuffer::isAvailable()
 ////////////////////////////////////////////////////////////
 void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 {
-    if (m_buffer && m_size)
+    if (m_buffer && m_size && !m_mapped)
         target.draw(*this, 0, m_size, states);
 }
 
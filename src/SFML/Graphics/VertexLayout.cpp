@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/VertexLayout.hpp>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+sf::VertexLayout makeLayout(std::size_t                stride,
+                            sf::VertexLayout::Format   positionFormat,
+                            std::size_t                positionOffset,
+                            std::optional<std::size_t> colorOffset,
+                            sf::VertexLayout::Format   texCoordsFormat,
+                            std::optional<std::size_t> texCoordsOffset)
+{
+    sf::VertexLayout layout;
+    layout.stride          = stride;
+    layout.positionFormat  = positionFormat;
+    layout.positionOffset  = positionOffset;
+    layout.colorOffset     = colorOffset;
+    layout.texCoordsFormat = texCoordsFormat;
+    layout.texCoordsOffset = texCoordsOffset;
+    return layout;
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+// Static member data
+////////////////////////////////////////////////////////////
+const VertexLayout VertexLayout::Default{};
+
+const VertexLayout VertexLayout::Compact = makeLayout(sizeof(CompactVertex),
+                                                      Format::Float,
+                                                      offsetof(CompactVertex, position),
+                                                      std::nullopt,
+                                                      Format::Short,
+                                                      offsetof(CompactVertex, texCoords));
+
+const VertexLayout VertexLayout::Pixel = makeLayout(sizeof(PixelVertex),
+                                                    Format::Short,
+                                                    offsetof(PixelVertex, position),
+                                                    offsetof(PixelVertex, color),
+                                                    Format::Short,
+                                                    offsetof(PixelVertex, texCoords));
+
+const VertexLayout VertexLayout::Position =
+    makeLayout(sizeof(Vector2f), Format::Float, 0, std::nullopt, Format::Float, std::nullopt);
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexLayout::getAttributeSize(Format format)
+{
+    return (format == Format::Float) ? 2 * sizeof(float) : 2 * sizeof(std::int16_t);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexLayout::isValid() const
+{
+    if (stride == 0)
+        return false;
+
+    if (positionOffset + getAttributeSize(positionFormat) > stride)
+        return false;
+
+    if (colorOffset && (*colorOffset + sizeof(Color) > stride))
+        return false;
+
+    return !texCoordsOffset || (*texCoordsOffset + getAttributeSize(texCoordsFormat) <= stride);
+}
+
+
+////////////////////////////////////////////////////////////
+bool operator==(const VertexLayout& left, const VertexLayout& right)
+{
+    return (left.stride == right.stride) && (left.positionFormat == right.positionFormat) &&
+           (left.positionOffset == right.positionOffset) && (left.colorOffset == right.colorOffset) &&
+           (left.color == right.color) && (left.texCoordsFormat == right.texCoordsFormat) &&
+           (left.texCoordsOffset == right.texCoordsOffset);
+}
+
+
+////////////////////////////////////////////////////////////
+bool operator!=(const VertexLayout& left, const VertexLayout& right)
+{
+    return !(left == right);
+}
+
+} // namespace sf
@@ -368,6 +368,27 @@ Packet& Packet::operator>>(String& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::operator>>(U8String& data)
+{
+    // First extract the string length, in bytes
+    std::uint32_t length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(length))
+    {
+        // Then extract the encoded characters
+        data.assign(reinterpret_cast<const std::uint8_t*>(&m_data[m_readPos]), length);
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(bool data)
 {
@@ -515,6 +536,21 @@ Packet& Packet::operator<<(const std::string& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::operator<<(std::string_view data)
+{
+    // First insert string length
+    const auto length = static_cast<std::uint32_t>(data.size());
+    *this << length;
+
+    // Then insert characters
+    if (length > 0)
+        append(data.data(), length * sizeof(std::string_view::value_type));
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(const wchar_t* data)
 {
@@ -568,6 +604,21 @@ Packet& Packet::operator<<(const String& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::operator<<(U8StringView data)
+{
+    // First insert the string length, in bytes
+    const auto length = static_cast<std::uint32_t>(data.size());
+    *this << length;
+
+    // Then insert the encoded characters, without converting them
+    if (length > 0)
+        append(data.data(), length);
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
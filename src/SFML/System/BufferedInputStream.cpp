@@ -0,0 +1,356 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/BufferedInputStream.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct BufferedInputStream::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief State of the background read
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class State
+    {
+        Idle,      //!< No block is requested
+        Requested, //!< A block is waiting to be read by the background thread
+        Busy,      //!< The background thread is reading a block
+        Ready      //!< A block has been read and can be swapped in
+    };
+
+    Impl(InputStream& theSource, std::size_t bufferSize, Mode theMode) :
+    source(theSource),
+    mode(theMode),
+    size(theSource.getSize()),
+    data(theSource.getData()),
+    front(std::max(bufferSize, std::size_t{1})),
+    position(theSource.tell().value_or(0)),
+    sourcePosition(theSource.tell())
+    {
+        if (mode == Mode::ReadAhead)
+        {
+            // Start reading the first block right away
+            back.resize(front.size());
+            requestPosition = position;
+            state           = State::Requested;
+            thread          = std::thread(&Impl::run, this);
+        }
+    }
+
+    ~Impl()
+    {
+        if (!thread.joinable())
+            return;
+
+        {
+            const std::lock_guard lock(mutex);
+            quit = true;
+        }
+
+        condition.notify_all();
+        thread.join();
+    }
+
+    // Read a block from the source stream (must be called from the thread that owns the source)
+    std::optional<std::size_t> readSource(std::size_t blockPosition, std::byte* buffer, std::size_t count)
+    {
+        // Sequential reads don't need to seek
+        if (sourcePosition != blockPosition && !source.seek(blockPosition).has_value())
+        {
+            sourcePosition.reset();
+            return std::nullopt;
+        }
+
+        const std::optional<std::size_t> read = source.read(buffer, count);
+        sourcePosition = read ? std::optional(blockPosition + *read) : std::nullopt;
+        return read;
+    }
+
+    // Load the block starting at the current position into the front buffer
+    bool fill()
+    {
+        ++statistics.stalls;
+        ++statistics.sourceReads;
+
+        const std::optional<std::size_t> count = readSource(position, front.data(), front.size());
+
+        frontStart = position;
+        frontCount = count.value_or(0);
+        return count.has_value();
+    }
+
+    // Swap in the block read by the background thread at the current position
+    bool swapIn()
+    {
+        std::unique_lock lock(mutex);
+
+        bool stalled = false;
+        while ((state != State::Ready) || (backStart != position))
+        {
+            // Redirect the background thread if it's not already reading
+            if (state != State::Busy)
+            {
+                requestPosition = position;
+                state           = State::Requested;
+                condition.notify_all();
+            }
+
+            stalled = true;
+            condition.wait(lock);
+        }
+
+        if (stalled)
+            ++statistics.stalls;
+
+        std::swap(front, back);
+        frontStart = backStart;
+        frontCount = backCount.value_or(0);
+
+        // Immediately request the following block, unless the end of the stream was reached
+        const std::size_t next = frontStart + frontCount;
+        if (backCount && (frontCount > 0) && (!size || (next < *size)))
+        {
+            requestPosition = next;
+            state           = State::Requested;
+            condition.notify_all();
+        }
+        else
+        {
+            state = State::Idle;
+        }
+
+        return backCount.has_value();
+    }
+
+    // Background thread function
+    void run()
+    {
+        std::unique_lock lock(mutex);
+
+        while (true)
+        {
+            condition.wait(lock, [this] { return quit || (state == State::Requested); });
+
+            if (quit)
+                return;
+
+            const std::size_t blockPosition = requestPosition;
+            state                           = State::Busy;
+            lock.unlock();
+
+            const std::optional<std::size_t> count = readSource(blockPosition, back.data(), back.size());
+
+            lock.lock();
+            backStart = blockPosition;
+            backCount = count;
+            ++backgroundReads;
+            state = State::Ready;
+            condition.notify_all();
+        }
+    }
+
+    InputStream&                     source;            //!< Stream the blocks are read from
+    const Mode                       mode;              //!< Strategy used to refill the buffer
+    const std::optional<std::size_t> size;              //!< Size of the source stream
+    const void* const                data;              //!< Contiguous content of the source stream, if any
+    std::vector<std::byte>           front;             //!< Block being consumed
+    std::size_t                      frontStart{};      //!< Position of the first byte of the front block
+    std::size_t                      frontCount{};      //!< Number of valid bytes in the front block
+    std::size_t                      position;          //!< Current reading position
+    std::optional<std::size_t>       sourcePosition;    //!< Reading position of the source stream, if known
+    Statistics                       statistics;        //!< Statistics updated by the reading thread
+    mutable std::mutex               mutex;             //!< Protects the members below
+    std::condition_variable          condition;         //!< Signaled when the state of the background read changes
+    std::vector<std::byte>           back;              //!< Block read in the background
+    std::size_t                      backStart{};       //!< Position of the first byte of the back block
+    std::optional<std::size_t>       backCount;         //!< Number of bytes read in the back block, or nullopt on error
+    std::size_t                      requestPosition{}; //!< Position of the block to read in the background
+    State                            state{};           //!< State of the background read
+    std::uint64_t                    backgroundReads{}; //!< Number of reads issued by the background thread
+    bool                             quit{};            //!< Should the background thread stop?
+    std::thread                      thread;            //!< Background thread, in read-ahead mode
+};
+
+
+////////////////////////////////////////////////////////////
+BufferedInputStream::BufferedInputStream(InputStream& source, std::size_t bufferSize, Mode mode) :
+m_impl(std::make_unique<Impl>(source, bufferSize, mode))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+BufferedInputStream::~BufferedInputStream() = default;
+
+
+////////////////////////////////////////////////////////////
+BufferedInputStream::BufferedInputStream(BufferedInputStream&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+BufferedInputStream& BufferedInputStream::operator=(BufferedInputStream&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> BufferedInputStream::read(void* data, std::size_t size)
+{
+    if (!m_impl)
+        return std::nullopt;
+
+    Impl&       impl   = *m_impl;
+    auto*       output = static_cast<std::byte*>(data);
+    std::size_t count  = 0;
+
+    while (count < size)
+    {
+        // Copy what the front block holds at the current position
+        if ((impl.position >= impl.frontStart) && (impl.position < impl.frontStart + impl.frontCount))
+        {
+            const std::size_t offset = impl.position - impl.frontStart;
+            const std::size_t chunk  = std::min(size - count, impl.frontCount - offset);
+            std::memcpy(output + count, impl.front.data() + offset, chunk);
+            count += chunk;
+            impl.position += chunk;
+            continue;
+        }
+
+        if (impl.size && (impl.position >= *impl.size))
+            break;
+
+        // Reads larger than the buffer gain nothing from it, let them go straight to the destination
+        if ((impl.mode == Mode::Synchronous) && (size - count >= impl.front.size()))
+        {
+            ++impl.statistics.stalls;
+            ++impl.statistics.sourceReads;
+
+            const std::optional<std::size_t> read = impl.readSource(impl.position, output + count, size - count);
+            if (!read)
+                return count > 0 ? std::optional(count) : std::nullopt;
+
+            count += *read;
+            impl.position += *read;
+
+            if (*read == 0)
+                break;
+
+            continue;
+        }
+
+        if (!((impl.mode == Mode::ReadAhead) ? impl.swapIn() : impl.fill()))
+            return count > 0 ? std::optional(count) : std::nullopt;
+
+        // End of the stream
+        if (impl.frontCount == 0)
+            break;
+    }
+
+    ++impl.statistics.reads;
+    impl.statistics.bytesRead += count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> BufferedInputStream::seek(std::size_t position)
+{
+    if (!m_impl)
+        return std::nullopt;
+
+    m_impl->position = m_impl->size ? std::min(position, *m_impl->size) : position;
+    return m_impl->position;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> BufferedInputStream::tell()
+{
+    if (!m_impl)
+        return std::nullopt;
+
+    return m_impl->position;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> BufferedInputStream::getSize()
+{
+    if (!m_impl)
+        return std::nullopt;
+
+    return m_impl->size;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* BufferedInputStream::getData()
+{
+    return m_impl ? m_impl->data : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+BufferedInputStream::Statistics BufferedInputStream::getStatistics() const
+{
+    if (!m_impl)
+        return {};
+
+    Statistics statistics = m_impl->statistics;
+
+    const std::lock_guard lock(m_impl->mutex);
+    statistics.sourceReads += m_impl->backgroundReads;
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void BufferedInputStream::resetStatistics()
+{
+    if (!m_impl)
+        return;
+
+    m_impl->statistics = {};
+
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->backgroundReads = 0;
+}
+
+} // namespace sf
@@ -26,9 +26,11 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Err.hpp>
+#include <SFML/System/ErrCapture.hpp>
 
 #include <iostream>
 #include <streambuf>
+#include <utility>
 
 #include <cstdio>
 
@@ -92,6 +94,9 @@ private:
         return 0;
     }
 };
+
+// Stream replacing sf::err() in the calling thread, if any
+thread_local std::ostream* threadErrStream = nullptr;
 } // namespace
 
 namespace sf
@@ -99,6 +104,9 @@ namespace sf
 ////////////////////////////////////////////////////////////
 std::ostream& err()
 {
+    if (threadErrStream)
+        return *threadErrStream;
+
     static DefaultErrStreamBuf buffer;
     static std::ostream        stream(&buffer);
 
@@ -106,4 +114,10 @@ std::ostream& err()
 }
 
 
+////////////////////////////////////////////////////////////
+std::ostream* priv::setThreadErrStream(std::ostream* stream)
+{
+    return std::exchange(threadErrStream, stream);
+}
+
 } // namespace sf
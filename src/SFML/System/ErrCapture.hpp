@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <sstream>
+#include <string>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Redirect `sf::err()` to another stream in the calling thread
+///
+/// \param stream Stream to write to, or `nullptr` to write to the shared error stream again
+///
+/// \return Stream the calling thread was redirected to until now, `nullptr` if none
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API std::ostream* setThreadErrStream(std::ostream* stream);
+
+////////////////////////////////////////////////////////////
+/// \brief Collect what the calling thread writes to `sf::err()`
+///
+/// `sf::err()` isn't thread-safe, so the threads working in
+/// the background collect their messages and hand them to
+/// the thread that reports them. Captures can be nested,
+/// the previous redirection is restored on destruction.
+///
+////////////////////////////////////////////////////////////
+class ErrCapture
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start collecting the messages of the calling thread
+    ///
+    ////////////////////////////////////////////////////////////
+    ErrCapture() : m_previous(setThreadErrStream(&m_stream))
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop collecting the messages of the calling thread
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ErrCapture()
+    {
+        [[maybe_unused]] std::ostream* const capture = setThreadErrStream(m_previous);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ErrCapture(const ErrCapture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ErrCapture& operator=(const ErrCapture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take the messages collected so far
+    ///
+    /// \return Collected messages, empty if there are none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::string take()
+    {
+        std::string messages = m_stream.str();
+        m_stream.str({});
+        return messages;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::ostringstream m_stream;   //!< Messages written by the calling thread
+    std::ostream*      m_previous; //!< Redirection to restore on destruction
+};
+
+} // namespace sf::priv
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FramePacer.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// Nearest-rank percentile of the given frame times, which are reordered
+sf::Time getPercentile(std::vector<sf::Time>& frameTimes, float percentile)
+{
+    const auto rank  = static_cast<std::size_t>(std::ceil(percentile * static_cast<float>(frameTimes.size())));
+    const auto index = std::clamp<std::size_t>(rank, 1, frameTimes.size()) - 1;
+    const auto nth   = frameTimes.begin() + static_cast<std::ptrdiff_t>(index);
+
+    std::nth_element(frameTimes.begin(), nth, frameTimes.end());
+    return *nth;
+}
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void FramePacer::setFrameTime(Time frameTime)
+{
+    m_frameTime = std::max(frameTime, Time::Zero);
+    m_deadline  = m_frameStart + m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getFrameTime() const
+{
+    return m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::setMode(Mode mode, Time slack)
+{
+    m_mode     = mode;
+    m_slack    = std::max(slack, Time::Zero);
+    m_deadline = m_frameStart + m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacer::Mode FramePacer::getMode() const
+{
+    return m_mode;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getSlack() const
+{
+    return m_slack;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::endFrame()
+{
+    bool resynchronize = false;
+
+    if (m_frameTime != Time::Zero)
+    {
+        const Time now      = m_clock.getElapsedTime();
+        const Time deadline = (m_mode == Mode::Absolute) ? m_deadline : m_frameStart + m_frameTime;
+
+        if (now > deadline)
+            ++m_missedDeadlines;
+
+        if (m_mode == Mode::Relative)
+        {
+            sleep(deadline - now);
+        }
+        else if (now - deadline >= m_frameTime)
+        {
+            // More than a whole frame late: start a new schedule instead of rushing through the next frames
+            resynchronize = true;
+        }
+        else
+        {
+            waitUntil(deadline);
+        }
+    }
+
+    // Measure the frame which just ended
+    const Time now       = m_clock.getElapsedTime();
+    const Time frameTime = now - m_frameStart;
+    m_frameStart         = now;
+
+    // Relative deadlines always follow the end of the previous frame
+    if ((m_mode == Mode::Relative) || resynchronize)
+        m_deadline = now + m_frameTime;
+    else
+        m_deadline += m_frameTime;
+
+    m_minimum = (m_frameCount == 0) ? frameTime : std::min(m_minimum, frameTime);
+    m_maximum = std::max(m_maximum, frameTime);
+    m_total += frameTime;
+    m_history[m_frameCount % HistorySize] = frameTime;
+    ++m_frameCount;
+
+    return frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::restart()
+{
+    m_clock.restart();
+    m_frameStart = Time::Zero;
+    m_deadline   = m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacer::Statistics FramePacer::getStatistics() const
+{
+    Statistics statistics;
+    statistics.frameCount      = m_frameCount;
+    statistics.missedDeadlines = m_missedDeadlines;
+
+    if (m_frameCount == 0)
+        return statistics;
+
+    statistics.minimum = m_minimum;
+    statistics.average = m_total / static_cast<std::int64_t>(m_frameCount);
+    statistics.maximum = m_maximum;
+
+    std::vector<Time> frameTimes(m_history.begin(), m_history.begin() + std::min(m_frameCount, HistorySize));
+    statistics.median       = getPercentile(frameTimes, 0.5f);
+    statistics.percentile95 = getPercentile(frameTimes, 0.95f);
+    statistics.percentile99 = getPercentile(frameTimes, 0.99f);
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::resetStatistics()
+{
+    m_frameCount      = 0;
+    m_missedDeadlines = 0;
+    m_minimum         = Time::Zero;
+    m_maximum         = Time::Zero;
+    m_total           = Time::Zero;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::waitUntil(Time deadline) const
+{
+    // Sleeping is cheap but imprecise, so stop early and spin until the deadline
+    sleep(deadline - m_slack - m_clock.getElapsedTime());
+
+    while (m_clock.getElapsedTime() < deadline)
+        std::this_thread::yield();
+}
+
+} // namespace sf
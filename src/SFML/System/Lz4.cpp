@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Lz4.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace Lz4Impl
+{
+// Constants of the LZ4 block format
+constexpr std::size_t minMatch     = 4;     // Shortest match that can be encoded
+constexpr std::size_t lastLiterals = 5;     // The last bytes of a block are always literals
+constexpr std::size_t matchLimit   = 12;    // The last match must start at least this far from the end
+constexpr std::size_t maxOffset    = 65535; // Farthest match that can be referenced
+constexpr unsigned    hashBits     = 12;    // Size of the compressor's hash table, as a power of two
+constexpr std::size_t noPosition   = std::numeric_limits<std::size_t>::max();
+
+std::uint32_t read32(const std::byte* data)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::uint32_t hash(std::uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+// Write a length that doesn't fit in its token nibble
+void writeLength(std::vector<std::byte>& output, std::size_t length)
+{
+    for (; length >= 255; length -= 255)
+        output.push_back(std::byte{255});
+
+    output.push_back(static_cast<std::byte>(length));
+}
+
+// Write a sequence: literals followed by a match (no match for the last sequence)
+void writeSequence(std::vector<std::byte>& output,
+                   const std::byte*        literals,
+                   std::size_t             literalCount,
+                   std::size_t             offset,
+                   std::size_t             matchLength)
+{
+    const std::size_t matchCode = matchLength > 0 ? matchLength - minMatch : 0;
+
+    output.push_back(static_cast<std::byte>((std::min<std::size_t>(literalCount, 15) << 4) |
+                                            std::min<std::size_t>(matchCode, 15)));
+
+    if (literalCount >= 15)
+        writeLength(output, literalCount - 15);
+
+    output.insert(output.end(), literals, literals + literalCount);
+
+    if (matchLength == 0)
+        return;
+
+    output.push_back(static_cast<std::byte>(offset & 0xFF));
+    output.push_back(static_cast<std::byte>(offset >> 8));
+
+    if (matchCode >= 15)
+        writeLength(output, matchCode - 15);
+}
+
+// Read a length that didn't fit in its token nibble
+bool readLength(const std::byte* input, std::size_t inputSize, std::size_t& position, std::size_t& length)
+{
+    std::uint8_t byte = 255;
+    while (byte == 255)
+    {
+        if (position >= inputSize)
+            return false;
+
+        byte = static_cast<std::uint8_t>(input[position++]);
+        length += byte;
+    }
+
+    return true;
+}
+} // namespace Lz4Impl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::vector<std::byte> compressLz4(const std::byte* data, std::size_t size)
+{
+    using namespace Lz4Impl;
+
+    std::vector<std::byte> output;
+    output.reserve(size + size / 255 + 16);
+
+    std::size_t anchor = 0;
+
+    if (size > matchLimit)
+    {
+        std::array<std::size_t, 1 << hashBits> table{};
+        table.fill(noPosition);
+
+        const std::size_t searchEnd = size - matchLimit;
+        const std::size_t matchEnd  = size - lastLiterals;
+
+        for (std::size_t position = 0; position < searchEnd;)
+        {
+            const std::uint32_t sequence  = read32(data + position);
+            std::size_t&        entry     = table[hash(sequence)];
+            const std::size_t   reference = std::exchange(entry, position);
+
+            if ((reference == noPosition) || (position - reference > maxOffset) ||
+                (read32(data + reference) != sequence))
+            {
+                ++position;
+                continue;
+            }
+
+            std::size_t length = minMatch;
+            while ((position + length < matchEnd) && (data[reference + length] == data[position + length]))
+                ++length;
+
+            writeSequence(output, data + anchor, position - anchor, position - reference, length);
+
+            position += length;
+            anchor = position;
+        }
+    }
+
+    // The block always ends with literals
+    writeSequence(output, data + anchor, size - anchor, 0, 0);
+
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+bool decompressLz4(const std::byte* input, std::size_t inputSize, std::byte* output, std::size_t outputSize)
+{
+    using namespace Lz4Impl;
+
+    std::size_t inputPosition  = 0;
+    std::size_t outputPosition = 0;
+
+    while (inputPosition < inputSize)
+    {
+        const auto token = static_cast<std::uint8_t>(input[inputPosition++]);
+
+        // Literals
+        std::size_t literalCount = token >> 4;
+        if ((literalCount == 15) && !readLength(input, inputSize, inputPosition, literalCount))
+            return false;
+
+        if ((literalCount > inputSize - inputPosition) || (literalCount > outputSize - outputPosition))
+            return false;
+
+        if (literalCount > 0)
+            std::memcpy(output + outputPosition, input + inputPosition, literalCount);
+
+        inputPosition += literalCount;
+        outputPosition += literalCount;
+
+        // The last sequence has no match
+        if (inputPosition == inputSize)
+            break;
+
+        // Match
+        if (inputSize - inputPosition < 2)
+            return false;
+
+        const std::size_t offset = static_cast<std::size_t>(input[inputPosition]) |
+                                   (static_cast<std::size_t>(input[inputPosition + 1]) << 8);
+        inputPosition += 2;
+
+        if ((offset == 0) || (offset > outputPosition))
+            return false;
+
+        std::size_t matchLength = token & 15;
+        if ((matchLength == 15) && !readLength(input, inputSize, inputPosition, matchLength))
+            return false;
+
+        matchLength += minMatch;
+        if (matchLength > outputSize - outputPosition)
+            return false;
+
+        // Matches may overlap their own output, copy byte by byte
+        const std::byte* source = output + outputPosition - offset;
+        for (std::size_t i = 0; i < matchLength; ++i)
+            output[outputPosition + i] = source[i];
+
+        outputPosition += matchLength;
+    }
+
+    return outputPosition == outputSize;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Compress data to the LZ4 block format
+///
+/// The output is a raw LZ4 block (no frame), which any
+/// LZ4 block decoder can decompress.
+///
+/// \param data Data to compress
+/// \param size Size of the data, in bytes
+///
+/// \return Compressed block
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::byte> compressLz4(const std::byte* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress an LZ4 block
+///
+/// The block is fully validated: malformed input or a
+/// decompressed size different from \a outputSize makes
+/// the function fail instead of reading or writing out of
+/// bounds.
+///
+/// \param input      Compressed block
+/// \param inputSize  Size of the compressed block, in bytes
+/// \param output     Buffer receiving the decompressed data
+/// \param outputSize Exact size of the decompressed data, in bytes
+///
+/// \return `true` on success, `false` if the block is invalid
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool decompressLz4(const std::byte* input,
+                                 std::size_t      inputSize,
+                                 std::byte*       output,
+                                 std::size_t      outputSize);
+
+} // namespace sf::priv
@@ -89,4 +89,11 @@ std::optional<std::size_t> MemoryInputStream::getSize()
     return m_size;
 }
 
+
+////////////////////////////////////////////////////////////
+const void* MemoryInputStream::getData()
+{
+    return m_data;
+}
+
 } // namespace sf
@@ -0,0 +1,685 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Exception.hpp>
+#include <SFML/System/Lz4.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/PackFile.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PackFileImpl
+{
+// Layout of a pack file (all integers are little-endian):
+//
+// Header (40 bytes):
+//   char[4] magic ("SFPK")
+//   u32     version
+//   u32     entry count
+//   u32     reserved
+//   u64     offset of the index
+//   u64     offset of the path strings
+//   u64     size of the path strings
+//
+// Entry data, one block per entry
+//
+// Index, one 48-byte record per entry, sorted by path hash then path:
+//   u64 path hash (FNV-1a)
+//   u64 offset of the data
+//   u64 size of the stored data
+//   u64 size of the entry
+//   u32 offset of the path in the path strings
+//   u32 length of the path
+//   u32 compression method (0: none, 1: LZ4 block)
+//   u32 reserved
+//
+// Path strings, UTF-8 paths relative to the root with '/' as separator
+constexpr std::array<char, 4> magic{'S', 'F', 'P', 'K'};
+constexpr std::uint32_t       version    = 1;
+constexpr std::size_t         headerSize = 40;
+constexpr std::size_t         recordSize = 48;
+constexpr std::uint32_t       methodNone = 0;
+constexpr std::uint32_t       methodLz4  = 1;
+
+// Largest expansion of the LZ4 block format, used to reject corrupted entry sizes before allocating them
+constexpr std::uint64_t maxLz4Ratio = 255;
+
+struct Entry
+{
+    std::uint64_t hash{};
+    std::uint64_t offset{};
+    std::uint64_t storedSize{};
+    std::uint64_t size{};
+    std::uint32_t pathOffset{};
+    std::uint32_t pathLength{};
+    std::uint32_t method{};
+};
+
+std::uint64_t hashPath(std::string_view path)
+{
+    std::uint64_t hash = 14695981039346656037u;
+    for (const char character : path)
+    {
+        hash ^= static_cast<std::uint8_t>(character);
+        hash *= 1099511628211u;
+    }
+
+    return hash;
+}
+
+std::string normalizePath(const std::filesystem::path& path)
+{
+    const auto normalized = path.lexically_normal().generic_u8string();
+    return {normalized.begin(), normalized.end()};
+}
+
+template <typename T>
+T readInteger(const std::byte* data)
+{
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<T>(static_cast<T>(data[i]) << (8 * i));
+
+    return value;
+}
+
+template <typename T>
+void writeInteger(std::ostream& stream, T value)
+{
+    std::array<char, sizeof(T)> bytes{};
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+
+    stream.write(bytes.data(), bytes.size());
+}
+
+Entry readEntry(const std::byte* record)
+{
+    Entry entry;
+    entry.hash       = readInteger<std::uint64_t>(record);
+    entry.offset     = readInteger<std::uint64_t>(record + 8);
+    entry.storedSize = readInteger<std::uint64_t>(record + 16);
+    entry.size       = readInteger<std::uint64_t>(record + 24);
+    entry.pathOffset = readInteger<std::uint32_t>(record + 32);
+    entry.pathLength = readInteger<std::uint32_t>(record + 36);
+    entry.method     = readInteger<std::uint32_t>(record + 40);
+    return entry;
+}
+
+void writeEntry(std::ostream& stream, const Entry& entry)
+{
+    writeInteger(stream, entry.hash);
+    writeInteger(stream, entry.offset);
+    writeInteger(stream, entry.storedSize);
+    writeInteger(stream, entry.size);
+    writeInteger(stream, entry.pathOffset);
+    writeInteger(stream, entry.pathLength);
+    writeInteger(stream, entry.method);
+    writeInteger(stream, std::uint32_t{0});
+}
+
+// Stream over an entry stored in place in the mapped pack file, which it keeps alive
+class StoredStream : public sf::InputStream
+{
+public:
+    StoredStream(std::shared_ptr<const void> owner, const void* data, std::size_t size) :
+        m_owner(std::move(owner)),
+        m_stream(data, size)
+    {
+    }
+
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override
+    {
+        return m_stream.read(data, size);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override
+    {
+        return m_stream.seek(position);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> tell() override
+    {
+        return m_stream.tell();
+    }
+
+    std::optional<std::size_t> getSize() override
+    {
+        return m_stream.getSize();
+    }
+
+    [[nodiscard]] const void* getData() override
+    {
+        return m_stream.getData();
+    }
+
+private:
+    std::shared_ptr<const void> m_owner;
+    sf::MemoryInputStream       m_stream;
+};
+
+// Stream over an entry decompressed in memory
+class DecompressedStream : public sf::InputStream
+{
+public:
+    explicit DecompressedStream(std::vector<std::byte>&& buffer) : m_buffer(std::move(buffer))
+    {
+    }
+
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override
+    {
+        return m_stream.read(data, size);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override
+    {
+        return m_stream.seek(position);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> tell() override
+    {
+        return m_stream.tell();
+    }
+
+    std::optional<std::size_t> getSize() override
+    {
+        return m_stream.getSize();
+    }
+
+    [[nodiscard]] const void* getData() override
+    {
+        return m_stream.getData();
+    }
+
+private:
+    std::vector<std::byte> m_buffer;
+    sf::MemoryInputStream  m_stream{m_buffer.data(), m_buffer.size()};
+};
+} // namespace PackFileImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct PackFile::Impl : std::enable_shared_from_this<PackFile::Impl>
+{
+    // Registry of the mounted pack files, most recently mounted last
+    static std::vector<std::shared_ptr<const Impl>>& getMounted()
+    {
+        static std::vector<std::shared_ptr<const Impl>> mounted;
+        return mounted;
+    }
+
+    static std::mutex& getMountMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    [[nodiscard]] bool load(const std::filesystem::path& filename)
+    {
+        using namespace PackFileImpl;
+
+        if (!file.open(filename))
+        {
+            err() << "Failed to open pack file\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(file.getData());
+        size = file.getSize().value();
+
+        if ((size < headerSize) || (std::memcmp(data, magic.data(), magic.size()) != 0))
+        {
+            err() << "Failed to open pack file (not a pack file)\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        if (readInteger<std::uint32_t>(data + 4) != version)
+        {
+            err() << "Failed to open pack file (unsupported version)\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        const std::uint64_t count         = readInteger<std::uint32_t>(data + 8);
+        const std::uint64_t indexOffset   = readInteger<std::uint64_t>(data + 16);
+        const std::uint64_t stringsOffset = readInteger<std::uint64_t>(data + 24);
+        const std::uint64_t stringsLength = readInteger<std::uint64_t>(data + 32);
+
+        if ((indexOffset > size) || (count > (size - indexOffset) / recordSize) || (stringsOffset > size) ||
+            (stringsLength > size - stringsOffset))
+        {
+            err() << "Failed to open pack file (corrupted index)\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        entryCount  = static_cast<std::size_t>(count);
+        index       = data + indexOffset;
+        strings     = data + stringsOffset;
+        stringsSize = static_cast<std::size_t>(stringsLength);
+        return true;
+    }
+
+    [[nodiscard]] std::optional<std::string_view> getPath(const PackFileImpl::Entry& entry) const
+    {
+        if ((entry.pathOffset > stringsSize) || (entry.pathLength > stringsSize - entry.pathOffset))
+            return std::nullopt;
+
+        return std::string_view(reinterpret_cast<const char*>(strings + entry.pathOffset), entry.pathLength);
+    }
+
+    [[nodiscard]] std::optional<PackFileImpl::Entry> find(std::string_view path) const
+    {
+        using namespace PackFileImpl;
+
+        const std::uint64_t hash = hashPath(path);
+
+        // Binary search for the first record with the same hash
+        std::size_t first = 0;
+        std::size_t count = entryCount;
+        while (count > 0)
+        {
+            const std::size_t step = count / 2;
+            if (readInteger<std::uint64_t>(index + (first + step) * recordSize) < hash)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        // Compare the paths of the records sharing this hash
+        for (std::size_t i = first; i < entryCount; ++i)
+        {
+            const Entry entry = readEntry(index + i * recordSize);
+            if (entry.hash != hash)
+                break;
+
+            if (getPath(entry) == path)
+                return entry;
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::unique_ptr<InputStream> openStream(std::string_view path) const
+    {
+        using namespace PackFileImpl;
+
+        const std::optional<Entry> entry = find(path);
+        if (!entry)
+            return nullptr;
+
+        if ((entry->offset > size) || (entry->storedSize > size - entry->offset))
+        {
+            err() << "Failed to open pack file entry (corrupted index)\n" << formatDebugPathInfo(path) << std::endl;
+            return nullptr;
+        }
+
+        const std::byte* stored = data + entry->offset;
+
+        if ((entry->method == methodNone) && (entry->storedSize == entry->size))
+            return std::make_unique<StoredStream>(shared_from_this(), stored, static_cast<std::size_t>(entry->size));
+
+        if ((entry->method == methodLz4) && (entry->size <= entry->storedSize * maxLz4Ratio) &&
+            (entry->size <= std::numeric_limits<std::size_t>::max()))
+        {
+            std::vector<std::byte> buffer(static_cast<std::size_t>(entry->size));
+            if (priv::decompressLz4(stored, static_cast<std::size_t>(entry->storedSize), buffer.data(), buffer.size()))
+                return std::make_unique<DecompressedStream>(std::move(buffer));
+        }
+
+        err() << "Failed to open pack file entry (corrupted data)\n" << formatDebugPathInfo(path) << std::endl;
+        return nullptr;
+    }
+
+    MappedFileInputStream file;          //!< Mapped pack file
+    const std::byte*      data{};        //!< Content of the pack file
+    std::size_t           size{};        //!< Size of the pack file
+    std::size_t           entryCount{};  //!< Number of entries
+    const std::byte*      index{};       //!< Index records
+    const std::byte*      strings{};     //!< Path strings
+    std::size_t           stringsSize{}; //!< Size of the path strings
+    bool                  mounted{};     //!< Is the pack file in the registry of mounted pack files?
+};
+
+
+////////////////////////////////////////////////////////////
+PackFile::PackFile() = default;
+
+
+////////////////////////////////////////////////////////////
+PackFile::PackFile(const std::filesystem::path& filename)
+{
+    if (!open(filename))
+        throw sf::Exception("Failed to open pack file");
+}
+
+
+////////////////////////////////////////////////////////////
+PackFile::~PackFile()
+{
+    unmount();
+}
+
+
+////////////////////////////////////////////////////////////
+PackFile::PackFile(PackFile&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+PackFile& PackFile::operator=(PackFile&& right) noexcept
+{
+    if (this != &right)
+    {
+        unmount();
+        m_impl = std::move(right.m_impl);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackFile::open(const std::filesystem::path& filename)
+{
+    unmount();
+    m_impl.reset();
+
+    auto impl = std::make_shared<Impl>();
+    if (!impl->load(filename))
+        return false;
+
+    m_impl = std::move(impl);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackFile::contains(const std::filesystem::path& path) const
+{
+    return m_impl && m_impl->find(PackFileImpl::normalizePath(path)).has_value();
+}
+
+
+////////////////////////////////////////////////////////////
+std::unique_ptr<InputStream> PackFile::openStream(const std::filesystem::path& path) const
+{
+    if (!m_impl)
+        return nullptr;
+
+    return m_impl->openStream(PackFileImpl::normalizePath(path));
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PackFile::getEntryCount() const
+{
+    return m_impl ? m_impl->entryCount : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::string> PackFile::getEntryPaths() const
+{
+    std::vector<std::string> paths;
+
+    if (!m_impl)
+        return paths;
+
+    paths.reserve(m_impl->entryCount);
+
+    for (std::size_t i = 0; i < m_impl->entryCount; ++i)
+    {
+        const PackFileImpl::Entry entry = PackFileImpl::readEntry(m_impl->index + i * PackFileImpl::recordSize);
+        if (const std::optional<std::string_view> path = m_impl->getPath(entry))
+            paths.emplace_back(*path);
+    }
+
+    return paths;
+}
+
+
+////////////////////////////////////////////////////////////
+void PackFile::mount()
+{
+    if (!m_impl || m_impl->mounted)
+        return;
+
+    const std::lock_guard lock(Impl::getMountMutex());
+    Impl::getMounted().push_back(m_impl);
+    m_impl->mounted = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PackFile::unmount()
+{
+    if (!m_impl || !m_impl->mounted)
+        return;
+
+    const std::lock_guard lock(Impl::getMountMutex());
+    auto&                 mounted = Impl::getMounted();
+    mounted.erase(std::remove(mounted.begin(), mounted.end(), m_impl), mounted.end());
+    m_impl->mounted = false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackFile::isMounted() const
+{
+    return m_impl && m_impl->mounted;
+}
+
+
+////////////////////////////////////////////////////////////
+std::unique_ptr<InputStream> PackFile::openMountedStream(const std::filesystem::path& path)
+{
+    // Take a snapshot of the registry, so that entries are decompressed without holding the lock;
+    // the snapshot keeps the pack files alive even if they are unmounted in the meantime
+    std::vector<std::shared_ptr<const Impl>> mounted;
+    {
+        const std::lock_guard lock(Impl::getMountMutex());
+
+        // Don't bother normalizing the path when nothing is mounted, the common case for loadFromFile
+        if (Impl::getMounted().empty() || path.is_absolute())
+            return nullptr;
+
+        mounted = Impl::getMounted();
+    }
+
+    const std::string normalized = PackFileImpl::normalizePath(path);
+
+    for (auto it = mounted.rbegin(); it != mounted.rend(); ++it)
+    {
+        if (std::unique_ptr<InputStream> stream = (*it)->openStream(normalized))
+            return stream;
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackFile::build(const std::filesystem::path& filename,
+                     const std::filesystem::path& directory,
+                     Compression                  compression)
+{
+    using namespace PackFileImpl;
+
+    // Gather the files in a deterministic order
+    std::vector<std::pair<std::string, std::filesystem::path>> files;
+    std::error_code                                            error;
+
+    for (auto it = std::filesystem::recursive_directory_iterator(directory, error);
+         !error && (it != std::filesystem::recursive_directory_iterator());
+         it.increment(error))
+    {
+        if (it->is_regular_file(error))
+            files.emplace_back(normalizePath(it->path().lexically_relative(directory)), it->path());
+    }
+
+    if (error)
+    {
+        err() << "Failed to build pack file (couldn't list the directory: " << error.message() << ")\n"
+              << formatDebugPathInfo(directory) << std::endl;
+        return false;
+    }
+
+    if (files.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        err() << "Failed to build pack file (too many files)\n" << formatDebugPathInfo(directory) << std::endl;
+        return false;
+    }
+
+    std::sort(files.begin(), files.end());
+
+    std::ofstream output(filename, std::ios_base::binary);
+    if (!output)
+    {
+        err() << "Failed to build pack file (couldn't create the file)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    // Leave room for the header, written once the offsets are known
+    output.write(std::array<char, headerSize>{}.data(), headerSize);
+
+    std::vector<Entry> entries;
+    std::string        strings;
+    std::uint64_t      offset = headerSize;
+    entries.reserve(files.size());
+
+    for (const auto& [path, source] : files)
+    {
+        MappedFileInputStream input;
+        if (!input.open(source))
+        {
+            err() << "Failed to build pack file (couldn't read a file)\n" << formatDebugPathInfo(source) << std::endl;
+            return false;
+        }
+
+        if (strings.size() + path.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            err() << "Failed to build pack file (paths too long)\n" << formatDebugPathInfo(directory) << std::endl;
+            return false;
+        }
+
+        const auto*       content = static_cast<const std::byte*>(input.getData());
+        const std::size_t size    = input.getSize().value();
+
+        Entry entry;
+        entry.hash       = hashPath(path);
+        entry.offset     = offset;
+        entry.storedSize = size;
+        entry.size       = size;
+        entry.pathOffset = static_cast<std::uint32_t>(strings.size());
+        entry.pathLength = static_cast<std::uint32_t>(path.size());
+        entry.method     = methodNone;
+
+        std::vector<std::byte> compressed;
+        if ((compression == Compression::Lz4) && (size > 0))
+            compressed = priv::compressLz4(content, size);
+
+        // Only keep compressed data when it is actually smaller
+        if (!compressed.empty() && (compressed.size() < size))
+        {
+            entry.storedSize = compressed.size();
+            entry.method     = methodLz4;
+            output.write(reinterpret_cast<const char*>(compressed.data()),
+                         static_cast<std::streamsize>(compressed.size()));
+        }
+        else if (size > 0)
+        {
+            output.write(reinterpret_cast<const char*>(content), static_cast<std::streamsize>(size));
+        }
+
+        offset += entry.storedSize;
+        strings += path;
+        entries.push_back(entry);
+    }
+
+    std::sort(entries.begin(),
+              entries.end(),
+              [&strings](const Entry& left, const Entry& right)
+              {
+                  const std::string_view leftPath(strings.data() + left.pathOffset, left.pathLength);
+                  const std::string_view rightPath(strings.data() + right.pathOffset, right.pathLength);
+                  return std::tie(left.hash, leftPath) < std::tie(right.hash, rightPath);
+              });
+
+    const std::uint64_t indexOffset = offset;
+    for (const Entry& entry : entries)
+        writeEntry(output, entry);
+
+    const std::uint64_t stringsOffset = indexOffset + entries.size() * recordSize;
+    output.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+    // Now write the header
+    output.seekp(0);
+    output.write(magic.data(), magic.size());
+    writeInteger(output, version);
+    writeInteger(output, static_cast<std::uint32_t>(entries.size()));
+    writeInteger(output, std::uint32_t{0});
+    writeInteger(output, indexOffset);
+    writeInteger(output, stringsOffset);
+    writeInteger(output, static_cast<std::uint64_t>(strings.size()));
+
+    if (!output.flush())
+    {
+        err() << "Failed to build pack file (couldn't write the file)\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace sf
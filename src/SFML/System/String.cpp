@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utf.hpp>
+#include <SFML/System/UtfBulk.hpp>
 
 #include <iterator>
 #include <utility>
@@ -166,7 +167,7 @@ String::String(const char* ansiString, const std::locale& locale)
         if (length > 0)
         {
             m_string.reserve(length + 1);
-            Utf32::fromAnsi(ansiString, ansiString + length, std::back_inserter(m_string), locale);
+            priv::ansiToUtf32(ansiString, ansiString + length, m_string, locale);
         }
     }
 }
@@ -176,7 +177,7 @@ String::String(const char* ansiString, const std::locale& locale)
 String::String(const std::string& ansiString, const std::locale& locale)
 {
     m_string.reserve(ansiString.length() + 1);
-    Utf32::fromAnsi(ansiString.begin(), ansiString.end(), std::back_inserter(m_string), locale);
+    priv::ansiToUtf32(ansiString.data(), ansiString.data() + ansiString.size(), m_string, locale);
 }
 
 
@@ -215,6 +216,31 @@ String::String(std::u32string utf32String) : m_string(std::move(utf32String))
 }
 
 
+////////////////////////////////////////////////////////////
+String String::fromUtf8(U8StringView utf8String)
+{
+    String string;
+    priv::utf8ToUtf32(utf8String.data(), utf8String.data() + utf8String.size(), string.m_string);
+    return string;
+}
+
+
+////////////////////////////////////////////////////////////
+String String::fromUtf16(std::u16string_view utf16String)
+{
+    String string;
+    priv::utf16ToUtf32(utf16String.data(), utf16String.data() + utf16String.size(), string.m_string);
+    return string;
+}
+
+
+////////////////////////////////////////////////////////////
+bool String::isValidUtf8(U8StringView utf8String)
+{
+    return priv::isValidUtf8(utf8String.data(), utf8String.data() + utf8String.size());
+}
+
+
 ////////////////////////////////////////////////////////////
 String::operator std::string() const
 {
@@ -237,7 +263,7 @@ std::string String::toAnsiString(const std::locale& locale) const
     output.reserve(m_string.length() + 1);
 
     // Convert
-    Utf32::toAnsi(m_string.begin(), m_string.end(), std::back_inserter(output), 0, locale);
+    priv::utf32ToAnsi(m_string.data(), m_string.data() + m_string.size(), output, locale);
 
     return output;
 }
@@ -265,7 +291,7 @@ U8String String::toUtf8() const
     output.reserve(m_string.length());
 
     // Convert
-    Utf32::toUtf8(m_string.begin(), m_string.end(), std::back_inserter(output));
+    priv::utf32ToUtf8(m_string.data(), m_string.data() + m_string.size(), output);
 
     return output;
 }
@@ -279,7 +305,7 @@ std::u16string String::toUtf16() const
     output.reserve(m_string.length());
 
     // Convert
-    Utf32::toUtf16(m_string.begin(), m_string.end(), std::back_inserter(output));
+    priv::utf32ToUtf16(m_string.data(), m_string.data() + m_string.size(), output);
 
     return output;
 }
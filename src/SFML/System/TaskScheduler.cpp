@@ -0,0 +1,581 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Err.hpp>
+#include <SFML/System/ErrCapture.hpp>
+#include <SFML/System/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TaskSchedulerImpl
+{
+// Scheduler owning the calling thread if it is a worker thread, and index of the worker
+thread_local const void* currentScheduler(nullptr);
+thread_local std::size_t currentWorker(0);
+
+// Number of workers of the default scheduler, set before its creation
+constexpr unsigned int    unsetWorkerCount = std::numeric_limits<unsigned int>::max();
+std::atomic<unsigned int> defaultWorkerCount(unsetWorkerCount);
+std::atomic<bool>         defaultCreated(false);
+} // namespace TaskSchedulerImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TaskScheduler::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Worker thread and its own queue of tasks
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Worker
+    {
+        std::mutex       mutex;  //!< Mutex protecting the queue
+        std::deque<Task> tasks;  //!< Tasks, taken from the back by the worker and from the front by thieves
+        std::thread      thread; //!< Worker thread
+    };
+
+    explicit Impl(unsigned int workerCount) : mainThread(std::this_thread::get_id())
+    {
+        workers.reserve(workerCount);
+        for (unsigned int i = 0; i < workerCount; ++i)
+            workers.push_back(std::make_unique<Worker>());
+
+        // Start the threads once all the queues exist, since the workers steal from each other
+        for (std::size_t i = 0; i < workers.size(); ++i)
+            workers[i]->thread = std::thread(&Impl::run, this, i);
+    }
+
+    ~Impl()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stop = true;
+        }
+
+        condition.notify_all();
+
+        for (const auto& worker : workers)
+            worker->thread.join();
+
+        reportMessages();
+    }
+
+    [[nodiscard]] bool isWorkerThread() const
+    {
+        return TaskSchedulerImpl::currentScheduler == this;
+    }
+
+    void push(Task&& task)
+    {
+        // The counter is incremented before the task is visible, so that taking it can't make the counter wrap
+        if (isWorkerThread())
+        {
+            Worker& worker = *workers[TaskSchedulerImpl::currentWorker];
+            {
+                const std::lock_guard lock(worker.mutex);
+                queued.fetch_add(1, std::memory_order_release);
+                worker.tasks.push_back(std::move(task));
+            }
+
+            // Synchronize with the threads about to sleep, so that they don't miss the notification
+            const std::lock_guard lock(mutex);
+        }
+        else
+        {
+            const std::lock_guard lock(mutex);
+            queued.fetch_add(1, std::memory_order_release);
+            sharedTasks.push_back(std::move(task));
+        }
+
+        condition.notify_one();
+    }
+
+    void pushMainThread(Task&& task)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            mainThreadTasks.push_back(std::move(task));
+            mainThreadQueued.fetch_add(1, std::memory_order_release);
+        }
+
+        // Only the main thread can run the task, but it can't be told apart from the workers
+        condition.notify_all();
+    }
+
+    [[nodiscard]] bool pop(Task& task)
+    {
+        const bool        worker = isWorkerThread();
+        const std::size_t self   = worker ? TaskSchedulerImpl::currentWorker : 0;
+
+        const auto take = [this, &task](std::deque<Task>& tasks, bool newest)
+        {
+            if (tasks.empty())
+                return false;
+
+            task = std::move(newest ? tasks.back() : tasks.front());
+            if (newest)
+                tasks.pop_back();
+            else
+                tasks.pop_front();
+
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        };
+
+        // Newest task of our own queue first, its data is most likely still in the cache
+        if (worker)
+        {
+            const std::lock_guard lock(workers[self]->mutex);
+            if (take(workers[self]->tasks, true))
+                return true;
+        }
+
+        // Then the tasks submitted from outside the workers
+        {
+            const std::lock_guard lock(mutex);
+            if (take(sharedTasks, false))
+                return true;
+        }
+
+        // Then steal the oldest task of another worker
+        for (std::size_t i = 1; i <= workers.size(); ++i)
+        {
+            Worker& victim = *workers[(self + i) % workers.size()];
+            if (worker && (&victim == workers[self].get()))
+                continue;
+
+            const std::lock_guard lock(victim.mutex);
+            if (take(victim.tasks, false))
+                return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool popMainThread(Task& task)
+    {
+        const std::lock_guard lock(mutex);
+        if (mainThreadTasks.empty())
+            return false;
+
+        task = std::move(mainThreadTasks.front());
+        mainThreadTasks.pop_front();
+        mainThreadQueued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Run a task whose exceptions can't be delivered to anyone, and report what it writes to sf::err()
+    void execute(const Task& task)
+    {
+        priv::ErrCapture capture;
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            err() << "Exception thrown by a task: " << e.what() << std::endl;
+        }
+        catch (...)
+        {
+            err() << "Unknown exception thrown by a task" << std::endl;
+        }
+
+        report(capture.take());
+    }
+
+    // Hand messages to the main thread, sf::err() isn't thread-safe
+    void report(std::string&& text)
+    {
+        if (text.empty())
+            return;
+
+        {
+            const std::lock_guard lock(mutex);
+            messages += text;
+            messagesQueued.store(true, std::memory_order_release);
+        }
+
+        if (std::this_thread::get_id() == mainThread.load(std::memory_order_relaxed))
+            reportMessages();
+    }
+
+    // Write the messages of the tasks to sf::err(), from the main thread
+    void reportMessages()
+    {
+        if (!messagesQueued.load(std::memory_order_acquire))
+            return;
+
+        std::string text;
+        {
+            const std::lock_guard lock(mutex);
+            text.swap(messages);
+            messagesQueued.store(false, std::memory_order_relaxed);
+        }
+
+        err() << text << std::flush;
+    }
+
+    void notifyAll()
+    {
+        // Synchronize with the threads about to sleep, so that they don't miss the notification
+        {
+            const std::lock_guard lock(mutex);
+        }
+
+        condition.notify_all();
+    }
+
+    void run(std::size_t index)
+    {
+        TaskSchedulerImpl::currentScheduler = this;
+        TaskSchedulerImpl::currentWorker    = index;
+
+        for (;;)
+        {
+            Task task;
+            if (pop(task))
+            {
+                execute(task);
+                continue;
+            }
+
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [this] { return stop || (queued.load(std::memory_order_acquire) > 0); });
+
+            // Pending tasks are finished before stopping
+            if (stop && (queued.load(std::memory_order_acquire) == 0))
+                return;
+        }
+    }
+
+    std::atomic<std::thread::id>         mainThread;         //!< Thread that constructed the scheduler, or set as main
+    std::vector<std::unique_ptr<Worker>> workers;            //!< Worker threads
+    std::mutex                           mutex;              //!< Mutex protecting the shared queues and the sleeps
+    std::condition_variable              condition;          //!< Signaled when tasks are queued or groups finish
+    std::deque<Task>                     sharedTasks;        //!< Tasks submitted from outside the workers
+    std::deque<Task>                     mainThreadTasks;    //!< Tasks bound to the main thread
+    std::atomic<std::size_t>             queued{};           //!< Number of tasks in the worker and shared queues
+    std::atomic<std::size_t>             mainThreadQueued{}; //!< Number of tasks bound to the main thread
+    std::string                          messages;           //!< Messages of the tasks, to report from the main thread
+    std::atomic<bool>                    messagesQueued{};   //!< Are there messages to report?
+    bool                                 stop{};             //!< Stop the workers once the queues are empty?
+};
+
+
+////////////////////////////////////////////////////////////
+TaskScheduler::TaskGroup::TaskGroup(TaskScheduler& scheduler) : m_scheduler(scheduler)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TaskScheduler::TaskGroup::~TaskGroup()
+{
+    // Don't rethrow the exceptions of the tasks, destructors must not throw
+    m_scheduler.wait(m_pending);
+    reportMessages();
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::TaskGroup::run(Task task)
+{
+    m_scheduler.push(wrap(std::move(task)), false);
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::TaskGroup::runOnMainThread(Task task)
+{
+    m_scheduler.push(wrap(std::move(task)), true);
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::TaskGroup::wait()
+{
+    m_scheduler.wait(m_pending);
+    reportMessages();
+
+    // All the tasks are finished, so nothing else accesses the exception
+    if (m_failed.load(std::memory_order_acquire))
+    {
+        const std::exception_ptr exception = std::exchange(m_exception, nullptr);
+        m_failed.store(false, std::memory_order_relaxed);
+        std::rethrow_exception(exception);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TaskScheduler::TaskGroup::isDone() const
+{
+    return m_pending.load(std::memory_order_acquire) == 0;
+}
+
+
+////////////////////////////////////////////////////////////
+TaskScheduler::Task TaskScheduler::TaskGroup::wrap(Task task)
+{
+    m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    return [this, impl = m_scheduler.m_impl.get(), task = std::move(task)]
+    {
+        {
+            // The messages are reported by the thread waiting for the group, sf::err() isn't thread-safe
+            priv::ErrCapture capture;
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                // Only the first exception is kept, and only its task writes it
+                if (!m_failed.exchange(true, std::memory_order_relaxed))
+                    m_exception = std::current_exception();
+            }
+
+            if (std::string text = capture.take(); !text.empty())
+            {
+                const std::lock_guard lock(m_mutex);
+                m_messages += text;
+            }
+        }
+
+        // The group may be destroyed as soon as the counter reaches zero, only the scheduler can be used afterwards
+        if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            impl->notifyAll();
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::TaskGroup::reportMessages()
+{
+    std::string text;
+    {
+        const std::lock_guard lock(m_mutex);
+        text.swap(m_messages);
+    }
+
+    if (!text.empty())
+        err() << text << std::flush;
+}
+
+
+////////////////////////////////////////////////////////////
+TaskScheduler::TaskScheduler(unsigned int workerCount) : m_impl(std::make_unique<Impl>(workerCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TaskScheduler::~TaskScheduler() = default;
+
+
+////////////////////////////////////////////////////////////
+unsigned int TaskScheduler::getWorkerCount() const
+{
+    return static_cast<unsigned int>(m_impl->workers.size());
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::run(Task task)
+{
+    push(std::move(task), false);
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::runOnMainThread(Task task)
+{
+    push(std::move(task), true);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TaskScheduler::runMainThreadTasks()
+{
+    if (!isMainThread())
+        return 0;
+
+    m_impl->reportMessages();
+
+    // Tasks bound to the main thread by these tasks will run on the next call
+    std::deque<Task> tasks;
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        tasks.swap(m_impl->mainThreadTasks);
+        m_impl->mainThreadQueued.store(0, std::memory_order_relaxed);
+    }
+
+    for (const Task& task : tasks)
+        m_impl->execute(task);
+
+    return tasks.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::setMainThread()
+{
+    assert(!m_impl->isWorkerThread() && "TaskScheduler::setMainThread() cannot be called from a worker thread");
+
+    m_impl->mainThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    // Wake up the new main thread if it is waiting while tasks are bound to it
+    m_impl->notifyAll();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TaskScheduler::isMainThread() const
+{
+    return std::this_thread::get_id() == m_impl->mainThread.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+TaskScheduler& TaskScheduler::getDefault()
+{
+    static TaskScheduler scheduler(
+        []
+        {
+            // The calling thread becomes the main thread of the scheduler, it can't belong to another one
+            assert(TaskSchedulerImpl::currentScheduler == nullptr &&
+                   "TaskScheduler::getDefault() must first be called from a thread that isn't a worker thread");
+
+            TaskSchedulerImpl::defaultCreated = true;
+
+            const unsigned int workerCount = TaskSchedulerImpl::defaultWorkerCount;
+            return workerCount == TaskSchedulerImpl::unsetWorkerCount ? getHardwareWorkerCount() : workerCount;
+        }());
+
+    return scheduler;
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::setDefaultWorkerCount(unsigned int workerCount)
+{
+    if (TaskSchedulerImpl::defaultCreated)
+    {
+        err() << "Failed to set the worker count of the default task scheduler (it is already created)" << std::endl;
+        return;
+    }
+
+    TaskSchedulerImpl::defaultWorkerCount = workerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TaskScheduler::getHardwareWorkerCount()
+{
+    // hardware_concurrency() returns 0 when the number of cores can't be determined
+    return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::push(Task task, bool mainThread)
+{
+    // The main thread reports the messages of the tasks whenever it uses the scheduler
+    if (isMainThread())
+        m_impl->reportMessages();
+
+    if (mainThread)
+    {
+        m_impl->pushMainThread(std::move(task));
+        return;
+    }
+
+    // Without worker threads, tasks run right away on the calling thread
+    if (m_impl->workers.empty())
+    {
+        m_impl->execute(task);
+        return;
+    }
+
+    m_impl->push(std::move(task));
+}
+
+
+////////////////////////////////////////////////////////////
+void TaskScheduler::wait(const std::atomic<std::size_t>& pending)
+{
+    Impl&      impl       = *m_impl;
+    const bool mainThread = isMainThread();
+
+    const auto canProceed = [&]
+    {
+        return (pending.load(std::memory_order_acquire) == 0) || (impl.queued.load(std::memory_order_acquire) > 0) ||
+               (mainThread && (impl.mainThreadQueued.load(std::memory_order_acquire) > 0));
+    };
+
+    while (pending.load(std::memory_order_acquire) > 0)
+    {
+        // Run pending tasks instead of blocking, so that nested waits can't starve the workers
+        Task task;
+        if ((mainThread && impl.popMainThread(task)) || impl.pop(task))
+        {
+            impl.execute(task);
+            continue;
+        }
+
+        std::unique_lock lock(impl.mutex);
+        impl.condition.wait(lock, canProceed);
+    }
+
+    if (mainThread)
+        impl.reportMessages();
+}
+
+} // namespace sf
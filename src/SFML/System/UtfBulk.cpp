@@ -0,0 +1,500 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Utf.hpp>
+#include <SFML/System/UtfBulk.hpp>
+
+#include <array>
+#include <iterator>
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SFML_UTF_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SFML_UTF_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+// Both instruction sets are part of the baseline of their architecture,
+// so they can be used unconditionally; other targets use plain loops
+// (8 bytes at a time for UTF-8) which compilers auto-vectorize when possible
+
+////////////////////////////////////////////////////////////
+// Number of leading bytes below 0x80
+std::size_t countAscii(const std::uint8_t* data, std::size_t size)
+{
+    std::size_t count = 0;
+
+#if defined(SFML_UTF_SSE2)
+    for (; count + 16 <= size; count += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count));
+        if (_mm_movemask_epi8(chunk) != 0)
+            break;
+    }
+#elif defined(SFML_UTF_NEON)
+    for (; count + 16 <= size; count += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8(data + count)) >= 0x80)
+            break;
+    }
+#else
+    for (; count + 8 <= size; count += 8)
+    {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data + count, sizeof(word));
+        if ((word & 0x8080808080808080) != 0)
+            break;
+    }
+#endif
+
+    // Find the exact end of the run in the last chunk
+    while ((count < size) && (data[count] < 0x80))
+        ++count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of leading code points below 0x80
+std::size_t countAscii(const char32_t* data, std::size_t size)
+{
+    std::size_t count = 0;
+
+#if defined(SFML_UTF_SSE2)
+    const __m128i nonAscii = _mm_set1_epi32(~0x7F);
+    for (; count + 8 <= size; count += 8)
+    {
+        const __m128i first  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count + 4));
+        const __m128i bits   = _mm_and_si128(_mm_or_si128(first, second), nonAscii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(bits, _mm_setzero_si128())) != 0xFFFF)
+            break;
+    }
+#elif defined(SFML_UTF_NEON)
+    for (; count + 8 <= size; count += 8)
+    {
+        const uint32x4_t first  = vld1q_u32(reinterpret_cast<const std::uint32_t*>(data + count));
+        const uint32x4_t second = vld1q_u32(reinterpret_cast<const std::uint32_t*>(data + count + 4));
+        if (vmaxvq_u32(vorrq_u32(first, second)) >= 0x80)
+            break;
+    }
+#endif
+
+    while ((count < size) && (data[count] < 0x80))
+        ++count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of leading code units which are not surrogates
+std::size_t countNonSurrogates(const char16_t* data, std::size_t size)
+{
+    std::size_t count = 0;
+
+#if defined(SFML_UTF_SSE2)
+    const __m128i mask      = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i surrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+    for (; count + 8 <= size; count += 8)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, mask), surrogate)) != 0)
+            break;
+    }
+#elif defined(SFML_UTF_NEON)
+    for (; count + 8 <= size; count += 8)
+    {
+        const uint16x8_t chunk = vld1q_u16(reinterpret_cast<const std::uint16_t*>(data + count));
+        if (vmaxvq_u16(vceqq_u16(vandq_u16(chunk, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800))) != 0)
+            break;
+    }
+#endif
+
+    while ((count < size) && ((data[count] & 0xF800) != 0xD800))
+        ++count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of leading code points below the surrogate range
+std::size_t countBelowSurrogates(const char32_t* data, std::size_t size)
+{
+    std::size_t count = 0;
+
+#if defined(SFML_UTF_SSE2)
+    // SSE2 only has signed comparisons: flip the sign bits to compare unsigned values
+    const __m128i sign  = _mm_set1_epi32(static_cast<int>(0x80000000));
+    const __m128i limit = _mm_xor_si128(_mm_set1_epi32(0xD800), sign);
+    for (; count + 4 <= size; count += 4)
+    {
+        const __m128i chunk = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + count)), sign);
+        if (_mm_movemask_epi8(_mm_cmplt_epi32(chunk, limit)) != 0xFFFF)
+            break;
+    }
+#elif defined(SFML_UTF_NEON)
+    for (; count + 4 <= size; count += 4)
+    {
+        if (vmaxvq_u32(vld1q_u32(reinterpret_cast<const std::uint32_t*>(data + count))) >= 0xD800)
+            break;
+    }
+#endif
+
+    while ((count < size) && (data[count] < 0xD800))
+        ++count;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+// Widen ASCII bytes to UTF-32
+void widen(const std::uint8_t* input, std::size_t count, char32_t* output)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_UTF_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i low   = _mm_unpacklo_epi8(chunk, zero);
+        const __m128i high  = _mm_unpackhi_epi8(chunk, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 12), _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(SFML_UTF_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t chunk    = vld1q_u8(input + i);
+        const uint16x8_t low      = vmovl_u8(vget_low_u8(chunk));
+        const uint16x8_t high     = vmovl_u8(vget_high_u8(chunk));
+        auto*            output32 = reinterpret_cast<std::uint32_t*>(output + i);
+        vst1q_u32(output32, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(output32 + 4, vmovl_u16(vget_high_u16(low)));
+        vst1q_u32(output32 + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(output32 + 12, vmovl_u16(vget_high_u16(high)));
+    }
+#endif
+
+    for (; i < count; ++i)
+        output[i] = input[i];
+}
+
+
+////////////////////////////////////////////////////////////
+// Narrow ASCII code points to bytes
+void narrow(const char32_t* input, std::size_t count, std::uint8_t* output)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_UTF_SSE2)
+    for (; i + 16 <= count; i += 16)
+    {
+        // All values are below 0x80, so saturating packs are exact
+        const auto*   input128 = reinterpret_cast<const __m128i*>(input + i);
+        const __m128i low      = _mm_packs_epi32(_mm_loadu_si128(input128), _mm_loadu_si128(input128 + 1));
+        const __m128i high     = _mm_packs_epi32(_mm_loadu_si128(input128 + 2), _mm_loadu_si128(input128 + 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(SFML_UTF_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        const auto*      input32 = reinterpret_cast<const std::uint32_t*>(input + i);
+        const uint16x8_t packed  = vcombine_u16(vmovn_u32(vld1q_u32(input32)), vmovn_u32(vld1q_u32(input32 + 4)));
+        vst1_u8(output + i, vmovn_u16(packed));
+    }
+#endif
+
+    for (; i < count; ++i)
+        output[i] = static_cast<std::uint8_t>(input[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of bytes sf::Utf8::encode writes for a code point
+std::size_t getUtf8Length(char32_t codepoint)
+{
+    if ((codepoint > 0x0010FFFF) || ((codepoint >= 0xD800) && (codepoint <= 0xDBFF)))
+        return 0;
+
+    return std::size_t{1} + (codepoint >= 0x80) + (codepoint >= 0x800) + (codepoint >= 0x10000);
+}
+
+
+////////////////////////////////////////////////////////////
+// Same as sf::Utf8::encode, but writing to a pointer
+std::uint8_t* encodeUtf8(char32_t codepoint, std::uint8_t* output)
+{
+    static constexpr std::array<std::uint8_t, 5> firstBytes = {0x00, 0x00, 0xC0, 0xE0, 0xF0};
+
+    const std::size_t length = getUtf8Length(codepoint);
+    for (std::size_t i = length; i > 1; --i)
+    {
+        output[i - 1] = static_cast<std::uint8_t>((codepoint | 0x80) & 0xBF);
+        codepoint >>= 6;
+    }
+
+    if (length > 0)
+        output[0] = static_cast<std::uint8_t>(codepoint | firstBytes[length]);
+
+    return output + length;
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of code units sf::Utf16::encode writes for a code point
+std::size_t getUtf16Length(char32_t codepoint)
+{
+    if (codepoint <= 0xFFFF)
+        return ((codepoint >= 0xD800) && (codepoint <= 0xDFFF)) ? 0 : 1;
+
+    return (codepoint > 0x0010FFFF) ? 0 : 2;
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void utf8ToUtf32(const std::uint8_t* begin, const std::uint8_t* end, std::u32string& output)
+{
+    // Each byte produces at most one code point: write to the upper bound, then trim
+    const std::size_t offset = output.size();
+    output.resize(offset + static_cast<std::size_t>(end - begin));
+    char32_t* out = output.data() + offset;
+
+    while (begin != end)
+    {
+        if (*begin < 0x80)
+        {
+            const std::size_t count = countAscii(begin, static_cast<std::size_t>(end - begin));
+            widen(begin, count, out);
+            begin += count;
+            out += count;
+        }
+        else
+        {
+            begin = Utf8::decode(begin, end, *out++);
+        }
+    }
+
+    output.resize(static_cast<std::size_t>(out - output.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void utf16ToUtf32(const char16_t* begin, const char16_t* end, std::u32string& output)
+{
+    const std::size_t offset = output.size();
+    output.resize(offset + static_cast<std::size_t>(end - begin));
+    char32_t* out = output.data() + offset;
+
+    while (begin != end)
+    {
+        if ((*begin & 0xF800) != 0xD800)
+        {
+            const std::size_t count = countNonSurrogates(begin, static_cast<std::size_t>(end - begin));
+            for (std::size_t i = 0; i < count; ++i)
+                *out++ = *begin++;
+        }
+        else
+        {
+            begin = Utf16::decode(begin, end, *out++);
+        }
+    }
+
+    output.resize(static_cast<std::size_t>(out - output.data()));
+}
+
+
+////////////////////////////////////////////////////////////
+void ansiToUtf32(const char* begin, const char* end, std::u32string& output, const std::locale& locale)
+{
+    // ASCII is encoded the same way in all the supported ANSI code pages
+    const auto*       bytes  = reinterpret_cast<const std::uint8_t*>(begin);
+    const std::size_t count  = countAscii(bytes, static_cast<std::size_t>(end - begin));
+    const std::size_t offset = output.size();
+    output.resize(offset + count);
+    widen(bytes, count, output.data() + offset);
+
+    // Let the locale convert the rest
+    Utf32::fromAnsi(begin + count, end, std::back_inserter(output), locale);
+}
+
+
+////////////////////////////////////////////////////////////
+void utf32ToUtf8(const char32_t* begin, const char32_t* end, U8String& output)
+{
+    // Compute the exact size first, so that the output doesn't keep more memory than needed
+    std::size_t length = 0;
+    for (const char32_t* codepoint = begin; codepoint != end;)
+    {
+        if (*codepoint < 0x80)
+        {
+            const std::size_t count = countAscii(codepoint, static_cast<std::size_t>(end - codepoint));
+            length += count;
+            codepoint += count;
+        }
+        else
+        {
+            length += getUtf8Length(*codepoint++);
+        }
+    }
+
+    const std::size_t offset = output.size();
+    output.resize(offset + length);
+    std::uint8_t* out = output.data() + offset;
+
+    while (begin != end)
+    {
+        if (*begin < 0x80)
+        {
+            const std::size_t count = countAscii(begin, static_cast<std::size_t>(end - begin));
+            narrow(begin, count, out);
+            begin += count;
+            out += count;
+        }
+        else
+        {
+            out = encodeUtf8(*begin++, out);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void utf32ToUtf16(const char32_t* begin, const char32_t* end, std::u16string& output)
+{
+    std::size_t length = 0;
+    for (const char32_t* codepoint = begin; codepoint != end; ++codepoint)
+        length += getUtf16Length(*codepoint);
+
+    const std::size_t offset = output.size();
+    output.resize(offset + length);
+    char16_t* out = output.data() + offset;
+
+    while (begin != end)
+    {
+        if (*begin < 0xD800)
+        {
+            const std::size_t count = countBelowSurrogates(begin, static_cast<std::size_t>(end - begin));
+            for (std::size_t i = 0; i < count; ++i)
+                *out++ = static_cast<char16_t>(*begin++);
+        }
+        else
+        {
+            // The code point may need a surrogate pair
+            out = Utf16::encode(*begin++, out);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void utf32ToAnsi(const char32_t* begin, const char32_t* end, std::string& output, const std::locale& locale)
+{
+    const std::size_t count  = countAscii(begin, static_cast<std::size_t>(end - begin));
+    const std::size_t offset = output.size();
+    output.resize(offset + count);
+    narrow(begin, count, reinterpret_cast<std::uint8_t*>(output.data() + offset));
+
+    Utf32::toAnsi(begin + count, end, std::back_inserter(output), 0, locale);
+}
+
+
+////////////////////////////////////////////////////////////
+bool isValidUtf8(const std::uint8_t* begin, const std::uint8_t* end)
+{
+    while (begin != end)
+    {
+        begin += countAscii(begin, static_cast<std::size_t>(end - begin));
+        if (begin == end)
+            break;
+
+        // Check the length of the sequence and the range of its second byte,
+        // which is enough to reject overlong forms, surrogates and values above U+10FFFF
+        // See table 3-7 "Well-Formed UTF-8 Byte Sequences" of the Unicode standard
+        const std::uint8_t lead   = *begin;
+        std::size_t        length = 0;
+        std::uint8_t       lower  = 0x80;
+        std::uint8_t       upper  = 0xBF;
+
+        if ((lead >= 0xC2) && (lead <= 0xDF))
+        {
+            length = 2;
+        }
+        else if ((lead >= 0xE0) && (lead <= 0xEF))
+        {
+            length = 3;
+            lower  = (lead == 0xE0) ? 0xA0 : 0x80;
+            upper  = (lead == 0xED) ? 0x9F : 0xBF;
+        }
+        else if ((lead >= 0xF0) && (lead <= 0xF4))
+        {
+            length = 4;
+            lower  = (lead == 0xF0) ? 0x90 : 0x80;
+            upper  = (lead == 0xF4) ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (static_cast<std::size_t>(end - begin) < length)
+            return false;
+
+        if ((begin[1] < lower) || (begin[1] > upper))
+            return false;
+
+        for (std::size_t i = 2; i < length; ++i)
+        {
+            if ((begin[i] & 0xC0) != 0x80)
+                return false;
+        }
+
+        begin += length;
+    }
+
+    return true;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/String.hpp>
+
+#include <locale>
+#include <string>
+
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Bulk conversions between contiguous strings
+//
+// Each function appends to `output` exactly what the matching
+// sf::Utf function would, code point by code point. Runs of
+// code units which convert one to one (ASCII for UTF-8 and
+// ANSI, non-surrogates for UTF-16) are detected and converted
+// 16 bytes at a time, with SSE2 on x86-64 and NEON on ARM64;
+// only the remaining code points go through sf::Utf.
+//
+////////////////////////////////////////////////////////////
+namespace sf::priv
+{
+void utf8ToUtf32(const std::uint8_t* begin, const std::uint8_t* end, std::u32string& output);
+
+void utf16ToUtf32(const char16_t* begin, const char16_t* end, std::u32string& output);
+
+void ansiToUtf32(const char* begin, const char* end, std::u32string& output, const std::locale& locale);
+
+void utf32ToUtf8(const char32_t* begin, const char32_t* end, U8String& output);
+
+void utf32ToUtf16(const char32_t* begin, const char32_t* end, std::u16string& output);
+
+void utf32ToAnsi(const char32_t* begin, const char32_t* end, std::string& output, const std::locale& locale);
+
+////////////////////////////////////////////////////////////
+// Strict UTF-8 validation: rejects overlong forms, surrogates,
+// code points above U+10FFFF and truncated sequences
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isValidUtf8(const std::uint8_t* begin, const std::uint8_t* end);
+
+} // namespace sf::priv
@@ -30,7 +30,6 @@
 #include <SFML/Window/WindowImpl.hpp>
 
 #include <SFML/System/Err.hpp>
-#include <SFML/System/Sleep.hpp>
 
 #include <ostream>
 
@@ -165,9 +164,30 @@ void Window::setVerticalSyncEnabled(bool enabled)
 void Window::setFramerateLimit(unsigned int limit)
 {
     if (limit > 0)
-        m_frameTimeLimit = seconds(1.f / static_cast<float>(limit));
+        m_framePacer.setFrameTime(seconds(1.f / static_cast<float>(limit)));
     else
-        m_frameTimeLimit = Time::Zero;
+        m_framePacer.setFrameTime(Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::setFramePacing(FramePacer::Mode mode, Time slack)
+{
+    m_framePacer.setMode(mode, slack);
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacer::Statistics Window::getFrameStatistics() const
+{
+    return m_framePacer.getStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+void Window::resetFrameStatistics()
+{
+    m_framePacer.resetStatistics();
 }
 
 
@@ -196,12 +216,8 @@ void Window::display()
     if (setActive())
         m_context->display();
 
-    // Limit the framerate if needed
-    if (m_frameTimeLimit != Time::Zero)
-    {
-        sleep(m_frameTimeLimit - m_clock.getElapsedTime());
-        m_clock.restart();
-    }
+    // Limit the framerate if needed, and measure the frame time
+    m_framePacer.endFrame();
 }
 
 
@@ -213,7 +229,8 @@ void Window::initialize()
     setFramerateLimit(0);
 
     // Reset frame time
-    m_clock.restart();
+    m_framePacer.restart();
+    m_framePacer.resetStatistics();
 
     // Activate the window
     if (!setActive())
@@ -268,6 +268,15 @@ void WindowBase::setTitle(const String& title)
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowBase::setTitle(U8StringView title)
+{
+    // The platform implementations need their own encoding anyway
+    if (m_impl)
+        m_impl->setTitle(String::fromUtf8(title));
+}
+
+
 ////////////////////////////////////////////////////////////
 void WindowBase::setIcon(Vector2u size, const std::uint8_t* pixels)
 {
@@ -3,6 +3,7 @@
 // Other 1st party headers
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Time.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -148,6 +149,26 @@ TEST_CASE("[Audio] sf::InputSoundFile")
                 CHECK(inputSoundFile.getTimeOffset() == sf::Time::Zero);
                 CHECK(inputSoundFile.getSampleOffset() == 0);
             }
+
+            SECTION("Mapped mp3")
+            {
+                sf::MappedFileInputStream stream("Audio/ding.mp3");
+                const sf::InputSoundFile  inputSoundFile(stream);
+                CHECK(inputSoundFile.getSampleCount() == 87'798);
+                CHECK(inputSoundFile.getChannelCount() == 1);
+                CHECK(inputSoundFile.getSampleRate() == 44'100);
+                CHECK(inputSoundFile.getDuration() == sf::microseconds(1'990'884));
+            }
+
+            SECTION("Mapped wav")
+            {
+                sf::MappedFileInputStream stream("Audio/killdeer.wav");
+                const sf::InputSoundFile  inputSoundFile(stream);
+                CHECK(inputSoundFile.getSampleCount() == 112'941);
+                CHECK(inputSoundFile.getChannelCount() == 1);
+                CHECK(inputSoundFile.getSampleRate() == 22'050);
+                CHECK(inputSoundFile.getDuration() == sf::microseconds(5'122'040));
+            }
         }
     }
 
@@ -5,6 +5,7 @@
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <optional>
 #include <type_traits>
 
 class DrawableTest : public sf::Drawable
@@ -15,6 +16,11 @@ public:
         return m_callCount;
     }
 
+    std::optional<sf::FloatRect> cullingBounds() const
+    {
+        return getCullingBounds();
+    }
+
 private:
     void draw(sf::RenderTarget&, sf::RenderStates) const override
     {
@@ -41,6 +47,7 @@ TEST_CASE("[Graphics] sf::Drawable", runDisplayTests())
     {
         const DrawableTest drawableTest;
         CHECK(drawableTest.callCount() == 0);
+        CHECK(!drawableTest.cullingBounds().has_value());
     }
 
     SECTION("draw()")
@@ -5,6 +5,7 @@
 
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -133,6 +134,19 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
             CHECK(texture.getNativeHandle() != 0);
             CHECK(font.isSmooth());
         }
+
+        SECTION("Mapped stream")
+        {
+            sf::MappedFileInputStream stream("Graphics/tuffy.ttf");
+            const sf::Font            font(stream);
+            CHECK(font.getInfo().family == "Tuffy");
+            const auto& glyph = font.getGlyph(0x45, 16, false);
+            CHECK(glyph.advance == 9);
+            CHECK(glyph.bounds == sf::FloatRect({0, -12}, {8, 12}));
+            CHECK(font.hasGlyph(0x41));
+            CHECK(font.getKerning(0x41, 0x42, 12) == -1);
+            CHECK(font.getLineSpacing(24) == 30);
+        }
     }
 
     SECTION("openFromFile()")
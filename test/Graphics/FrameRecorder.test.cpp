@@ -0,0 +1,200 @@
+#include <SFML/Graphics/FrameRecorder.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/SoftwareRenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+std::vector<std::uint8_t> readFile(const std::filesystem::path& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::FrameRecorder")
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-frame-recorder-test";
+    std::filesystem::remove_all(directory);
+
+    sf::Image image({3, 2}, sf::Color::Red);
+    image.setPixel({2, 1}, sf::Color(10, 20, 30, 40));
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::FrameRecorder>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::FrameRecorder>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::FrameRecorder>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::FrameRecorder>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::FrameRecorder recorder;
+        CHECK(!recorder.isRecording());
+        CHECK(recorder.getStatistics().capturedFrames == 0);
+        CHECK(recorder.getStatistics().pendingFrames == 0);
+    }
+
+    SECTION("start()/stop()")
+    {
+        sf::FrameRecorder recorder;
+        CHECK(!recorder.capture(image));
+
+        REQUIRE(recorder.start(directory));
+        CHECK(recorder.isRecording());
+        CHECK(std::filesystem::is_directory(directory));
+
+        recorder.stop();
+        CHECK(!recorder.isRecording());
+        CHECK(!recorder.capture(image));
+    }
+
+    SECTION("Raw format")
+    {
+        sf::FrameRecorder recorder;
+        REQUIRE(recorder.start(directory, {sf::FrameRecorder::Format::Raw}));
+        CHECK(recorder.capture(image));
+        CHECK(recorder.capture(image));
+        recorder.stop();
+
+        const std::vector<std::uint8_t> pixels = readFile(directory / "frame_000001.rgba");
+        REQUIRE(pixels.size() == 3 * 2 * 4);
+        CHECK(std::equal(pixels.begin(), pixels.end(), image.getPixelsPtr()));
+
+        const sf::FrameRecorder::Statistics statistics = recorder.getStatistics();
+        CHECK(statistics.capturedFrames == 2);
+        CHECK(statistics.writtenFrames == 2);
+        CHECK(statistics.droppedFrames == 0);
+        CHECK(statistics.failedFrames == 0);
+        CHECK(statistics.pendingFrames == 0);
+    }
+
+    SECTION("QOI format")
+    {
+        sf::FrameRecorder recorder;
+        REQUIRE(recorder.start(directory, {sf::FrameRecorder::Format::Qoi}));
+        CHECK(recorder.capture(image));
+        recorder.stop();
+
+        // Red is encoded as a small difference from the initial black
+        const std::vector<std::uint8_t> expected = {'q', 'o', 'i', 'f', 0, 0, 0, 3, 0, 0, 0, 2, 4, 0, // Header
+                                                    0x5A,                                             // Red
+                                                    0xC3,                                             // Run of 4
+                                                    0xFF, 10, 20, 30, 40,                             // Last pixel
+                                                    0, 0, 0, 0, 0, 0, 0, 1};                          // End marker
+        CHECK(readFile(directory / "frame_000000.qoi") == expected);
+    }
+
+    SECTION("PNG format")
+    {
+        sf::FrameRecorder recorder;
+        REQUIRE(recorder.start(directory));
+        CHECK(recorder.capture(image));
+        recorder.stop();
+
+        const sf::Image written(directory / "frame_000000.png");
+        CHECK(written.getSize() == image.getSize());
+        CHECK(written.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(written.getPixel({2, 1}) == sf::Color(10, 20, 30, 40));
+    }
+
+    SECTION("Overflow policies")
+    {
+        sf::FrameRecorder::Settings settings;
+        settings.format        = sf::FrameRecorder::Format::Raw;
+        settings.encoderCount  = 1;
+        settings.queueCapacity = 1;
+
+        sf::FrameRecorder recorder;
+
+        SECTION("Drop")
+        {
+            REQUIRE(recorder.start(directory, settings));
+            for (int i = 0; i < 100; ++i)
+                recorder.capture(image);
+            recorder.stop();
+
+            // Every frame is either written or dropped, dropped frames leave gaps in the numbering
+            const sf::FrameRecorder::Statistics statistics = recorder.getStatistics();
+            CHECK(statistics.capturedFrames == 100);
+            CHECK(statistics.writtenFrames + statistics.droppedFrames == 100);
+            CHECK(std::filesystem::exists(directory / "frame_000000.rgba"));
+        }
+
+        SECTION("Block")
+        {
+            settings.overflowPolicy = sf::FrameRecorder::OverflowPolicy::Block;
+            REQUIRE(recorder.start(directory, settings));
+            for (int i = 0; i < 100; ++i)
+                CHECK(recorder.capture(image));
+            recorder.stop();
+
+            CHECK(recorder.getStatistics().writtenFrames == 100);
+            CHECK(recorder.getStatistics().droppedFrames == 0);
+            CHECK(std::filesystem::exists(directory / "frame_000099.rgba"));
+        }
+    }
+
+    SECTION("Software render target")
+    {
+        sf::SoftwareRenderTexture renderTexture({4, 4});
+        renderTexture.clear(sf::Color::Blue);
+
+        sf::FrameRecorder recorder;
+        REQUIRE(recorder.start(directory, {sf::FrameRecorder::Format::Raw}));
+        CHECK(recorder.capture(renderTexture));
+        recorder.stop();
+
+        const std::vector<std::uint8_t> pixels = readFile(directory / "frame_000000.rgba");
+        REQUIRE(pixels.size() == 4 * 4 * 4);
+        CHECK(pixels[0] == 0);
+        CHECK(pixels[2] == 255);
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("[Graphics] sf::FrameRecorder (render texture)", runDisplayTests())
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-frame-recorder-test";
+    std::filesystem::remove_all(directory);
+
+    sf::RenderTexture renderTexture({4, 2});
+    sf::FrameRecorder recorder;
+    REQUIRE(recorder.start(directory, {sf::FrameRecorder::Format::Raw}));
+
+    // More frames than pixel buffers, so that some are collected while capturing
+    for (int i = 0; i < 5; ++i)
+    {
+        renderTexture.clear(sf::Color(static_cast<std::uint8_t>(i * 10), 0, 0));
+        CHECK(recorder.capture(renderTexture));
+    }
+
+    recorder.stop();
+    CHECK(recorder.getStatistics().writtenFrames == 5);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        const std::vector<std::uint8_t> pixels = readFile(directory / ("frame_00000" + std::to_string(i) + ".rgba"));
+        REQUIRE(pixels.size() == 4 * 2 * 4);
+        CHECK(pixels[0] == i * 10);
+    }
+
+    std::filesystem::remove_all(directory);
+}
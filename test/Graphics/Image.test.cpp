@@ -3,6 +3,7 @@
 // Other 1st party headers
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -137,6 +138,16 @@ TEST_CASE("[Graphics] sf::Image")
             CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
         }
 
+        SECTION("Mapped stream constructor")
+        {
+            sf::MappedFileInputStream stream("Graphics/sfml-logo-big.png");
+            const sf::Image           image(stream);
+            CHECK(image.getSize() == sf::Vector2u(1001, 304));
+            CHECK(image.getPixelsPtr() != nullptr);
+            CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+            CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        }
+
         SECTION("Vector2 constructor")
         {
             const sf::Image image(sf::Vector2u(10, 10));
@@ -0,0 +1,188 @@
+#include <SFML/Graphics/IndexBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+#include <cstdint>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::IndexBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::IndexBuffer>);
+        STATIC_CHECK(std::is_nothrow_swappable_v<sf::IndexBuffer>);
+    }
+
+    // Skip tests if index buffers aren't available
+    if (!sf::IndexBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::IndexBuffer indexBuffer;
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getNativeHandle() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::Uint16);
+            CHECK(indexBuffer.getIndexSize() == 2);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+
+        SECTION("Type constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::Uint32);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::Uint32);
+            CHECK(indexBuffer.getIndexSize() == 4);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Usage::Dynamic);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::Uint16);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+        }
+
+        SECTION("Type and usage constructor")
+        {
+            const sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::Uint32, sf::IndexBuffer::Usage::Stream);
+            CHECK(indexBuffer.getIndexCount() == 0);
+            CHECK(indexBuffer.getType() == sf::IndexBuffer::Type::Uint32);
+            CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Stream);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::IndexBuffer indexBuffer;
+        CHECK(indexBuffer.create(100));
+        CHECK(indexBuffer.getIndexCount() == 100);
+        CHECK(indexBuffer.getNativeHandle() != 0);
+    }
+
+    SECTION("update()")
+    {
+        const std::array<std::uint16_t, 6> shortIndices{0, 1, 2, 2, 1, 3};
+        const std::array<std::uint32_t, 6> longIndices{0, 1, 2, 2, 1, 3};
+
+        SECTION("Uninitialized buffer")
+        {
+            sf::IndexBuffer indexBuffer;
+            CHECK(!indexBuffer.update(shortIndices.data(), shortIndices.size()));
+        }
+
+        SECTION("16-bit indices")
+        {
+            sf::IndexBuffer indexBuffer;
+            CHECK(indexBuffer.create(6));
+            CHECK(!indexBuffer.update(static_cast<const std::uint16_t*>(nullptr), 6));
+            CHECK(!indexBuffer.update(shortIndices.data(), 6, 3));
+            CHECK(!indexBuffer.update(longIndices.data(), 6));
+            CHECK(indexBuffer.update(shortIndices.data(), 6));
+            CHECK(indexBuffer.getIndexCount() == 6);
+        }
+
+        SECTION("32-bit indices")
+        {
+            sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::Uint32);
+            CHECK(indexBuffer.create(6));
+            CHECK(!indexBuffer.update(shortIndices.data(), 6));
+            CHECK(indexBuffer.update(longIndices.data(), 6));
+            CHECK(indexBuffer.getIndexCount() == 6);
+        }
+
+        SECTION("Another buffer")
+        {
+            sf::IndexBuffer indexBuffer;
+            sf::IndexBuffer otherIndexBuffer(sf::IndexBuffer::Type::Uint32);
+
+            CHECK(!indexBuffer.update(otherIndexBuffer));
+            CHECK(otherIndexBuffer.create(42));
+            CHECK(!indexBuffer.update(otherIndexBuffer));
+        }
+    }
+
+    SECTION("swap()")
+    {
+        sf::IndexBuffer indexBuffer1(sf::IndexBuffer::Type::Uint16, sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer1.create(50));
+
+        sf::IndexBuffer indexBuffer2(sf::IndexBuffer::Type::Uint32, sf::IndexBuffer::Usage::Stream);
+        CHECK(indexBuffer2.create(60));
+
+        sf::swap(indexBuffer1, indexBuffer2);
+
+        CHECK(indexBuffer1.getIndexCount() == 60);
+        CHECK(indexBuffer1.getType() == sf::IndexBuffer::Type::Uint32);
+        CHECK(indexBuffer1.getUsage() == sf::IndexBuffer::Usage::Stream);
+
+        CHECK(indexBuffer2.getIndexCount() == 50);
+        CHECK(indexBuffer2.getType() == sf::IndexBuffer::Type::Uint16);
+        CHECK(indexBuffer2.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::IndexBuffer indexBuffer;
+        indexBuffer.setUsage(sf::IndexBuffer::Usage::Dynamic);
+        CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        // A quad made of 4 vertices and 6 indices, covering the whole target
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::Red},
+                                     sf::Vertex{{100, 0}, sf::Color::Red},
+                                     sf::Vertex{{0, 100}, sf::Color::Red},
+                                     sf::Vertex{{100, 100}, sf::Color::Red}};
+        const std::array<std::uint16_t, 6> indices{0, 1, 2, 2, 1, 3};
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear();
+
+        SECTION("Client memory")
+        {
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices.data(),
+                               indices.size(),
+                               sf::PrimitiveType::Triangles);
+        }
+
+        SECTION("Buffers")
+        {
+            sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles);
+            REQUIRE(vertexBuffer.create(vertices.size()));
+            REQUIRE(vertexBuffer.update(vertices.data()));
+
+            sf::IndexBuffer indexBuffer;
+            REQUIRE(indexBuffer.create(indices.size()));
+            REQUIRE(indexBuffer.update(indices.data(), indices.size()));
+
+            renderTexture.draw(vertexBuffer, indexBuffer);
+        }
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({10, 10}) == sf::Color::Red);
+        CHECK(image.getPixel({90, 90}) == sf::Color::Red);
+    }
+}
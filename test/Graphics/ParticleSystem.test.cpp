@@ -0,0 +1,179 @@
+#include <SFML/Graphics/ParticleSystem.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ParticleSystem", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ParticleSystem>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ParticleSystem>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::ParticleSystem>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::ParticleSystem>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ParticleSystem particles(100);
+        CHECK(particles.getCapacity() == 100);
+        CHECK(particles.getParticleCount() == 0);
+        CHECK(particles.getTexture() == nullptr);
+        CHECK(particles.getTextureRect() == sf::IntRect());
+        CHECK(particles.getParticleSize() == sf::Vector2f(1, 1));
+        CHECK(particles.getAcceleration() == sf::Vector2f());
+        CHECK(!particles.isFadeOutEnabled());
+        CHECK(particles.getThreadCount() == 1);
+    }
+
+    SECTION("Set/get properties")
+    {
+        const sf::Texture  texture(sf::Vector2u(8, 4));
+        sf::ParticleSystem particles(10);
+
+        particles.setTexture(&texture);
+        CHECK(particles.getTexture() == &texture);
+        CHECK(particles.getTextureRect() == sf::IntRect({0, 0}, {8, 4}));
+        particles.setTextureRect({{4, 0}, {4, 4}});
+        CHECK(particles.getTextureRect() == sf::IntRect({4, 0}, {4, 4}));
+        particles.setTexture(nullptr);
+        CHECK(particles.getTexture() == nullptr);
+
+        particles.setParticleSize({3, 4});
+        CHECK(particles.getParticleSize() == sf::Vector2f(3, 4));
+        particles.setAcceleration({0, 9.8f});
+        CHECK(particles.getAcceleration() == sf::Vector2f(0, 9.8f));
+        particles.setFadeOutEnabled(true);
+        CHECK(particles.isFadeOutEnabled());
+        particles.setThreadCount(4);
+        CHECK(particles.getThreadCount() == 4);
+        particles.setThreadCount(0);
+        CHECK(particles.getThreadCount() == 1);
+    }
+
+    SECTION("emit()")
+    {
+        sf::ParticleSystem particles(2);
+        CHECK(!particles.emit({}, {}, sf::Color::White, sf::Time::Zero));
+        CHECK(particles.emit({1, 2}, {}, sf::Color::White, sf::seconds(1)));
+        CHECK(particles.emit({3, 4}, {}, sf::Color::White, sf::seconds(1)));
+        CHECK(!particles.emit({5, 6}, {}, sf::Color::White, sf::seconds(1)));
+        CHECK(particles.getParticleCount() == 2);
+        CHECK(particles.getParticlePosition(0) == sf::Vector2f(1, 2));
+        CHECK(particles.getParticlePosition(1) == sf::Vector2f(3, 4));
+
+        particles.clear();
+        CHECK(particles.getParticleCount() == 0);
+        CHECK(particles.emit({5, 6}, {}, sf::Color::White, sf::seconds(1)));
+    }
+
+    SECTION("update()")
+    {
+        sf::ParticleSystem particles(10);
+        particles.setAcceleration({0, 10});
+        CHECK(particles.emit({0, 0}, {10, 0}, sf::Color::White, sf::seconds(1.5f)));
+        CHECK(particles.emit({5, 5}, {0, 0}, sf::Color::White, sf::seconds(0.5f)));
+
+        particles.update(sf::seconds(1));
+        REQUIRE(particles.getParticleCount() == 1);
+        CHECK(particles.getParticlePosition(0) == Approx(sf::Vector2f(10, 10)));
+
+        particles.update(sf::seconds(0.25f));
+        REQUIRE(particles.getParticleCount() == 1);
+        CHECK(particles.getParticlePosition(0) == Approx(sf::Vector2f(12.5f, 13.125f)));
+
+        particles.update(sf::seconds(1));
+        CHECK(particles.getParticleCount() == 0);
+    }
+
+    SECTION("Multi-threaded update()")
+    {
+        sf::ParticleSystem singleThreaded(100'000);
+        singleThreaded.setAcceleration({1, 2});
+        for (int i = 0; i < 100'000; ++i)
+        {
+            const auto     value    = static_cast<float>(i % 1000);
+            const sf::Time lifetime = sf::seconds((value + 1) / 100);
+            CHECK(singleThreaded.emit({value, -value}, {value / 10, 1}, sf::Color::White, lifetime));
+        }
+
+        sf::ParticleSystem multiThreaded = singleThreaded;
+        multiThreaded.setThreadCount(4);
+
+        for (int step = 0; step < 3; ++step)
+        {
+            singleThreaded.update(sf::seconds(1));
+            multiThreaded.update(sf::seconds(1));
+        }
+
+        REQUIRE(multiThreaded.getParticleCount() == singleThreaded.getParticleCount());
+        CHECK(singleThreaded.getParticleCount() == 70'000);
+        for (std::size_t i = 0; i < singleThreaded.getParticleCount(); i += 997)
+            CHECK(multiThreaded.getParticlePosition(i) == Approx(singleThreaded.getParticlePosition(i)));
+    }
+
+    SECTION("Draw")
+    {
+        sf::RenderTexture  renderTexture({16, 16});
+        sf::ParticleSystem particles(10);
+        particles.setParticleSize({4, 4});
+        CHECK(particles.emit({4, 4}, {}, sf::Color::Red, sf::seconds(1)));
+        CHECK(particles.emit({12, 12}, {2, 0}, sf::Color::Blue, sf::seconds(1)));
+
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+        renderTexture.display();
+        sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Red);
+        CHECK(image.getPixel({12, 12}) == sf::Color::Blue);
+        CHECK(image.getPixel({8, 8}) == sf::Color::Green);
+
+        particles.update(sf::seconds(1.5f));
+        CHECK(particles.emit({4, 12}, {}, sf::Color::Yellow, sf::seconds(1)));
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+        renderTexture.display();
+        image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Green);
+        CHECK(image.getPixel({4, 12}) == sf::Color::Yellow);
+    }
+
+    SECTION("Draw after update")
+    {
+        sf::RenderTexture  renderTexture({16, 16});
+        sf::ParticleSystem particles(10);
+        particles.setParticleSize({4, 4});
+        CHECK(particles.emit({4, 4}, {8, 0}, sf::Color::Red, sf::seconds(10)));
+
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+        renderTexture.display();
+        sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Red);
+        CHECK(image.getPixel({12, 4}) == sf::Color::Green);
+
+        // The quads are now written by the update itself
+        particles.update(sf::seconds(1));
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+        renderTexture.display();
+        image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Green);
+        CHECK(image.getPixel({12, 4}) == sf::Color::Red);
+
+        particles.setParticleSize({8, 8});
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+        renderTexture.display();
+        image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({9, 1}) == sf::Color::Red);
+    }
+}
@@ -1,12 +1,16 @@
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <array>
+#include <vector>
 
 TEST_CASE("[Graphics] Render Tests", runDisplayTests())
 {
@@ -237,4 +241,106 @@ TEST_CASE("[Graphics] Render Tests", runDisplayTests())
             }
         }
     }
+
+    SECTION("State change statistics")
+    {
+        sf::RenderTexture        renderTexture({100, 100});
+        const sf::RectangleShape shape({100, 100});
+        renderTexture.draw(shape);
+
+        sf::RenderTarget::resetStateChangeStatistics();
+        CHECK(sf::RenderTarget::getStateChangeStatistics().issued == 0);
+        CHECK(sf::RenderTarget::getStateChangeStatistics().skipped == 0);
+
+        // Drawing the same shape again doesn't have to change any state
+        renderTexture.draw(shape);
+        renderTexture.draw(shape);
+        const sf::RenderTarget::StateChangeStatistics statistics = sf::RenderTarget::getStateChangeStatistics();
+        CHECK(statistics.issued == 0);
+        CHECK(statistics.skipped > 0);
+
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::White);
+    }
+
+    SECTION("View culling")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.setCullingEnabled(true);
+
+        sf::RectangleShape shape({40, 40});
+        shape.setFillColor(sf::Color::Red);
+
+        // Entirely outside of the view
+        shape.setPosition({200, 30});
+        renderTexture.draw(shape);
+        CHECK(renderTexture.getCulledDrawCount() == 1);
+
+        // Partially inside of the view
+        shape.setPosition({80, 30});
+        renderTexture.draw(shape);
+        CHECK(renderTexture.getCulledDrawCount() == 1);
+
+        // Moved outside of the view by the render states
+        renderTexture.draw(shape, sf::Transform().translate({-150, 0}));
+        CHECK(renderTexture.getCulledDrawCount() == 2);
+
+        // Outside of the scissor rectangle
+        sf::View view = renderTexture.getDefaultView();
+        view.setScissor(sf::FloatRect({0, 0}, {0.5f, 1}));
+        renderTexture.setView(view);
+        renderTexture.draw(shape);
+        CHECK(renderTexture.getCulledDrawCount() == 3);
+
+        renderTexture.resetCulledDrawCount();
+        CHECK(renderTexture.getCulledDrawCount() == 0);
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({90, 50}) == sf::Color::Red);
+        CHECK(image.getPixel({50, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Instanced drawing")
+    {
+        // Skip tests if instanced drawing isn't available
+        if (!sf::VertexBuffer::isAvailable() || !sf::Shader::isAvailable())
+            return;
+
+        // A 50x50 white quad
+        const std::array quad = {sf::Vertex{{0, 0}},
+                                 sf::Vertex{{50, 0}},
+                                 sf::Vertex{{0, 50}},
+                                 sf::Vertex{{0, 50}},
+                                 sf::Vertex{{50, 0}},
+                                 sf::Vertex{{50, 50}}};
+
+        sf::VertexBuffer mesh(sf::PrimitiveType::Triangles);
+        REQUIRE(mesh.create(quad.size()));
+        REQUIRE(mesh.update(quad.data()));
+
+        // One red instance in the top-left corner, one green instance in the bottom-right corner
+        std::vector<sf::Vertex> instances;
+        for (const auto& [offset, color] : {std::pair(sf::Vector2f(0, 0), sf::Color::Red),
+                                            std::pair(sf::Vector2f(50, 50), sf::Color::Green)})
+        {
+            const auto instance = sf::RenderTarget::encodeInstance(sf::Transform().translate(offset), color);
+            instances.insert(instances.end(), instance.begin(), instance.end());
+        }
+
+        sf::VertexBuffer instanceData;
+        REQUIRE(instanceData.create(instances.size()));
+        REQUIRE(instanceData.update(instances.data()));
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.drawInstanced(mesh, instanceData, 10);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Red);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+    }
 }
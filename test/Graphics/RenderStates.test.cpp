@@ -26,6 +26,7 @@ TEST_CASE("[Graphics] sf::RenderStates")
             CHECK(renderStates.coordinateType == sf::CoordinateType::Pixels);
             CHECK(renderStates.texture == nullptr);
             CHECK(renderStates.shader == nullptr);
+            CHECK(renderStates.image == nullptr);
         }
 
         SECTION("BlendMode constructor")
@@ -120,5 +121,6 @@ TEST_CASE("[Graphics] sf::RenderStates")
         CHECK(sf::RenderStates::Default.coordinateType == sf::CoordinateType::Pixels);
         CHECK(sf::RenderStates::Default.texture == nullptr);
         CHECK(sf::RenderStates::Default.shader == nullptr);
+        CHECK(sf::RenderStates::Default.image == nullptr);
     }
 }
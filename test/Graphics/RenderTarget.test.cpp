@@ -53,6 +53,15 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getView().getSize() == sf::Vector2f(3, 4));
     }
 
+    SECTION("Culling")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isCullingEnabled());
+        CHECK(renderTarget.getCulledDrawCount() == 0);
+        renderTarget.setCullingEnabled(true);
+        CHECK(renderTarget.isCullingEnabled());
+    }
+
     SECTION("setActive()")
     {
         RenderTarget renderTarget;
@@ -143,4 +152,17 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.mapCoordsToPixel({0, 480}) == sf::Vector2i(-1, 57));
         CHECK(renderTarget.mapCoordsToPixel({640, 480}) == sf::Vector2i(203, 57));
     }
+
+    SECTION("encodeInstance()")
+    {
+        const auto instance = sf::RenderTarget::encodeInstance(sf::Transform(1, 2, 3, 4, 5, 6, 0, 0, 1),
+                                                               sf::Color::Red,
+                                                               sf::FloatRect({7, 8}, {9, 10}));
+        CHECK(instance[0].position == sf::Vector2f(1, 4));
+        CHECK(instance[0].color == sf::Color::Red);
+        CHECK(instance[0].texCoords == sf::Vector2f(2, 5));
+        CHECK(instance[1].position == sf::Vector2f(3, 6));
+        CHECK(instance[1].texCoords == sf::Vector2f(7, 8));
+        CHECK(instance[2].position == sf::Vector2f(9, 10));
+    }
 }
@@ -0,0 +1,104 @@
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::RenderTexturePool", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::RenderTexturePool>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::RenderTexturePool pool;
+        CHECK(pool.getActiveCount() == 0);
+        CHECK(pool.getIdleCount() == 0);
+        CHECK(pool.getMemoryUsage() == 0);
+    }
+
+    SECTION("acquire()")
+    {
+        sf::RenderTexturePool pool;
+        CHECK(pool.acquire({1'000'000, 1'000'000}) == nullptr);
+        CHECK(pool.getActiveCount() == 0);
+
+        sf::RenderTexture* renderTexture = pool.acquire({64, 32});
+        REQUIRE(renderTexture != nullptr);
+        CHECK(renderTexture->getSize() == sf::Vector2u(64, 32));
+        CHECK(pool.getActiveCount() == 1);
+        CHECK(pool.getIdleCount() == 0);
+        CHECK(pool.getMemoryUsage() == 64 * 32 * 4);
+
+        // Acquired render-textures are never handed out twice
+        sf::RenderTexture* other = pool.acquire({64, 32});
+        REQUIRE(other != nullptr);
+        CHECK(other != renderTexture);
+        CHECK(pool.getActiveCount() == 2);
+    }
+
+    SECTION("release()")
+    {
+        sf::RenderTexturePool pool;
+        sf::RenderTexture*    renderTexture = pool.acquire({64, 64});
+        REQUIRE(renderTexture != nullptr);
+        renderTexture->setView(sf::View(sf::FloatRect({10, 10}, {20, 20})));
+        renderTexture->setSmooth(true);
+        renderTexture->display();
+        pool.release(*renderTexture);
+        CHECK(pool.getActiveCount() == 0);
+        CHECK(pool.getIdleCount() == 1);
+
+        // Releasing a foreign render-texture does nothing
+        const sf::RenderTexture foreign({16, 16});
+        pool.release(foreign);
+        CHECK(pool.getIdleCount() == 1);
+
+        // Same size and settings: the idle render-texture is reused and reset
+        CHECK(pool.acquire({64, 64}) == renderTexture);
+        CHECK(renderTexture->getView().getCenter() == renderTexture->getDefaultView().getCenter());
+        CHECK(!renderTexture->isSmooth());
+        CHECK(pool.getIdleCount() == 0);
+        pool.release(*renderTexture);
+
+        // Different settings: a new render-texture is created
+        CHECK(pool.acquire({64, 64}, sf::ContextSettings{0 /* depthBits */, 8 /* stencilBits */}) != renderTexture);
+        CHECK(pool.getActiveCount() == 1);
+        CHECK(pool.getIdleCount() == 1);
+        CHECK(pool.getMemoryUsage() == 64 * 64 * 4 + 64 * 64 * 5);
+    }
+
+    SECTION("releaseAll()")
+    {
+        sf::RenderTexturePool pool;
+        CHECK(pool.acquire({8, 8}) != nullptr);
+        CHECK(pool.acquire({16, 16}) != nullptr);
+        pool.releaseAll();
+        CHECK(pool.getActiveCount() == 0);
+        CHECK(pool.getIdleCount() == 2);
+    }
+
+    SECTION("trim()")
+    {
+        sf::RenderTexturePool pool;
+        sf::RenderTexture*    first = pool.acquire({8, 8});
+        REQUIRE(first != nullptr);
+        CHECK(pool.acquire({16, 16}) != nullptr);
+        pool.release(*first);
+
+        CHECK(pool.trim(sf::seconds(60)) == 0);
+        CHECK(pool.getIdleCount() == 1);
+
+        // Acquired render-textures are kept
+        CHECK(pool.trim() == 1);
+        CHECK(pool.getIdleCount() == 0);
+        CHECK(pool.getActiveCount() == 1);
+        CHECK(pool.getMemoryUsage() == 16 * 16 * 4);
+    }
+}
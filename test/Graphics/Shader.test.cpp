@@ -1,11 +1,20 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <SFML/System/Clock.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
 #include <type_traits>
 
 namespace
@@ -144,6 +153,7 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
     {
         CHECK_FALSE(sf::Shader::isAvailable());
         CHECK_FALSE(sf::Shader::isGeometryAvailable());
+        CHECK_FALSE(sf::Shader::isBinaryCacheAvailable());
     }
 
     SECTION("Construct from memory")
@@ -167,6 +177,13 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
         CHECK_FALSE(shader.loadFromMemory(vertexSource, fragmentSource));
         CHECK_FALSE(shader.loadFromMemory(vertexSource, geometrySource, fragmentSource));
     }
+
+    SECTION("loadFromMemoryAsync()")
+    {
+        sf::Shader shader;
+        CHECK_FALSE(shader.loadFromMemoryAsync(vertexSource, fragmentSource));
+        CHECK(shader.isReady());
+    }
 }
 
 TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
@@ -473,4 +490,162 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
             CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("Asynchronous loading")
+    {
+        const auto waitUntilReady = [](sf::Shader& shader)
+        {
+            const sf::Clock clock;
+            while (!shader.isReady() && clock.getElapsedTime() < sf::seconds(10))
+                sf::sleep(sf::milliseconds(1));
+            return shader.isReady();
+        };
+
+        sf::Shader shader;
+        CHECK(shader.isReady());
+
+        SECTION("Memory")
+        {
+            REQUIRE(shader.loadFromMemoryAsync(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+            CHECK(waitUntilReady(shader));
+            CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isAvailable());
+        }
+
+        SECTION("File")
+        {
+            CHECK(!shader.loadFromFileAsync(std::filesystem::path("does-not-exist.vert"), sf::Shader::Type::Vertex));
+            REQUIRE(shader.loadFromFileAsync("Graphics/shader.vert", "Graphics/shader.frag") ==
+                    sf::Shader::isAvailable());
+            CHECK(waitUntilReady(shader));
+            CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isAvailable());
+        }
+
+        SECTION("Invalid source")
+        {
+            // Compilation errors are only known once the shader is ready
+            REQUIRE(shader.loadFromMemoryAsync("invalid", sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+            CHECK(waitUntilReady(shader));
+            CHECK(shader.getNativeHandle() == 0);
+        }
+
+        SECTION("Superseded")
+        {
+            // A new load discards the pending one
+            REQUIRE(shader.loadFromMemoryAsync("invalid", sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+            REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+            CHECK(shader.isReady());
+            CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isAvailable());
+        }
+    }
+
+    SECTION("bindUniformBlock()")
+    {
+        sf::Shader        shader;
+        sf::UniformBuffer uniformBuffer;
+        CHECK(!shader.bindUniformBlock("Camera", uniformBuffer));
+
+        // The shader declares no uniform block
+        REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+        CHECK(!shader.bindUniformBlock("Camera", uniformBuffer));
+    }
+
+    SECTION("getUniform()")
+    {
+        sf::Shader shader;
+        CHECK(!sf::Shader::UniformHandle().isValid());
+        CHECK(!shader.getUniform("blink_alpha").isValid());
+
+        REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+        CHECK(shader.getUniform("blink_alpha").isValid() == sf::Shader::isAvailable());
+        CHECK(!shader.getUniform("does_not_exist").isValid());
+
+        // Setting through an invalid handle does nothing
+        shader.setUniform(sf::Shader::UniformHandle(), 1.f);
+        shader.setUniformArray(sf::Shader::UniformHandle(), static_cast<const float*>(nullptr), 0);
+    }
+
+    SECTION("Deferred uniform uploads")
+    {
+        sf::Shader shader;
+        CHECK(!shader.isUniformUploadDeferred());
+        shader.setUniformUploadDeferred(true);
+        CHECK(shader.isUniformUploadDeferred());
+
+        REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment) == sf::Shader::isAvailable());
+        if (sf::Shader::isAvailable())
+        {
+            sf::RenderTexture        renderTexture({1, 1});
+            const sf::RectangleShape rectangle({1, 1});
+            sf::RenderStates         states(sf::BlendNone);
+            states.shader = &shader;
+
+            const auto drawAlpha = [&]
+            {
+                renderTexture.clear(sf::Color::Black);
+                renderTexture.draw(rectangle, states);
+                renderTexture.display();
+                return renderTexture.getTexture().copyToImage().getPixel({0, 0}).a;
+            };
+
+            // Only the last staged value is uploaded when the shader is bound
+            const sf::Shader::UniformHandle blinkAlpha = shader.getUniform("blink_alpha");
+            shader.setUniform(blinkAlpha, 0.f);
+            shader.setUniform(blinkAlpha, 1.f);
+            CHECK(drawAlpha() == 255);
+
+            // Empty arrays are ignored
+            shader.setUniform(blinkAlpha, 0.f);
+            shader.setUniformArray(blinkAlpha, static_cast<const float*>(nullptr), 0);
+            CHECK(drawAlpha() == 0);
+
+            // Disabling deferred uploads flushes the pending values
+            shader.setUniform(blinkAlpha, 0.f);
+            shader.setUniformUploadDeferred(false);
+            CHECK(drawAlpha() == 0);
+
+            // Values set by name go through the same path
+            shader.setUniform("blink_alpha", 1.f);
+            CHECK(drawAlpha() == 255);
+        }
+    }
+
+    SECTION("Binary cache")
+    {
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-shader-cache-test";
+        std::filesystem::remove_all(directory);
+
+        sf::Shader::setBinaryCacheDirectory(directory);
+        CHECK(sf::Shader::getBinaryCacheDirectory() == directory);
+        sf::Shader::resetBinaryCacheStatistics();
+
+        sf::Shader first;
+        REQUIRE(first.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        sf::Shader second;
+        REQUIRE(second.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+
+        // The first load compiles and stores the program, the second one reuses it
+        const sf::Shader::BinaryCacheStatistics statistics = sf::Shader::getBinaryCacheStatistics();
+        if (sf::Shader::isBinaryCacheAvailable())
+        {
+            CHECK(statistics.misses == 1);
+            CHECK(statistics.hits == 1);
+            CHECK(statistics.rejected == 0);
+            CHECK(second.getNativeHandle() != 0);
+        }
+        else
+        {
+            CHECK(statistics.misses == 0);
+            CHECK(statistics.hits == 0);
+            CHECK(!std::filesystem::exists(directory));
+        }
+
+        sf::Shader::resetBinaryCacheStatistics();
+        CHECK(sf::Shader::getBinaryCacheStatistics().hits == 0);
+
+        sf::Shader::setBinaryCacheDirectory({});
+        CHECK(sf::Shader::getBinaryCacheDirectory().empty());
+        std::filesystem::remove_all(directory);
+    }
 }
@@ -0,0 +1,465 @@
+#include <SFML/Graphics/SoftwareRenderTexture.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/ParticleSystem.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <SFML/System/Exception.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include <cstring>
+
+TEST_CASE("[Graphics] sf::SoftwareRenderTexture")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::SoftwareRenderTexture>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::SoftwareRenderTexture>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SoftwareRenderTexture>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SoftwareRenderTexture>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::SoftwareRenderTexture renderTexture;
+            CHECK(renderTexture.getSize() == sf::Vector2u());
+            CHECK(renderTexture.getPixelsPtr() == nullptr);
+            CHECK(renderTexture.copyToImage().getSize() == sf::Vector2u());
+            CHECK(renderTexture.getThreadCount() == 1);
+        }
+
+        SECTION("2 parameter constructor")
+        {
+            CHECK_THROWS_AS(sf::SoftwareRenderTexture({0, 10}), sf::Exception);
+
+            const sf::SoftwareRenderTexture renderTexture({4, 3});
+            CHECK(renderTexture.getSize() == sf::Vector2u(4, 3));
+            CHECK(renderTexture.getView().getSize() == sf::Vector2f(4, 3));
+            REQUIRE(renderTexture.getPixelsPtr() != nullptr);
+
+            const std::array<std::uint8_t, 4 * 3 * 4> zeros{};
+            CHECK(std::memcmp(renderTexture.getPixelsPtr(), zeros.data(), zeros.size()) == 0);
+        }
+    }
+
+    SECTION("resize()")
+    {
+        sf::SoftwareRenderTexture renderTexture;
+        CHECK(!renderTexture.resize({0, 0}));
+        CHECK(renderTexture.resize({8, 6}));
+        CHECK(renderTexture.getSize() == sf::Vector2u(8, 6));
+        CHECK(renderTexture.getDefaultView().getSize() == sf::Vector2f(8, 6));
+        CHECK(renderTexture.copyToImage().getSize() == sf::Vector2u(8, 6));
+    }
+
+    SECTION("Set/get thread count")
+    {
+        sf::SoftwareRenderTexture renderTexture;
+        renderTexture.setThreadCount(4);
+        CHECK(renderTexture.getThreadCount() == 4);
+        CHECK(renderTexture.resize({8, 8}));
+        CHECK(renderTexture.getThreadCount() == 4);
+        renderTexture.setThreadCount(0);
+        CHECK(renderTexture.getThreadCount() == 1);
+    }
+
+    SECTION("clear()")
+    {
+        sf::SoftwareRenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Red);
+        CHECK(renderTexture.copyToImage().getPixel({0, 0}) == sf::Color::Red);
+        CHECK(renderTexture.copyToImage().getPixel({7, 7}) == sf::Color::Red);
+
+        // Clearing is restricted by the scissor rectangle
+        sf::View view = renderTexture.getDefaultView();
+        view.setScissor(sf::FloatRect({0.5f, 0.5f}, {0.5f, 0.5f}));
+        renderTexture.setView(view);
+        renderTexture.clear(sf::Color::Blue);
+
+        const sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({3, 3}) == sf::Color::Red);
+        CHECK(image.getPixel({4, 4}) == sf::Color::Blue);
+        CHECK(image.getPixel({7, 7}) == sf::Color::Blue);
+    }
+
+    SECTION("Draw triangles")
+    {
+        sf::SoftwareRenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Black);
+
+        sf::RectangleShape rectangle({4, 3});
+        rectangle.setPosition({2, 1});
+        rectangle.setFillColor(sf::Color::Green);
+        renderTexture.draw(rectangle);
+
+        const sf::Image image = renderTexture.copyToImage();
+        for (unsigned int y = 0; y < 8; ++y)
+        {
+            for (unsigned int x = 0; x < 8; ++x)
+            {
+                const bool inside = (x >= 2) && (x < 6) && (y >= 1) && (y < 4);
+                CHECK(image.getPixel({x, y}) == (inside ? sf::Color::Green : sf::Color::Black));
+            }
+        }
+    }
+
+    SECTION("Shared edges are drawn once")
+    {
+        sf::SoftwareRenderTexture renderTexture({16, 16});
+        renderTexture.clear(sf::Color::Black);
+
+        // Two triangles sharing a diagonal, blended: pixels on the diagonal would be brighter if drawn twice
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color(255, 255, 255, 128)},
+                                     sf::Vertex{{16, 0}, sf::Color(255, 255, 255, 128)},
+                                     sf::Vertex{{0, 16}, sf::Color(255, 255, 255, 128)},
+                                     sf::Vertex{{16, 16}, sf::Color(255, 255, 255, 128)}};
+        renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip);
+
+        const sf::Image image    = renderTexture.copyToImage();
+        const sf::Color expected = image.getPixel({0, 0});
+        CHECK(expected == sf::Color(128, 128, 128, 255));
+
+        for (unsigned int y = 0; y < 16; ++y)
+        {
+            for (unsigned int x = 0; x < 16; ++x)
+                CHECK(image.getPixel({x, y}) == expected);
+        }
+    }
+
+    SECTION("Draw lines and points")
+    {
+        sf::SoftwareRenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Black);
+
+        // The last pixel of a line is left out
+        const std::array line = {sf::Vertex{{0, 0.5f}, sf::Color::Red}, sf::Vertex{{4, 0.5f}, sf::Color::Red}};
+        renderTexture.draw(line.data(), line.size(), sf::PrimitiveType::Lines);
+
+        const std::array points = {sf::Vertex{{3.5f, 5.5f}, sf::Color::Blue}, sf::Vertex{{100, 100}, sf::Color::Blue}};
+        renderTexture.draw(points.data(), points.size(), sf::PrimitiveType::Points);
+
+        const sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(image.getPixel({3, 0}) == sf::Color::Red);
+        CHECK(image.getPixel({4, 0}) == sf::Color::Black);
+        CHECK(image.getPixel({0, 1}) == sf::Color::Black);
+        CHECK(image.getPixel({3, 5}) == sf::Color::Blue);
+        CHECK(image.getPixel({4, 5}) == sf::Color::Black);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        sf::SoftwareRenderTexture renderTexture({4, 4});
+        renderTexture.clear(sf::Color::Black);
+
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::Yellow},
+                                     sf::Vertex{{4, 0}, sf::Color::Yellow},
+                                     sf::Vertex{{0, 4}, sf::Color::Yellow},
+                                     sf::Vertex{{4, 4}, sf::Color::Yellow}};
+        const std::array<std::uint16_t, 6> indices = {0, 1, 2, 1, 3, 2};
+        renderTexture.draw(vertices.data(), vertices.size(), indices.data(), indices.size(), sf::PrimitiveType::Triangles);
+
+        const sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Yellow);
+        CHECK(image.getPixel({3, 3}) == sf::Color::Yellow);
+    }
+
+    SECTION("Vertex layouts")
+    {
+        sf::SoftwareRenderTexture renderTexture({4, 4});
+        renderTexture.clear(sf::Color::Black);
+
+        // Left half: integer positions with colors
+        const std::array pixelVertices = {sf::PixelVertex{{0, 0}, sf::Color::Red},
+                                          sf::PixelVertex{{2, 0}, sf::Color::Red},
+                                          sf::PixelVertex{{0, 4}, sf::Color::Red},
+                                          sf::PixelVertex{{2, 4}, sf::Color::Red}};
+        renderTexture.draw(pixelVertices.data(),
+                           pixelVertices.size(),
+                           sf::VertexLayout::Pixel,
+                           sf::PrimitiveType::TriangleStrip);
+
+        // Right half: positions only, sharing the layout's color
+        const std::array<sf::Vector2f, 4> positions = {{{2, 0}, {4, 0}, {2, 4}, {4, 4}}};
+        sf::VertexLayout                  layout    = sf::VertexLayout::Position;
+        layout.color                                = sf::Color::Green;
+        renderTexture.draw(positions.data(), positions.size(), layout, sf::PrimitiveType::TriangleStrip);
+
+        const sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(image.getPixel({1, 3}) == sf::Color::Red);
+        CHECK(image.getPixel({2, 0}) == sf::Color::Green);
+        CHECK(image.getPixel({3, 3}) == sf::Color::Green);
+    }
+
+    SECTION("Blend modes")
+    {
+        sf::SoftwareRenderTexture renderTexture({4, 4});
+        sf::RectangleShape        rectangle({4, 4});
+
+        renderTexture.clear(sf::Color::Blue);
+        rectangle.setFillColor(sf::Color(255, 0, 0, 128));
+        renderTexture.draw(rectangle, sf::BlendAlpha);
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color(128, 0, 127, 255));
+
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.draw(rectangle, sf::BlendAdd);
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color(128, 0, 255, 255));
+
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.draw(rectangle, sf::BlendNone);
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color(255, 0, 0, 128));
+
+        renderTexture.clear(sf::Color(100, 100, 100));
+        rectangle.setFillColor(sf::Color(50, 150, 50));
+        renderTexture.draw(rectangle, sf::BlendMin);
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color(50, 100, 50, 255));
+    }
+
+    SECTION("Stencil modes")
+    {
+        sf::SoftwareRenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Red, 0);
+
+        // Write the mask without touching the colors
+        sf::RectangleShape mask({4, 8});
+        renderTexture.draw(mask,
+                           sf::StencilMode{sf::StencilComparison::Always, sf::StencilUpdateOperation::Replace, 1, 0xFF, true});
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color::Red);
+
+        // Only draw where the mask was written
+        sf::RectangleShape fill({8, 8});
+        fill.setFillColor(sf::Color::Green);
+        renderTexture.draw(fill,
+                           sf::StencilMode{sf::StencilComparison::Equal, sf::StencilUpdateOperation::Keep, 1, 0xFF, false});
+
+        const sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({1, 1}) == sf::Color::Green);
+        CHECK(image.getPixel({3, 7}) == sf::Color::Green);
+        CHECK(image.getPixel({4, 1}) == sf::Color::Red);
+
+        // Clearing the stencil buffer only
+        renderTexture.clearStencil(127);
+        renderTexture.draw(fill,
+                           sf::StencilMode{sf::StencilComparison::Greater, sf::StencilUpdateOperation::Keep, 126, 0xFF, false});
+        CHECK(renderTexture.copyToImage().getPixel({6, 6}) == sf::Color::Red);
+        renderTexture.draw(fill,
+                           sf::StencilMode{sf::StencilComparison::Less, sf::StencilUpdateOperation::Keep, 126, 0xFF, false});
+        CHECK(renderTexture.copyToImage().getPixel({6, 6}) == sf::Color::Green);
+    }
+
+    SECTION("Views")
+    {
+        sf::SoftwareRenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Black);
+
+        // Zoomed view drawn in the bottom-right quarter of the target
+        sf::View view(sf::FloatRect({0, 0}, {2, 2}));
+        view.setViewport(sf::FloatRect({0.5f, 0.5f}, {0.5f, 0.5f}));
+        renderTexture.setView(view);
+
+        sf::RectangleShape rectangle({1, 1});
+        rectangle.setFillColor(sf::Color::White);
+        renderTexture.draw(rectangle);
+
+        // Primitives are clipped to the viewport
+        sf::RectangleShape large({100, 100});
+        large.setPosition({1, -50});
+        large.setFillColor(sf::Color::Magenta);
+        renderTexture.draw(large);
+
+        const sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({3, 3}) == sf::Color::Black);
+        CHECK(image.getPixel({4, 4}) == sf::Color::White);
+        CHECK(image.getPixel({5, 5}) == sf::Color::White);
+        CHECK(image.getPixel({6, 5}) == sf::Color::Magenta);
+        CHECK(image.getPixel({7, 0}) == sf::Color::Black);
+        CHECK(image.getPixel({4, 6}) == sf::Color::Black);
+    }
+
+    SECTION("Draw with an image as texture")
+    {
+        // Left half red, right half blue
+        sf::Image image({4, 2}, sf::Color::Red);
+        image.setPixel({2, 0}, sf::Color::Blue);
+        image.setPixel({3, 0}, sf::Color::Blue);
+        image.setPixel({2, 1}, sf::Color::Blue);
+        image.setPixel({3, 1}, sf::Color::Blue);
+
+        sf::SoftwareRenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Black);
+
+        sf::RectangleShape rectangle({8, 4});
+        rectangle.setTextureRect(sf::IntRect({0, 0}, {4, 2}));
+
+        sf::RenderStates states;
+        states.image = &image;
+        renderTexture.draw(rectangle, states);
+
+        const sf::Image result = renderTexture.copyToImage();
+        CHECK(result.getPixel({1, 1}) == sf::Color::Red);
+        CHECK(result.getPixel({6, 2}) == sf::Color::Blue);
+        CHECK(result.getPixel({1, 6}) == sf::Color::Black);
+
+        // Normalized coordinates are relative to the size of the image
+        const std::array vertices = {sf::Vertex{{0, 0}, sf::Color::White, {0.5f, 0}},
+                                     sf::Vertex{{8, 0}, sf::Color::White, {1, 0}},
+                                     sf::Vertex{{0, 8}, sf::Color::White, {0.5f, 1}},
+                                     sf::Vertex{{8, 8}, sf::Color::White, {1, 1}}};
+        states.coordinateType = sf::CoordinateType::Normalized;
+        renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip, states);
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color::Blue);
+    }
+
+    SECTION("Draw a tile map")
+    {
+        // Tileset made of a red tile and a blue tile
+        sf::Image tileset({8, 4}, sf::Color::Red);
+        for (unsigned int y = 0; y < 4; ++y)
+        {
+            for (unsigned int x = 4; x < 8; ++x)
+                tileset.setPixel({x, y}, sf::Color::Blue);
+        }
+
+        sf::TileMap tileMap(tileset, {4, 4}, {8, 8}, 4);
+        CHECK(tileMap.getTilesetImage() == &tileset);
+        tileMap.fill(0);
+        tileMap.setTile({1, 0}, 1);
+        tileMap.setTile({0, 1}, sf::TileMap::EmptyTile);
+        tileMap.setTile({7, 7}, 1);
+
+        sf::SoftwareRenderTexture renderTexture({32, 32});
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(tileMap);
+        CHECK(tileMap.getDirtyChunkCount() == 0);
+
+        sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({2, 2}) == sf::Color::Red);
+        CHECK(image.getPixel({6, 2}) == sf::Color::Blue);
+        CHECK(image.getPixel({2, 6}) == sf::Color::Green);
+        CHECK(image.getPixel({20, 20}) == sf::Color::Red);
+        CHECK(image.getPixel({30, 30}) == sf::Color::Blue);
+
+        // Changed chunks are rebuilt
+        tileMap.setTile({7, 7}, 0);
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(tileMap);
+        CHECK(renderTexture.copyToImage().getPixel({30, 30}) == sf::Color::Red);
+    }
+
+    SECTION("Draw a particle system")
+    {
+        sf::ParticleSystem particles(10);
+        particles.setParticleSize({4, 4});
+        CHECK(particles.emit({4, 4}, {}, sf::Color::Red, sf::seconds(1)));
+        CHECK(particles.emit({12, 12}, {2, 0}, sf::Color::Blue, sf::seconds(1)));
+
+        sf::SoftwareRenderTexture renderTexture({16, 16});
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+
+        sf::Image image = renderTexture.copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Red);
+        CHECK(image.getPixel({12, 12}) == sf::Color::Blue);
+        CHECK(image.getPixel({8, 8}) == sf::Color::Green);
+
+        particles.update(sf::seconds(1.5f));
+        CHECK(particles.emit({4, 12}, {}, sf::Color::Yellow, sf::seconds(1)));
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(particles);
+
+        image = renderTexture.copyToImage();
+        CHECK(image.getPixel({4, 4}) == sf::Color::Green);
+        CHECK(image.getPixel({4, 12}) == sf::Color::Yellow);
+    }
+
+    SECTION("Multithreaded rasterization")
+    {
+        // Many overlapping blended shapes: the result must not depend on the number of threads
+        const auto render = [](unsigned int threadCount)
+        {
+            sf::SoftwareRenderTexture renderTexture({512, 512});
+            renderTexture.setThreadCount(threadCount);
+            renderTexture.clear(sf::Color::Black);
+
+            sf::CircleShape circle(200.f, 60);
+            for (int i = 0; i < 16; ++i)
+            {
+                circle.setPosition({static_cast<float>(i * 7), static_cast<float>(i * 5)});
+                circle.setFillColor(sf::Color(static_cast<std::uint8_t>(i * 16), 255, 128, 64));
+                renderTexture.draw(circle);
+            }
+
+            return renderTexture.copyToImage();
+        };
+
+        const sf::Image singleThreaded = render(1);
+        const sf::Image multiThreaded  = render(4);
+        CHECK(std::memcmp(singleThreaded.getPixelsPtr(), multiThreaded.getPixelsPtr(), 512 * 512 * 4) == 0);
+        CHECK(singleThreaded.getPixel({250, 250}) != sf::Color::Black);
+    }
+}
+
+TEST_CASE("[Graphics] sf::SoftwareRenderTexture (textured)", runDisplayTests())
+{
+    // 2x2 texture with a different color in each texel
+    sf::Image image({2, 2});
+    image.setPixel({0, 0}, sf::Color::Red);
+    image.setPixel({1, 0}, sf::Color::Green);
+    image.setPixel({0, 1}, sf::Color::Blue);
+    image.setPixel({1, 1}, sf::Color::White);
+    sf::Texture texture(image);
+
+    sf::SoftwareRenderTexture renderTexture({8, 8});
+    renderTexture.clear(sf::Color::Black);
+
+    SECTION("Nearest filtering")
+    {
+        sf::Sprite sprite(texture);
+        sprite.setScale({4, 4});
+        renderTexture.draw(sprite);
+
+        const sf::Image result = renderTexture.copyToImage();
+        CHECK(result.getPixel({1, 1}) == sf::Color::Red);
+        CHECK(result.getPixel({6, 1}) == sf::Color::Green);
+        CHECK(result.getPixel({1, 6}) == sf::Color::Blue);
+        CHECK(result.getPixel({6, 6}) == sf::Color::White);
+    }
+
+    SECTION("Vertex color modulation")
+    {
+        sf::Sprite sprite(texture);
+        sprite.setScale({4, 4});
+        sprite.setColor(sf::Color(255, 255, 255, 0));
+        renderTexture.draw(sprite);
+        CHECK(renderTexture.copyToImage().getPixel({6, 6}) == sf::Color::Black);
+    }
+
+    SECTION("Texture updates are picked up")
+    {
+        sf::Sprite sprite(texture);
+        sprite.setScale({4, 4});
+        renderTexture.draw(sprite);
+
+        texture.update(sf::Image({2, 2}, sf::Color::Cyan));
+        renderTexture.draw(sprite);
+        CHECK(renderTexture.copyToImage().getPixel({1, 1}) == sf::Color::Cyan);
+    }
+}
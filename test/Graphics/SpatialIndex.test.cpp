@@ -0,0 +1,234 @@
+#include <SFML/Graphics/SpatialIndex.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+template <typename T>
+std::vector<T> sorted(std::vector<T> values)
+{
+    std::sort(values.begin(), values.end());
+    return values;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::SpatialIndex")
+{
+    using Index = sf::SpatialIndex<std::string>;
+    using Ids   = std::vector<Index::Id>;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<Index>);
+        STATIC_CHECK(std::is_copy_assignable_v<Index>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<Index>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<Index>);
+    }
+
+    SECTION("Construction")
+    {
+        const Index index;
+        CHECK(index.getSize() == 0);
+        CHECK(index.getCellSize() == 64.f);
+        CHECK(!index.contains(0));
+        CHECK(index.query(sf::FloatRect({-1000, -1000}, {2000, 2000})).empty());
+        CHECK(index.queryNearest({0, 0}, 10).empty());
+
+        const Index customIndex(16.f);
+        CHECK(customIndex.getCellSize() == 16.f);
+    }
+
+    SECTION("insert()")
+    {
+        Index        index(10.f);
+        const auto   first      = index.insert("first", sf::FloatRect({0, 0}, {5, 5}));
+        const auto   second     = index.insert("second", sf::FloatRect({20, 20}, {-10, -10}));
+        const Index& constIndex = index;
+        CHECK(first != second);
+        CHECK(index.getSize() == 2);
+        CHECK(index.contains(first));
+        CHECK(index.contains(second));
+        CHECK(index[first] == "first");
+        CHECK(constIndex[second] == "second");
+
+        // Negative sizes are normalized
+        CHECK(index.getBounds(second) == sf::FloatRect({10, 10}, {10, 10}));
+
+        index[first] = "renamed";
+        CHECK(constIndex[first] == "renamed");
+    }
+
+    SECTION("update()")
+    {
+        Index      index(10.f);
+        const auto id = index.insert("item", sf::FloatRect({0, 0}, {5, 5}));
+
+        // Within the same cell
+        CHECK(index.update(id, sf::FloatRect({2, 2}, {5, 5})));
+        CHECK(index.getBounds(id) == sf::FloatRect({2, 2}, {5, 5}));
+        CHECK(index.query(sf::Vector2f(6, 6)) == Ids{id});
+
+        // To other cells
+        CHECK(index.update(id, sf::FloatRect({100, 100}, {25, 5})));
+        CHECK(index.query(sf::Vector2f(6, 6)).empty());
+        CHECK(index.query(sf::Vector2f(120, 102)) == Ids{id});
+        CHECK(index.getSize() == 1);
+
+        CHECK(!index.update(id + 1, sf::FloatRect({0, 0}, {1, 1})));
+    }
+
+    SECTION("remove()")
+    {
+        Index      index(10.f);
+        const auto first  = index.insert("first", sf::FloatRect({0, 0}, {30, 30}));
+        const auto second = index.insert("second", sf::FloatRect({5, 5}, {1, 1}));
+        CHECK(index.remove(first));
+        CHECK(!index.remove(first));
+        CHECK(!index.contains(first));
+        CHECK(index.contains(second));
+        CHECK(index.getSize() == 1);
+        CHECK(index.query(sf::FloatRect({0, 0}, {30, 30})) == Ids{second});
+
+        // Identifiers of removed items are reused
+        CHECK(index.insert("third", sf::FloatRect({0, 0}, {1, 1})) == first);
+        CHECK(index.getSize() == 2);
+    }
+
+    SECTION("clear()")
+    {
+        Index      index(10.f);
+        const auto id = index.insert("item", sf::FloatRect({0, 0}, {1, 1}));
+        index.clear();
+        CHECK(index.getSize() == 0);
+        CHECK(!index.contains(id));
+        CHECK(index.query(sf::Vector2f(0, 0)).empty());
+        CHECK(index.queryNearest({0, 0}, 1).empty());
+    }
+
+    SECTION("query()")
+    {
+        Index      index(10.f);
+        const auto small  = index.insert("small", sf::FloatRect({1, 1}, {2, 2}));
+        const auto large  = index.insert("large", sf::FloatRect({-50, -50}, {100, 100}));
+        const auto point  = index.insert("point", sf::FloatRect({25, 25}, {0, 0}));
+        const auto remote = index.insert("remote", sf::FloatRect({-10'000, 5'000}, {10, 10}));
+
+        SECTION("Rectangle")
+        {
+            // Items spanning several cells are reported once
+            CHECK(sorted(index.query(sf::FloatRect({-100, -100}, {200, 200}))) == Ids{small, large, point});
+            CHECK(sorted(index.query(sf::FloatRect({0, 0}, {5, 5}))) == Ids{small, large});
+            CHECK(index.query(sf::FloatRect({60, 60}, {5, 5})).empty());
+
+            // Edges are inclusive
+            CHECK(sorted(index.query(sf::FloatRect({3, 3}, {22, 22}))) == Ids{small, large, point});
+
+            // Negative sizes are normalized
+            CHECK(sorted(index.query(sf::FloatRect({5, 5}, {-5, -5}))) == Ids{small, large});
+
+            // Huge areas
+            CHECK(index.query(sf::FloatRect({-1e9f, -1e9f}, {2e9f, 2e9f})).size() == 4);
+            CHECK(index.query(sf::FloatRect({-9'995, 5'005}, {1, 1})) == Ids{remote});
+        }
+
+        SECTION("Point")
+        {
+            CHECK(sorted(index.query(sf::Vector2f(2, 2))) == Ids{small, large});
+            CHECK(sorted(index.query(sf::Vector2f(25, 25))) == Ids{large, point});
+            CHECK(index.query(sf::Vector2f(49, -49)) == Ids{large});
+            CHECK(index.query(sf::Vector2f(51, 0)).empty());
+        }
+
+        SECTION("View")
+        {
+            CHECK(sorted(index.query(sf::View(sf::FloatRect({0, 0}, {10, 10})))) == Ids{small, large});
+            CHECK(sorted(index.query(sf::View({25, 25}, {2, 2}))) == Ids{large, point});
+            CHECK(index.query(sf::View(sf::FloatRect({-10'000, 5'000}, {1, 1}))) == Ids{remote});
+
+            // Rotated views see a larger bounding area
+            sf::View view({60, 60}, {10, 10});
+            CHECK(index.query(view).empty());
+            view.setRotation(sf::degrees(45));
+            view.setCenter({57, 57});
+            CHECK(index.query(view) == Ids{large});
+        }
+
+        SECTION("forEach()")
+        {
+            std::vector<std::string> values;
+            index.forEach(sf::FloatRect({0, 0}, {5, 5}),
+                          [&](Index::Id id, const std::string& value)
+                          {
+                              CHECK(index[id] == value);
+                              values.push_back(value);
+                          });
+            CHECK(sorted(values) == std::vector<std::string>{"large", "small"});
+        }
+    }
+
+    SECTION("queryNearest()")
+    {
+        Index      index(10.f);
+        const auto origin = index.insert("origin", sf::FloatRect({-1, -1}, {2, 2}));
+        const auto right  = index.insert("right", sf::FloatRect({30, 0}, {5, 5}));
+        const auto below  = index.insert("below", sf::FloatRect({0, 100}, {5, 5}));
+        const auto far    = index.insert("far", sf::FloatRect({5'000, 5'000}, {5, 5}));
+
+        CHECK(index.queryNearest({0, 0}, 0).empty());
+        CHECK(index.queryNearest({0, 0}, 1) == Ids{origin});
+        CHECK(index.queryNearest({0, 0}, 3) == Ids{origin, right, below});
+        CHECK(index.queryNearest({0, 0}, 10) == Ids{origin, right, below, far});
+        CHECK(index.queryNearest({40, 40}, 2) == Ids{right, origin});
+        CHECK(index.queryNearest({2, 90}, 1) == Ids{below});
+
+        // Points outside of the occupied area
+        CHECK(index.queryNearest({6'000, 6'000}, 2) == Ids{far, below});
+        CHECK(index.queryNearest({-1e9f, 0}, 1) == Ids{origin});
+
+        // Removed items are never reported
+        CHECK(index.remove(origin));
+        CHECK(index.queryNearest({0, 0}, 2) == Ids{right, below});
+    }
+
+    SECTION("Large items")
+    {
+        // Items covering many cells aren't registered in each of them, so this is instantaneous
+        Index      index(32.f);
+        const auto huge  = index.insert("huge", sf::FloatRect({-1e6f, -1e6f}, {2e6f, 2e6f}));
+        const auto wide  = index.insert("wide", sf::FloatRect({0, 0}, {100'000, 10}));
+        const auto small = index.insert("small", sf::FloatRect({10, 10}, {1, 1}));
+        CHECK(index.getSize() == 3);
+
+        CHECK(sorted(index.query(sf::Vector2f(5, 5))) == Ids{huge, wide});
+        CHECK(sorted(index.query(sf::Vector2f(10, 10))) == Ids{huge, wide, small});
+        CHECK(index.query(sf::Vector2f(99'000, 500)) == Ids{huge});
+        CHECK(index.query(sf::Vector2f(2e6f, 0)).empty());
+        CHECK(index.queryNearest({50'000, 1'000}, 2) == Ids{huge, wide});
+
+        // From large to small and back
+        CHECK(index.update(wide, sf::FloatRect({50, 50}, {1, 1})));
+        CHECK(sorted(index.query(sf::FloatRect({0, 0}, {60, 60}))) == Ids{huge, wide, small});
+        CHECK(index.update(small, sf::FloatRect({-50'000, 0}, {100'000, 1})));
+        CHECK(index.update(small, sf::FloatRect({-60'000, 0}, {100'000, 1})));
+        CHECK(sorted(index.query(sf::Vector2f(-55'000, 0))) == Ids{huge, small});
+
+        CHECK(index.remove(huge));
+        CHECK(index.query(sf::Vector2f(99'000, 500)).empty());
+        CHECK(index.queryNearest({0, 0}, 1) == Ids{small});
+
+        CHECK(index.remove(wide));
+        CHECK(index.queryNearest({1e6f, 1e6f}, 5) == Ids{small});
+
+        // Only large items
+        Index      largeIndex(32.f);
+        const auto first  = largeIndex.insert("first", sf::FloatRect({0, 0}, {1e6f, 1e6f}));
+        const auto second = largeIndex.insert("second", sf::FloatRect({-1e6f, 0}, {1e5f, 1e5f}));
+        CHECK(largeIndex.queryNearest({-1e6f, -1e6f}, 2) == Ids{second, first});
+        CHECK(largeIndex.query(sf::FloatRect({-1e7f, -1e7f}, {2e7f, 2e7f})).size() == 2);
+    }
+}
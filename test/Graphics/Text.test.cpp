@@ -84,6 +84,24 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getString() == "abcdefghijklmnopqrstuvwxyz");
     }
 
+    SECTION("Set/get UTF-8 string")
+    {
+        const sf::U8String utf8String = sf::String(U"caf\u00E9 \u00FCber").toUtf8();
+
+        sf::Text text(font);
+        text.setString(utf8String);
+        CHECK(text.getUtf8String() == sf::U8StringView(utf8String));
+        CHECK(text.getString() == U"caf\u00E9 \u00FCber");
+
+        text.setString("abc");
+        CHECK(text.getString() == "abc");
+        CHECK(text.getUtf8String().size() == 3);
+
+        const sf::Text utf8Text(font, utf8String, 24);
+        CHECK(utf8Text.getString() == U"caf\u00E9 \u00FCber");
+        CHECK(utf8Text.getCharacterSize() == 24);
+    }
+
     SECTION("Set/get font")
     {
         sf::Text       text(font);
@@ -153,6 +171,14 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
 
         // Indices that are too large are capped at maximum valid index
         CHECK(text.findCharacterPos(1'000) == sf::Vector2f(120, 277));
+
+        // UTF-8 strings are laid out like their UTF-32 equivalent, indices count characters
+        const sf::String string = U"\u00E9t\u00E9\nabc";
+        sf::Text         utf32Text(font, string);
+        sf::Text         utf8Text(font, string.toUtf8());
+        for (std::size_t i = 0; i <= string.getSize() + 1; ++i)
+            CHECK(utf8Text.findCharacterPos(i) == utf32Text.findCharacterPos(i));
+        CHECK(utf8Text.getLocalBounds() == utf32Text.getLocalBounds());
     }
 
     SECTION("Get bounds")
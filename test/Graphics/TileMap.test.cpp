@@ -0,0 +1,144 @@
+#include <SFML/Graphics/TileMap.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TileMap", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, const sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TileMap>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::TileMap>);
+    }
+
+    // Tileset made of a red tile and a blue tile
+    sf::Image tilesetImage({8, 4}, sf::Color::Red);
+    for (unsigned int y = 0; y < 4; ++y)
+    {
+        for (unsigned int x = 4; x < 8; ++x)
+            tilesetImage.setPixel({x, y}, sf::Color::Blue);
+    }
+    const sf::Texture tileset(tilesetImage);
+
+    SECTION("Construction")
+    {
+        const sf::TileMap tileMap(tileset, {4, 4}, {10, 6}, 4);
+        CHECK(&tileMap.getTileset() == &tileset);
+        CHECK(tileMap.getTileSize() == sf::Vector2u(4, 4));
+        CHECK(tileMap.getMapSize() == sf::Vector2u(10, 6));
+        CHECK(tileMap.getChunkSize() == 4);
+        CHECK(tileMap.getDirtyChunkCount() == 6);
+        CHECK(tileMap.getTile({0, 0}) == sf::TileMap::EmptyTile);
+        CHECK(tileMap.getTile({9, 5}) == sf::TileMap::EmptyTile);
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({0, 0}, {40, 24}));
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({0, 0}, {40, 24}));
+
+        // Chunk size is clamped
+        CHECK(sf::TileMap(tileset, {4, 4}, {1, 1}, 0).getChunkSize() == 1);
+        CHECK(sf::TileMap(tileset, {4, 4}, {1, 1}, 1000).getChunkSize() == sf::TileMap::MaxChunkSize);
+    }
+
+    SECTION("Set/get tiles")
+    {
+        sf::TileMap tileMap(tileset, {4, 4}, {8, 8}, 4);
+        tileMap.setTile({5, 1}, 1);
+        CHECK(tileMap.getTile({5, 1}) == 1);
+
+        tileMap.fill(0);
+        CHECK(tileMap.getTile({5, 1}) == 0);
+        CHECK(tileMap.getTile({7, 7}) == 0);
+
+        constexpr std::array<sf::TileMap::Tile, 6> tiles{1, 1, 1, sf::TileMap::EmptyTile, 0, 1};
+        tileMap.setTiles({2, 3}, {3, 2}, tiles.data());
+        CHECK(tileMap.getTile({2, 3}) == 1);
+        CHECK(tileMap.getTile({4, 3}) == 1);
+        CHECK(tileMap.getTile({2, 4}) == sf::TileMap::EmptyTile);
+        CHECK(tileMap.getTile({4, 4}) == 1);
+        CHECK(tileMap.getTile({5, 4}) == 0);
+    }
+
+    SECTION("Set/get tileset")
+    {
+        const sf::Texture otherTileset(sf::Vector2u(16, 16));
+        sf::TileMap       tileMap(tileset, {4, 4}, {8, 8}, 4);
+        tileMap.setTileset(otherTileset);
+        CHECK(&tileMap.getTileset() == &otherTileset);
+    }
+
+    SECTION("Set/get transform")
+    {
+        sf::TileMap tileMap(tileset, {4, 4}, {8, 8});
+        tileMap.setPosition({10, 20});
+        tileMap.setScale({2, 2});
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({0, 0}, {32, 32}));
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({10, 20}, {64, 64}));
+    }
+
+    SECTION("Draw")
+    {
+        sf::RenderTexture renderTexture({32, 32});
+        sf::TileMap       tileMap(tileset, {4, 4}, {8, 8}, 4);
+        tileMap.fill(0);
+        tileMap.setTile({1, 0}, 1);
+        tileMap.setTile({0, 1}, sf::TileMap::EmptyTile);
+        tileMap.setTile({7, 7}, 1);
+        CHECK(tileMap.getDirtyChunkCount() == 4);
+
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+        CHECK(tileMap.getDirtyChunkCount() == 0);
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({2, 2}) == sf::Color::Red);
+        CHECK(image.getPixel({6, 2}) == sf::Color::Blue);
+        CHECK(image.getPixel({2, 6}) == sf::Color::Green);
+        CHECK(image.getPixel({20, 20}) == sf::Color::Red);
+        CHECK(image.getPixel({30, 30}) == sf::Color::Blue);
+
+        // Only the chunk containing the changed tile is rebuilt
+        tileMap.setTile({7, 7}, 0);
+        CHECK(tileMap.getDirtyChunkCount() == 1);
+        tileMap.setTile({7, 7}, 0);
+        CHECK(tileMap.getDirtyChunkCount() == 1);
+
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+        CHECK(tileMap.getDirtyChunkCount() == 0);
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({30, 30}) == sf::Color::Red);
+    }
+
+    SECTION("Draw visible chunks only")
+    {
+        sf::RenderTexture renderTexture({32, 32});
+        sf::TileMap       tileMap(tileset, {4, 4}, {8, 8}, 4);
+        tileMap.fill(1);
+
+        // The view only sees the top-left chunk
+        renderTexture.setView(sf::View(sf::FloatRect({0, 0}, {8, 8})));
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+        CHECK(tileMap.getDirtyChunkCount() == 3);
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({16, 16}) == sf::Color::Blue);
+
+        // Transformations of the tile map are taken into account
+        tileMap.setPosition({-16, 0});
+        renderTexture.draw(tileMap);
+        CHECK(tileMap.getDirtyChunkCount() == 2);
+    }
+}
@@ -0,0 +1,184 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <cstdint>
+#include <cstring>
+
+TEST_CASE("[Graphics] sf::UniformBuffer::Layout")
+{
+    using Type = sf::UniformBuffer::Layout::Type;
+
+    SECTION("Construction")
+    {
+        const sf::UniformBuffer::Layout layout;
+        CHECK(layout.getSize() == 0);
+    }
+
+    SECTION("add()")
+    {
+        sf::UniformBuffer::Layout layout;
+        CHECK(layout.add(Type::Float) == 0);
+        CHECK(layout.add(Type::Vec2) == 8);
+        CHECK(layout.add(Type::Vec3) == 16);
+        CHECK(layout.add(Type::Int) == 28);
+        CHECK(layout.add(Type::Mat3) == 32);
+        CHECK(layout.add(Type::Bool) == 80);
+        CHECK(layout.add(Type::Mat4) == 96);
+        CHECK(layout.add(Type::Ivec2) == 160);
+        CHECK(layout.getSize() == 176);
+    }
+
+    SECTION("addArray()")
+    {
+        sf::UniformBuffer::Layout layout;
+        CHECK(layout.add(Type::Float) == 0);
+        CHECK(layout.addArray(Type::Float, 3) == 16);
+        CHECK(layout.add(Type::Float) == 64);
+        CHECK(layout.addArray(Type::Mat3, 2) == 80);
+        CHECK(layout.addArray(Type::Vec3, 2) == 176);
+        CHECK(layout.getSize() == 208);
+    }
+}
+
+TEST_CASE("[Graphics] sf::UniformBuffer", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.getSize() == 0);
+        CHECK(uniformBuffer.getNativeHandle() == 0);
+        CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+
+        const sf::UniformBuffer staticBuffer(sf::UniformBuffer::Usage::Static);
+        CHECK(staticBuffer.getUsage() == sf::UniformBuffer::Usage::Static);
+    }
+
+    // Skip tests if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(!uniformBuffer.create(16));
+        CHECK(!uniformBuffer.upload());
+        return;
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+        CHECK(uniformBuffer.upload());
+
+        const std::array<std::uint8_t, 64> zeros{};
+        CHECK(std::memcmp(uniformBuffer.getData(), zeros.data(), zeros.size()) == 0);
+    }
+
+    SECTION("set()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        REQUIRE(uniformBuffer.create(64));
+
+        CHECK(uniformBuffer.set(0, 1.5f));
+        CHECK(uniformBuffer.set(4, true));
+        CHECK(uniformBuffer.set(16, sf::Glsl::Mat3(std::array{1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f}.data())));
+
+        std::array<float, 16> values{};
+        std::memcpy(values.data(), uniformBuffer.getData(), sizeof(values));
+        CHECK(values[0] == 1.5f);
+        CHECK(values[4] == 1.f);
+        CHECK(values[5] == 2.f);
+        CHECK(values[6] == 3.f);
+        CHECK(values[7] == 0.f);
+        CHECK(values[8] == 4.f);
+        CHECK(values[12] == 7.f);
+        CHECK(values[15] == 0.f);
+
+        int flag = 0;
+        std::memcpy(&flag, uniformBuffer.getData() + 4, sizeof(flag));
+        CHECK(flag == 1);
+
+        CHECK(uniformBuffer.upload());
+
+        CHECK(!uniformBuffer.set(64, 1.f));
+        CHECK(!uniformBuffer.set(56, sf::Glsl::Vec4()));
+        CHECK(!uniformBuffer.set(std::numeric_limits<std::size_t>::max(), 1));
+        CHECK(!uniformBuffer.set(32, sf::Glsl::Mat4(std::array<float, 16>{}.data())));
+    }
+
+    SECTION("set() before create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(!uniformBuffer.set(0, 1.f));
+        CHECK(!uniformBuffer.set(0, sf::Glsl::Vec4()));
+    }
+
+    SECTION("setArray()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        REQUIRE(uniformBuffer.create(48));
+
+        const std::array scalars{1.f, 2.f, 3.f};
+        CHECK(uniformBuffer.setArray(0, scalars.data(), scalars.size()));
+
+        std::array<float, 12> values{};
+        std::memcpy(values.data(), uniformBuffer.getData(), sizeof(values));
+        CHECK(values[0] == 1.f);
+        CHECK(values[1] == 0.f);
+        CHECK(values[4] == 2.f);
+        CHECK(values[8] == 3.f);
+
+        // The last element would overflow the buffer: nothing is written
+        const std::array others{4.f, 5.f};
+        CHECK(!uniformBuffer.setArray(32, others.data(), others.size()));
+        std::memcpy(values.data(), uniformBuffer.getData(), sizeof(values));
+        CHECK(values[8] == 3.f);
+    }
+
+    SECTION("update()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        const float       value = 4.f;
+        CHECK(!uniformBuffer.update(&value, sizeof(value), 0));
+
+        REQUIRE(uniformBuffer.create(16));
+        CHECK(!uniformBuffer.update(nullptr, sizeof(value), 0));
+        CHECK(!uniformBuffer.update(&value, sizeof(value), 16));
+        CHECK(uniformBuffer.update(&value, sizeof(value), 12));
+
+        float stored = 0.f;
+        std::memcpy(&stored, uniformBuffer.getData() + 12, sizeof(stored));
+        CHECK(stored == 4.f);
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer source;
+        REQUIRE(source.create(32));
+        const unsigned int handle = source.getNativeHandle();
+
+        sf::UniformBuffer uniformBuffer(std::move(source));
+        CHECK(uniformBuffer.getSize() == 32);
+        CHECK(uniformBuffer.getNativeHandle() == handle);
+
+        sf::UniformBuffer other;
+        other = std::move(uniformBuffer);
+        CHECK(other.getSize() == 32);
+        CHECK(other.getNativeHandle() == handle);
+    }
+}
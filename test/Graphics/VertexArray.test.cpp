@@ -110,5 +110,16 @@ TEST_CASE("[Graphics] sf::VertexArray")
         CHECK(vertexArray.getBounds() == sf::FloatRect({2, 2}, {3, 3}));
         vertexArray.append({{10, 10}});
         CHECK(vertexArray.getBounds() == sf::FloatRect({2, 2}, {8, 8}));
+        vertexArray.resize(2);
+        CHECK(vertexArray.getBounds() == sf::FloatRect({2, 2}, {3, 3}));
+        vertexArray.clear();
+        CHECK(vertexArray.getBounds() == sf::FloatRect({0, 0}, {0, 0}));
+
+        // Bounds are exact even when vertices are written through a reference taken earlier
+        vertexArray.append({{1, 1}});
+        sf::Vertex& vertex = vertexArray[0];
+        CHECK(vertexArray.getBounds() == sf::FloatRect({1, 1}, {0, 0}));
+        vertex.position = {4, 3};
+        CHECK(vertexArray.getBounds() == sf::FloatRect({4, 3}, {0, 0}));
     }
 }
@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -134,6 +135,19 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
             CHECK(vertexBuffer.getVertexCount() == 128);
         }
 
+        SECTION("Compact vertices")
+        {
+            std::array<sf::CompactVertex, 128> compactVertices{};
+            CHECK(vertexBuffer.setLayout(sf::VertexLayout::Compact));
+            CHECK(vertexBuffer.create(128));
+
+            // sf::Vertex doesn't match the layout of the buffer
+            CHECK(!vertexBuffer.update(vertices.data(), 128, 0));
+
+            CHECK(vertexBuffer.update(compactVertices.data(), 128, 0));
+            CHECK(vertexBuffer.getVertexCount() == 128);
+        }
+
         SECTION("Another buffer")
         {
             sf::VertexBuffer otherVertexBuffer;
@@ -144,6 +158,66 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         }
     }
 
+    SECTION("map()")
+    {
+        SECTION("Uninitialized buffer")
+        {
+            sf::VertexBuffer vertexBuffer;
+            CHECK(vertexBuffer.map() == nullptr);
+            CHECK(!vertexBuffer.isMapped());
+            CHECK(!vertexBuffer.unmap());
+        }
+
+        SECTION("Stream usage")
+        {
+            sf::VertexBuffer vertexBuffer(sf::VertexBuffer::Usage::Stream);
+            CHECK(vertexBuffer.create(128));
+
+            sf::Vertex* vertices = vertexBuffer.map();
+            REQUIRE(vertices != nullptr);
+            CHECK(vertexBuffer.isMapped());
+            for (std::size_t i = 0; i < vertexBuffer.getVertexCount(); ++i)
+                vertices[i] = sf::Vertex{{static_cast<float>(i), 0}};
+
+            // Mapped buffers can be neither mapped again nor updated
+            CHECK(vertexBuffer.map() == nullptr);
+            CHECK(!vertexBuffer.update(std::array<sf::Vertex, 128>{}.data()));
+
+            CHECK(vertexBuffer.unmap());
+            CHECK(!vertexBuffer.isMapped());
+            CHECK(!vertexBuffer.unmap());
+        }
+
+        SECTION("Static usage")
+        {
+            std::array<sf::Vertex, 4> vertices{};
+            vertices[2].position = {1, 2};
+
+            sf::VertexBuffer vertexBuffer(sf::VertexBuffer::Usage::Static);
+            CHECK(vertexBuffer.create(vertices.size()));
+            CHECK(vertexBuffer.update(vertices.data()));
+
+            // The contents are preserved when mapping a non-stream buffer
+            const sf::Vertex* mapped = vertexBuffer.map();
+            REQUIRE(mapped != nullptr);
+            CHECK(mapped[2].position == sf::Vector2f(1, 2));
+            CHECK(vertexBuffer.unmap());
+        }
+
+        SECTION("create() while mapped")
+        {
+            sf::VertexBuffer vertexBuffer;
+            CHECK(vertexBuffer.create(4));
+            REQUIRE(vertexBuffer.map() != nullptr);
+
+            // Reallocating the buffer unmaps it
+            CHECK(vertexBuffer.create(8));
+            CHECK(!vertexBuffer.isMapped());
+            CHECK(vertexBuffer.map() != nullptr);
+            CHECK(vertexBuffer.unmap());
+        }
+    }
+
     SECTION("swap()")
     {
         sf::VertexBuffer vertexBuffer1(sf::PrimitiveType::LineStrip, sf::VertexBuffer::Usage::Dynamic);
@@ -178,4 +252,18 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         vertexBuffer.setUsage(sf::VertexBuffer::Usage::Dynamic);
         CHECK(vertexBuffer.getUsage() == sf::VertexBuffer::Usage::Dynamic);
     }
+
+    SECTION("Set/get layout")
+    {
+        sf::VertexBuffer vertexBuffer;
+        CHECK(vertexBuffer.getLayout() == sf::VertexLayout::Default);
+
+        sf::VertexLayout layout;
+        layout.stride = 0;
+        CHECK(!vertexBuffer.setLayout(layout));
+        CHECK(vertexBuffer.getLayout() == sf::VertexLayout::Default);
+
+        CHECK(vertexBuffer.setLayout(sf::VertexLayout::Pixel));
+        CHECK(vertexBuffer.getLayout() == sf::VertexLayout::Pixel);
+    }
 }
@@ -0,0 +1,102 @@
+#include <SFML/Graphics/VertexLayout.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::VertexLayout")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_aggregate_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_aggregate_v<sf::CompactVertex>);
+        STATIC_CHECK(std::is_aggregate_v<sf::PixelVertex>);
+    }
+
+    SECTION("Vertex sizes")
+    {
+        STATIC_CHECK(sizeof(sf::CompactVertex) == 12);
+        STATIC_CHECK(sizeof(sf::PixelVertex) == 12);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::VertexLayout layout;
+        CHECK(layout.stride == sizeof(sf::Vertex));
+        CHECK(layout.positionFormat == sf::VertexLayout::Format::Float);
+        CHECK(layout.positionOffset == offsetof(sf::Vertex, position));
+        CHECK(layout.colorOffset == offsetof(sf::Vertex, color));
+        CHECK(layout.color == sf::Color::White);
+        CHECK(layout.texCoordsFormat == sf::VertexLayout::Format::Float);
+        CHECK(layout.texCoordsOffset == offsetof(sf::Vertex, texCoords));
+        CHECK(layout.isValid());
+    }
+
+    SECTION("getAttributeSize()")
+    {
+        CHECK(sf::VertexLayout::getAttributeSize(sf::VertexLayout::Format::Float) == 8);
+        CHECK(sf::VertexLayout::getAttributeSize(sf::VertexLayout::Format::Short) == 4);
+    }
+
+    SECTION("isValid()")
+    {
+        sf::VertexLayout layout;
+        layout.stride = 0;
+        CHECK(!layout.isValid());
+
+        layout.stride = 16;
+        CHECK(!layout.isValid());
+
+        layout.texCoordsOffset.reset();
+        CHECK(layout.isValid());
+
+        layout.positionOffset = 12;
+        CHECK(!layout.isValid());
+    }
+
+    SECTION("Operators")
+    {
+        SECTION("operator==")
+        {
+            CHECK(sf::VertexLayout() == sf::VertexLayout());
+            CHECK(sf::VertexLayout::Default == sf::VertexLayout());
+            CHECK(sf::VertexLayout::Compact == sf::VertexLayout::Compact);
+        }
+
+        SECTION("operator!=")
+        {
+            CHECK(sf::VertexLayout::Compact != sf::VertexLayout::Default);
+            CHECK(sf::VertexLayout::Pixel != sf::VertexLayout::Compact);
+
+            sf::VertexLayout layout = sf::VertexLayout::Position;
+            layout.color            = sf::Color::Red;
+            CHECK(layout != sf::VertexLayout::Position);
+        }
+    }
+
+    SECTION("Static constants")
+    {
+        CHECK(sf::VertexLayout::Compact.stride == sizeof(sf::CompactVertex));
+        CHECK(sf::VertexLayout::Compact.positionOffset == offsetof(sf::CompactVertex, position));
+        CHECK(!sf::VertexLayout::Compact.colorOffset);
+        CHECK(sf::VertexLayout::Compact.texCoordsFormat == sf::VertexLayout::Format::Short);
+        CHECK(sf::VertexLayout::Compact.texCoordsOffset == offsetof(sf::CompactVertex, texCoords));
+        CHECK(sf::VertexLayout::Compact.isValid());
+
+        CHECK(sf::VertexLayout::Pixel.stride == sizeof(sf::PixelVertex));
+        CHECK(sf::VertexLayout::Pixel.positionFormat == sf::VertexLayout::Format::Short);
+        CHECK(sf::VertexLayout::Pixel.colorOffset == offsetof(sf::PixelVertex, color));
+        CHECK(sf::VertexLayout::Pixel.texCoordsOffset == offsetof(sf::PixelVertex, texCoords));
+        CHECK(sf::VertexLayout::Pixel.isValid());
+
+        CHECK(sf::VertexLayout::Position.stride == sizeof(sf::Vector2f));
+        CHECK(!sf::VertexLayout::Position.colorOffset);
+        CHECK(!sf::VertexLayout::Position.texCoordsOffset);
+        CHECK(sf::VertexLayout::Position.isValid());
+    }
+}
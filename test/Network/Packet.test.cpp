@@ -266,6 +266,39 @@ TEST_CASE("[Network] sf::Packet")
             const sf::String string = "testing";
             CHECK_PACKET_STRING_STREAM_OPERATORS(string, 4 * string.getSize() + 4);
         }
+
+        SECTION("std::string_view")
+        {
+            const std::string_view string = "testing";
+            sf::Packet             packet;
+            packet << string;
+            CHECK(packet.getDataSize() == string.size() + 4);
+
+            std::string received;
+            packet >> received;
+            CHECK(packet.endOfPacket());
+            CHECK(received == string);
+        }
+
+        SECTION("sf::U8String")
+        {
+            const sf::U8String string = sf::String(U"t\u00E9sting").toUtf8();
+            sf::Packet         packet;
+            packet << sf::U8StringView(string);
+            CHECK(packet.getDataSize() == string.size() + 4);
+
+            sf::U8String received;
+            packet >> received;
+            CHECK(packet.endOfPacket());
+            CHECK(bool{packet});
+            CHECK(received == string);
+
+            // Same format as narrow strings
+            packet.clear();
+            packet << std::string("abc");
+            packet >> received;
+            CHECK(received.size() == 3);
+        }
     }
 
     SECTION("onSend")
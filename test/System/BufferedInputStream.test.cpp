@@ -0,0 +1,185 @@
+#include <SFML/System/BufferedInputStream.hpp>
+
+// Other 1st party headers
+#include <SFML/System/MemoryInputStream.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+// Stream over a string that counts the reads issued on it
+class CountingStream : public sf::InputStream
+{
+public:
+    explicit CountingStream(std::string contents) : m_contents(std::move(contents))
+    {
+    }
+
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override
+    {
+        ++m_readCount;
+        return m_stream.read(data, size);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override
+    {
+        return m_stream.seek(position);
+    }
+
+    [[nodiscard]] std::optional<std::size_t> tell() override
+    {
+        return m_stream.tell();
+    }
+
+    std::optional<std::size_t> getSize() override
+    {
+        return m_stream.getSize();
+    }
+
+    [[nodiscard]] std::size_t getReadCount() const
+    {
+        return m_readCount;
+    }
+
+private:
+    std::string           m_contents;
+    sf::MemoryInputStream m_stream{m_contents.data(), m_contents.size()};
+    std::size_t           m_readCount{};
+};
+
+std::string makeContents(std::size_t size)
+{
+    std::string contents(size, '\0');
+    for (std::size_t i = 0; i < size; ++i)
+        contents[i] = static_cast<char>('a' + i % 26);
+    return contents;
+}
+} // namespace
+
+TEST_CASE("[System] sf::BufferedInputStream")
+{
+    using namespace std::string_view_literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::BufferedInputStream>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::BufferedInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::BufferedInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::BufferedInputStream>);
+    }
+
+    const std::string contents = makeContents(1000);
+
+    for (const auto mode : {sf::BufferedInputStream::Mode::Synchronous, sf::BufferedInputStream::Mode::ReadAhead})
+    {
+        SECTION(mode == sf::BufferedInputStream::Mode::Synchronous ? "Synchronous" : "Read-ahead")
+        {
+            SECTION("Construction")
+            {
+                CountingStream          source(contents);
+                sf::BufferedInputStream bufferedInputStream(source, 64, mode);
+                CHECK(bufferedInputStream.tell() == 0);
+                CHECK(bufferedInputStream.getSize() == 1000);
+                CHECK(bufferedInputStream.getData() == nullptr);
+
+                const sf::BufferedInputStream::Statistics statistics = bufferedInputStream.getStatistics();
+                CHECK(statistics.reads == 0);
+                CHECK(statistics.bytesRead == 0);
+                CHECK(statistics.stalls == 0);
+            }
+
+            SECTION("read()")
+            {
+                CountingStream          source(contents);
+                sf::BufferedInputStream bufferedInputStream(source, 64, mode);
+
+                // Small reads are served from the buffer
+                std::array<char, 8> buffer{};
+                std::string         result;
+                while (const std::optional count = bufferedInputStream.read(buffer.data(), buffer.size()))
+                {
+                    if (*count == 0)
+                        break;
+                    result.append(buffer.data(), *count);
+                }
+
+                CHECK(result == contents);
+                CHECK(bufferedInputStream.tell() == 1000);
+
+                const sf::BufferedInputStream::Statistics statistics = bufferedInputStream.getStatistics();
+                CHECK(statistics.reads == 126);
+                CHECK(statistics.bytesRead == 1000);
+                CHECK(statistics.sourceReads == source.getReadCount());
+                CHECK(source.getReadCount() == 16);
+                CHECK(statistics.stalls <= 16);
+
+                bufferedInputStream.resetStatistics();
+                CHECK(bufferedInputStream.getStatistics().reads == 0);
+                CHECK(bufferedInputStream.getStatistics().sourceReads == 0);
+            }
+
+            SECTION("seek()")
+            {
+                CountingStream          source(contents);
+                sf::BufferedInputStream bufferedInputStream(source, 64, mode);
+                std::array<char, 4>     buffer{};
+
+                CHECK(bufferedInputStream.seek(500) == 500);
+                CHECK(bufferedInputStream.read(buffer.data(), buffer.size()) == 4);
+                CHECK(std::string_view(buffer.data(), 4) == std::string_view(contents).substr(500, 4));
+
+                // Seeking within the buffered block doesn't read the source again
+                const std::size_t sourceReads = bufferedInputStream.getStatistics().sourceReads;
+                CHECK(bufferedInputStream.seek(510) == 510);
+                CHECK(bufferedInputStream.read(buffer.data(), buffer.size()) == 4);
+                CHECK(std::string_view(buffer.data(), 4) == std::string_view(contents).substr(510, 4));
+                if (mode == sf::BufferedInputStream::Mode::Synchronous)
+                    CHECK(bufferedInputStream.getStatistics().sourceReads == sourceReads);
+
+                CHECK(bufferedInputStream.seek(0) == 0);
+                CHECK(bufferedInputStream.read(buffer.data(), buffer.size()) == 4);
+                CHECK(std::string_view(buffer.data(), 4) == "abcd"sv);
+
+                CHECK(bufferedInputStream.seek(2000) == 1000);
+                CHECK(bufferedInputStream.read(buffer.data(), buffer.size()) == 0);
+            }
+
+            SECTION("Large reads")
+            {
+                CountingStream          source(contents);
+                sf::BufferedInputStream bufferedInputStream(source, 64, mode);
+                std::string             result(1000, '\0');
+                CHECK(bufferedInputStream.read(result.data(), 300) == 300);
+                CHECK(bufferedInputStream.read(result.data() + 300, 1000) == 700);
+                CHECK(result == contents);
+                CHECK(bufferedInputStream.getStatistics().bytesRead == 1000);
+            }
+
+            SECTION("Move semantics")
+            {
+                CountingStream          source(contents);
+                sf::BufferedInputStream movedBufferedInputStream(source, 64, mode);
+                std::array<char, 4>     buffer{};
+                CHECK(movedBufferedInputStream.read(buffer.data(), buffer.size()) == 4);
+
+                sf::BufferedInputStream bufferedInputStream = std::move(movedBufferedInputStream);
+                CHECK(bufferedInputStream.tell() == 4);
+                CHECK(bufferedInputStream.read(buffer.data(), buffer.size()) == 4);
+                CHECK(std::string_view(buffer.data(), 4) == "efgh"sv);
+            }
+        }
+    }
+
+    SECTION("getData()")
+    {
+        sf::MemoryInputStream   source(contents.data(), contents.size());
+        sf::BufferedInputStream bufferedInputStream(source);
+        CHECK(bufferedInputStream.getData() == contents.data());
+    }
+}
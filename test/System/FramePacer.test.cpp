@@ -0,0 +1,132 @@
+#include <SFML/System/FramePacer.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Sleep.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SystemUtil.hpp>
+#include <chrono>
+#include <type_traits>
+
+TEST_CASE("[System] sf::FramePacer")
+{
+    using namespace std::chrono_literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::FramePacer>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::FramePacer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::FramePacer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::FramePacer>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::FramePacer pacer;
+        CHECK(pacer.getFrameTime() == sf::Time::Zero);
+        CHECK(pacer.getMode() == sf::FramePacer::Mode::Relative);
+        CHECK(pacer.getSlack() == sf::FramePacer::DefaultSlack);
+
+        const sf::FramePacer::Statistics statistics = pacer.getStatistics();
+        CHECK(statistics.frameCount == 0);
+        CHECK(statistics.missedDeadlines == 0);
+        CHECK(statistics.average == sf::Time::Zero);
+        CHECK(statistics.percentile99 == sf::Time::Zero);
+    }
+
+    SECTION("Set/get frame time")
+    {
+        sf::FramePacer pacer;
+        pacer.setFrameTime(sf::milliseconds(5));
+        CHECK(pacer.getFrameTime() == sf::milliseconds(5));
+        pacer.setFrameTime(sf::milliseconds(-5));
+        CHECK(pacer.getFrameTime() == sf::Time::Zero);
+    }
+
+    SECTION("Set/get mode")
+    {
+        sf::FramePacer pacer;
+        pacer.setMode(sf::FramePacer::Mode::Absolute, sf::milliseconds(1));
+        CHECK(pacer.getMode() == sf::FramePacer::Mode::Absolute);
+        CHECK(pacer.getSlack() == sf::milliseconds(1));
+        pacer.setMode(sf::FramePacer::Mode::Relative);
+        CHECK(pacer.getMode() == sf::FramePacer::Mode::Relative);
+        CHECK(pacer.getSlack() == sf::FramePacer::DefaultSlack);
+    }
+
+    SECTION("endFrame()")
+    {
+        sf::FramePacer pacer;
+
+        SECTION("Without pacing")
+        {
+            sf::sleep(sf::milliseconds(2));
+            CHECK(pacer.endFrame() >= sf::milliseconds(2));
+            CHECK(pacer.getStatistics().frameCount == 1);
+            CHECK(pacer.getStatistics().missedDeadlines == 0);
+        }
+
+        SECTION("Relative pacing")
+        {
+            pacer.setFrameTime(sf::milliseconds(5));
+            CHECK(pacer.endFrame() >= sf::milliseconds(5));
+            CHECK(pacer.endFrame() >= sf::milliseconds(5));
+            CHECK(pacer.getStatistics().missedDeadlines == 0);
+        }
+
+        SECTION("Absolute pacing")
+        {
+            pacer.setFrameTime(sf::milliseconds(5));
+            pacer.setMode(sf::FramePacer::Mode::Absolute);
+
+            const auto start = std::chrono::steady_clock::now();
+            pacer.restart();
+            for (int i = 0; i < 10; ++i)
+                (void)pacer.endFrame();
+
+            // Deadlines are absolute: the whole sequence can't end early
+            CHECK(std::chrono::steady_clock::now() - start >= 50ms);
+            CHECK(pacer.getStatistics().frameCount == 10);
+            CHECK(pacer.getStatistics().minimum > sf::Time::Zero);
+        }
+
+        SECTION("Missed deadlines")
+        {
+            pacer.setFrameTime(sf::milliseconds(2));
+            pacer.setMode(sf::FramePacer::Mode::Absolute);
+            sf::sleep(sf::milliseconds(10));
+            CHECK(pacer.endFrame() >= sf::milliseconds(10));
+            CHECK(pacer.getStatistics().missedDeadlines == 1);
+
+            // Being late by more than a frame doesn't make the next frames shorter
+            CHECK(pacer.endFrame() >= sf::milliseconds(2));
+        }
+    }
+
+    SECTION("getStatistics()")
+    {
+        sf::FramePacer pacer;
+        pacer.setFrameTime(sf::milliseconds(2));
+        for (int i = 0; i < 5; ++i)
+            (void)pacer.endFrame();
+
+        const sf::FramePacer::Statistics statistics = pacer.getStatistics();
+        CHECK(statistics.frameCount == 5);
+        CHECK(statistics.minimum <= statistics.average);
+        CHECK(statistics.average <= statistics.maximum);
+        CHECK(statistics.minimum <= statistics.median);
+        CHECK(statistics.median <= statistics.percentile95);
+        CHECK(statistics.percentile95 <= statistics.percentile99);
+        CHECK(statistics.percentile99 <= statistics.maximum);
+    }
+
+    SECTION("resetStatistics()")
+    {
+        sf::FramePacer pacer;
+        (void)pacer.endFrame();
+        pacer.resetStatistics();
+        CHECK(pacer.getStatistics().frameCount == 0);
+        CHECK(pacer.getStatistics().maximum == sf::Time::Zero);
+    }
+}
@@ -27,6 +27,7 @@ TEST_CASE("[System] sf::MemoryInputStream")
             CHECK(memoryInputStream.seek(0) == std::nullopt);
             CHECK(memoryInputStream.tell() == std::nullopt);
             CHECK(memoryInputStream.getSize() == std::nullopt);
+            CHECK(memoryInputStream.getData() == nullptr);
         }
 
         static constexpr auto input = "hello world"sv;
@@ -43,6 +44,7 @@ TEST_CASE("[System] sf::MemoryInputStream")
             sf::MemoryInputStream memoryInputStream(input.data(), input.size());
             CHECK(memoryInputStream.tell().value() == 0);
             CHECK(memoryInputStream.getSize().value() == input.size());
+            CHECK(memoryInputStream.getData() == input.data());
         }
     }
 
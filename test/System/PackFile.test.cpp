@@ -0,0 +1,275 @@
+#include <SFML/System/PackFile.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Exception.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+
+namespace
+{
+std::filesystem::path getTemporaryPath(std::string_view extension)
+{
+    static int counter = 0;
+
+    std::ostringstream oss;
+    oss << "sfmlpack" << counter++ << extension;
+
+    return std::filesystem::temp_directory_path() / oss.str();
+}
+
+// Directory of files to pack, and the pack file built from it
+class TemporaryPack
+{
+public:
+    explicit TemporaryPack(sf::PackFile::Compression compression) :
+    m_directory(getTemporaryPath(".dir")),
+    m_path(getTemporaryPath(".sfpack"))
+    {
+        std::filesystem::create_directories(m_directory / "nested" / "deeper");
+        write("hello.txt", "Hello world");
+        write("empty.txt", "");
+        write("nested/repeated.txt", getRepeated());
+        write("nested/deeper/leaf.txt", "Leaf");
+
+        [[maybe_unused]] const bool built = sf::PackFile::build(m_path, m_directory, compression);
+        assert(built && "Failed to build the pack file");
+    }
+
+    ~TemporaryPack()
+    {
+        std::filesystem::remove_all(m_directory);
+        std::filesystem::remove(m_path);
+    }
+
+    TemporaryPack(const TemporaryPack&) = delete;
+
+    TemporaryPack& operator=(const TemporaryPack&) = delete;
+
+    [[nodiscard]] const std::filesystem::path& getPath() const
+    {
+        return m_path;
+    }
+
+    [[nodiscard]] static std::string getRepeated()
+    {
+        std::string repeated;
+        for (int i = 0; i < 1000; ++i)
+            repeated += "The quick brown fox jumps over the lazy dog. ";
+
+        return repeated;
+    }
+
+private:
+    void write(const std::filesystem::path& path, const std::string& contents) const
+    {
+        std::ofstream ofs(m_directory / path, std::ios_base::binary);
+        assert(ofs && "Stream encountered an error");
+
+        ofs << contents;
+        assert(ofs && "Stream encountered an error");
+    }
+
+    std::filesystem::path m_directory;
+    std::filesystem::path m_path;
+};
+
+std::string readAll(sf::InputStream& stream)
+{
+    std::string contents(stream.getSize().value(), '\0');
+    if (!contents.empty() && (stream.read(contents.data(), contents.size()) != contents.size()))
+        return {};
+
+    return contents;
+}
+} // namespace
+
+TEST_CASE("[System] sf::PackFile")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::PackFile>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::PackFile>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::PackFile>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::PackFile>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::PackFile packFile;
+            CHECK(packFile.getEntryCount() == 0);
+            CHECK(packFile.getEntryPaths().empty());
+            CHECK(!packFile.contains("hello.txt"));
+            CHECK(packFile.openStream("hello.txt") == nullptr);
+            CHECK(!packFile.isMounted());
+        }
+
+        SECTION("File path constructor")
+        {
+            const TemporaryPack temporaryPack(sf::PackFile::Compression::Lz4);
+            const sf::PackFile  packFile(temporaryPack.getPath());
+            CHECK(packFile.getEntryCount() == 4);
+        }
+
+        SECTION("Missing file")
+        {
+            CHECK_THROWS_AS(sf::PackFile("does/not/exist.sfpack"), sf::Exception);
+        }
+    }
+
+    SECTION("Move semantics")
+    {
+        const TemporaryPack temporaryPack(sf::PackFile::Compression::Lz4);
+
+        SECTION("Move constructor")
+        {
+            sf::PackFile       movedPackFile(temporaryPack.getPath());
+            const sf::PackFile packFile = std::move(movedPackFile);
+            CHECK(packFile.getEntryCount() == 4);
+            CHECK(packFile.contains("hello.txt"));
+        }
+
+        SECTION("Move assignment")
+        {
+            sf::PackFile movedPackFile(temporaryPack.getPath());
+            movedPackFile.mount();
+            sf::PackFile packFile;
+            packFile = std::move(movedPackFile);
+            CHECK(packFile.getEntryCount() == 4);
+            CHECK(packFile.isMounted());
+            CHECK(sf::PackFile::openMountedStream("hello.txt") != nullptr);
+        }
+    }
+
+    SECTION("open()")
+    {
+        sf::PackFile packFile;
+        CHECK(!packFile.open("does/not/exist.sfpack"));
+        CHECK(packFile.getEntryCount() == 0);
+
+        // Files that aren't pack files are rejected
+        const std::filesystem::path invalidPath = getTemporaryPath(".sfpack");
+        {
+            std::ofstream ofs(invalidPath, std::ios_base::binary);
+            ofs << "This is definitely not a pack file, but it is long enough to hold a header";
+        }
+        CHECK(!packFile.open(invalidPath));
+        CHECK(packFile.getEntryCount() == 0);
+        std::filesystem::remove(invalidPath);
+    }
+
+    SECTION("Entries")
+    {
+        const auto compression = GENERATE(sf::PackFile::Compression::None, sf::PackFile::Compression::Lz4);
+
+        const TemporaryPack temporaryPack(compression);
+        const sf::PackFile  packFile(temporaryPack.getPath());
+
+        SECTION("getEntryPaths()")
+        {
+            std::vector<std::string> paths = packFile.getEntryPaths();
+            std::sort(paths.begin(), paths.end());
+            CHECK(paths ==
+                  std::vector<std::string>{"empty.txt", "hello.txt", "nested/deeper/leaf.txt", "nested/repeated.txt"});
+        }
+
+        SECTION("contains()")
+        {
+            CHECK(packFile.contains("hello.txt"));
+            CHECK(packFile.contains("nested/deeper/leaf.txt"));
+            CHECK(packFile.contains("nested/../hello.txt"));
+            CHECK(packFile.contains(std::filesystem::path("nested") / "repeated.txt"));
+            CHECK(!packFile.contains("nested"));
+            CHECK(!packFile.contains("missing.txt"));
+        }
+
+        SECTION("openStream()")
+        {
+            CHECK(packFile.openStream("missing.txt") == nullptr);
+
+            const std::unique_ptr<sf::InputStream> hello = packFile.openStream("hello.txt");
+            REQUIRE(hello != nullptr);
+            CHECK(hello->getSize() == 11);
+            CHECK(readAll(*hello) == "Hello world");
+            CHECK(hello->tell() == 11);
+            CHECK(hello->seek(6) == 6);
+            REQUIRE(hello->getData() != nullptr);
+            CHECK(std::string_view(static_cast<const char*>(hello->getData()), 11) == "Hello world");
+
+            const std::unique_ptr<sf::InputStream> empty = packFile.openStream("empty.txt");
+            REQUIRE(empty != nullptr);
+            CHECK(empty->getSize() == 0);
+
+            const std::unique_ptr<sf::InputStream> repeated = packFile.openStream("nested/repeated.txt");
+            REQUIRE(repeated != nullptr);
+            CHECK(readAll(*repeated) == TemporaryPack::getRepeated());
+
+            // Compressible entries are smaller in the pack file
+            if (compression == sf::PackFile::Compression::Lz4)
+                CHECK(std::filesystem::file_size(temporaryPack.getPath()) < TemporaryPack::getRepeated().size());
+        }
+    }
+
+    SECTION("mount()")
+    {
+        const TemporaryPack temporaryPack(sf::PackFile::Compression::Lz4);
+        CHECK(sf::PackFile::openMountedStream("hello.txt") == nullptr);
+
+        {
+            sf::PackFile packFile(temporaryPack.getPath());
+            packFile.mount();
+            CHECK(packFile.isMounted());
+
+            const std::unique_ptr<sf::InputStream> stream = sf::PackFile::openMountedStream("nested/deeper/leaf.txt");
+            REQUIRE(stream != nullptr);
+            CHECK(readAll(*stream) == "Leaf");
+            CHECK(sf::PackFile::openMountedStream("missing.txt") == nullptr);
+
+            packFile.unmount();
+            CHECK(!packFile.isMounted());
+            CHECK(sf::PackFile::openMountedStream("hello.txt") == nullptr);
+
+            packFile.mount();
+        }
+
+        // Destroyed pack files are unmounted
+        CHECK(sf::PackFile::openMountedStream("hello.txt") == nullptr);
+    }
+
+    SECTION("Stream lifetime")
+    {
+        const TemporaryPack temporaryPack(sf::PackFile::Compression::None);
+
+        std::unique_ptr<sf::InputStream> stream;
+        std::unique_ptr<sf::InputStream> mountedStream;
+
+        {
+            sf::PackFile packFile(temporaryPack.getPath());
+            stream = packFile.openStream("hello.txt");
+
+            packFile.mount();
+            mountedStream = sf::PackFile::openMountedStream("nested/deeper/leaf.txt");
+        }
+
+        // Stored entries are read in place, from a mapping that outlives the pack file
+        REQUIRE(stream != nullptr);
+        CHECK(readAll(*stream) == "Hello world");
+        REQUIRE(mountedStream != nullptr);
+        CHECK(readAll(*mountedStream) == "Leaf");
+    }
+}
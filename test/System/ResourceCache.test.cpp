@@ -0,0 +1,375 @@
+#include <SFML/System/ResourceCache.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Exception.hpp>
+#include <SFML/System/TaskScheduler.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+#include <cstdint>
+
+namespace
+{
+std::filesystem::path getTemporaryFilePath()
+{
+    static int counter = 0;
+
+    std::ostringstream oss;
+    oss << "sfmlcache" << counter++ << ".tmp";
+
+    return std::filesystem::temp_directory_path() / oss.str();
+}
+
+class TemporaryFile
+{
+public:
+    // Create a temporary file with a randomly generated path, containing 'contents'.
+    explicit TemporaryFile(const std::string& contents) : m_path(getTemporaryFilePath())
+    {
+        std::ofstream ofs(m_path);
+        assert(ofs && "Stream encountered an error");
+
+        ofs << contents;
+        assert(ofs && "Stream encountered an error");
+    }
+
+    // Close and delete the generated file.
+    ~TemporaryFile()
+    {
+        [[maybe_unused]] const bool removed = std::filesystem::remove(m_path);
+        assert(removed && "m_path failed to be removed from filesystem");
+    }
+
+    // Prevent copies.
+    TemporaryFile(const TemporaryFile&) = delete;
+
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    // Return the randomly generated path.
+    [[nodiscard]] const std::filesystem::path& getPath() const
+    {
+        return m_path;
+    }
+
+private:
+    std::filesystem::path m_path;
+};
+
+// Resource loaded with loadFromFile, measured in pixels like sf::Image and sf::Texture
+struct Picture
+{
+    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename)
+    {
+        std::ifstream ifs(filename);
+        if (!ifs)
+            return false;
+
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    [[nodiscard]] sf::Vector2u getSize() const
+    {
+        return {static_cast<unsigned int>(contents.size()), 1};
+    }
+
+    std::string contents;
+};
+
+// Resource loaded with openFromFile, measured in samples like sf::SoundBuffer
+struct Samples
+{
+    [[nodiscard]] bool openFromFile(const std::filesystem::path& filename)
+    {
+        std::error_code error;
+        sampleCount = std::filesystem::file_size(filename, error);
+        return !error;
+    }
+
+    [[nodiscard]] std::uint64_t getSampleCount() const
+    {
+        return sampleCount;
+    }
+
+    std::uint64_t sampleCount{};
+};
+
+// Resource with no size information, like sf::Font
+struct Document
+{
+    [[nodiscard]] bool loadFromFile(const std::filesystem::path& filename)
+    {
+        return std::filesystem::exists(filename);
+    }
+};
+} // namespace
+
+TEST_CASE("[System] sf::ResourceCache")
+{
+    using Cache = sf::ResourceCache<Picture>;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<Cache>);
+        STATIC_CHECK(!std::is_copy_assignable_v<Cache>);
+        STATIC_CHECK(std::is_move_constructible_v<Cache>);
+        STATIC_CHECK(std::is_move_assignable_v<Cache>);
+        STATIC_CHECK(std::is_copy_constructible_v<Cache::Handle>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<Cache::Handle>);
+    }
+
+    const TemporaryFile hello("Hello world");
+
+    SECTION("Construction")
+    {
+        const Cache cache;
+        CHECK(cache.getResourceCount() == 0);
+        CHECK(cache.getMemoryUsage() == 0);
+        CHECK(cache.getMemoryBudget() == std::numeric_limits<std::size_t>::max());
+
+        const Cache::Handle handle;
+        CHECK(handle.get() == nullptr);
+        CHECK(!handle);
+        CHECK(handle.getStatus() == Cache::Status::Failed);
+        CHECK(!handle.isReady());
+    }
+
+    SECTION("load()")
+    {
+        Cache cache;
+
+        const Cache::Handle handle = cache.load(hello.getPath());
+        REQUIRE(handle.isReady());
+        CHECK(handle->contents == "Hello world");
+        CHECK(cache.contains(hello.getPath().generic_string()));
+        CHECK(cache.getResourceCount() == 1);
+        CHECK(cache.getMemoryUsage() == 11 * 4);
+
+        // Identical loads are deduplicated
+        const Cache::Handle other = cache.load(hello.getPath().parent_path() / "." / hello.getPath().filename());
+        CHECK(other.get() == handle.get());
+        CHECK(cache.getResourceCount() == 1);
+
+        // Resources can be loaded under another identifier
+        const Cache::Handle named = cache.load("greeting", hello.getPath());
+        REQUIRE(named.isReady());
+        CHECK(named.get() != handle.get());
+        CHECK(cache.contains("greeting"));
+        CHECK(cache.getResourceCount() == 2);
+        CHECK(cache.getMemoryUsage() == 2 * 11 * 4);
+    }
+
+    SECTION("load() failure")
+    {
+        Cache cache;
+
+        const Cache::Handle missing = cache.load("does/not/exist.txt");
+        CHECK(missing.getStatus() == Cache::Status::Failed);
+        CHECK(!missing);
+        CHECK(cache.getResourceCount() == 0);
+
+        // Failed loads give access to the placeholder
+        cache.setPlaceholder(Picture{"Placeholder"});
+        const Cache::Handle substituted = cache.load("does/not/exist.txt");
+        CHECK(substituted.getStatus() == Cache::Status::Failed);
+        REQUIRE(substituted);
+        CHECK(substituted->contents == "Placeholder");
+
+        // Exceptions thrown by the loader are failures too
+        Cache throwing([](const std::filesystem::path&) -> std::optional<Picture>
+                       { throw sf::Exception("Failed to construct picture"); });
+        CHECK(throwing.load(hello.getPath()).getStatus() == Cache::Status::Failed);
+    }
+
+    SECTION("loadAsync()")
+    {
+        std::promise<void>       promise;
+        const std::shared_future released = promise.get_future().share();
+
+        Cache cache(
+            [released](const std::filesystem::path& filename) -> std::optional<Picture>
+            {
+                released.wait();
+                Picture picture;
+                if (!picture.loadFromFile(filename))
+                    return std::nullopt;
+                return picture;
+            });
+        cache.setPlaceholder(Picture{"Placeholder"});
+
+        const Cache::Handle handle = cache.loadAsync(hello.getPath());
+        CHECK(handle.getStatus() == Cache::Status::Loading);
+        REQUIRE(handle);
+        CHECK(handle->contents == "Placeholder");
+        CHECK(cache.getMemoryUsage() == 0);
+
+        // Pending resources are shared as well
+        CHECK(cache.loadAsync(hello.getPath()).get() == handle.get());
+        CHECK(cache.getResourceCount() == 1);
+
+        const Cache::Handle missing = cache.loadAsync("does/not/exist.txt");
+        promise.set_value();
+
+        // Synchronous loads wait for the background load to finish
+        CHECK(cache.load(hello.getPath()).isReady());
+        CHECK(handle.isReady());
+        CHECK(handle->contents == "Hello world");
+        CHECK(cache.getMemoryUsage() == 11 * 4);
+
+        CHECK(cache.load("does/not/exist.txt").getStatus() == Cache::Status::Failed);
+        CHECK(missing.getStatus() == Cache::Status::Failed);
+        CHECK(missing->contents == "Placeholder");
+    }
+
+    SECTION("load() of a queued background load")
+    {
+        // Keep all the workers of the default scheduler busy, so that the background load stays queued
+        sf::TaskScheduler&        scheduler = sf::TaskScheduler::getDefault();
+        std::promise<void>        promise;
+        const std::shared_future  released = promise.get_future().share();
+        std::atomic<unsigned int> busy{};
+        for (unsigned int i = 0; i < scheduler.getWorkerCount(); ++i)
+        {
+            scheduler.run(
+                [&busy, released]
+                {
+                    ++busy;
+                    released.wait();
+                });
+        }
+
+        while (busy < scheduler.getWorkerCount())
+            std::this_thread::yield();
+
+        // The synchronous load doesn't wait for the workers, it loads the resource itself
+        Cache               cache;
+        const Cache::Handle handle = cache.loadAsync(hello.getPath());
+        CHECK(cache.load(hello.getPath()).isReady());
+        CHECK(handle.isReady());
+        CHECK(handle->contents == "Hello world");
+        CHECK(cache.getMemoryUsage() == 11 * 4);
+
+        promise.set_value();
+    }
+
+    SECTION("insert()")
+    {
+        Cache cache;
+
+        const Cache::Handle handle = cache.insert("picture", Picture{"abc"});
+        REQUIRE(handle.isReady());
+        CHECK(handle->contents == "abc");
+        CHECK(cache.getMemoryUsage() == 3 * 4);
+
+        // Replacing a resource doesn't invalidate the handles of the previous one
+        const Cache::Handle replaced = cache.insert("picture", Picture{"abcdef"});
+        CHECK(handle->contents == "abc");
+        CHECK(replaced->contents == "abcdef");
+        CHECK(cache.getResourceCount() == 1);
+        CHECK(cache.getMemoryUsage() == 6 * 4);
+    }
+
+    SECTION("find()")
+    {
+        Cache cache;
+        CHECK(!cache.find("picture"));
+
+        const Cache::Handle handle = cache.insert("picture", Picture{"abc"});
+        CHECK(cache.find("picture").get() == handle.get());
+        CHECK(!cache.contains("missing"));
+    }
+
+    SECTION("setMemoryBudget()")
+    {
+        Cache cache;
+        CHECK(cache.insert("first", Picture{"1111"}));
+        Cache::Handle second = cache.insert("second", Picture{"2222"});
+        CHECK(cache.insert("third", Picture{"3333"}));
+        CHECK(cache.find("first"));
+        CHECK(cache.getMemoryUsage() == 3 * 16);
+
+        // The least recently used resources are evicted first, referenced resources are kept
+        cache.setMemoryBudget(32);
+        CHECK(cache.getMemoryBudget() == 32);
+        CHECK(cache.contains("first"));
+        CHECK(cache.contains("second"));
+        CHECK(!cache.contains("third"));
+        CHECK(cache.getMemoryUsage() == 2 * 16);
+
+        // Adding resources trims the cache
+        second = {};
+        CHECK(cache.insert("fourth", Picture{"4444"}));
+        CHECK(cache.contains("first"));
+        CHECK(!cache.contains("second"));
+        CHECK(cache.contains("fourth"));
+        CHECK(cache.getMemoryUsage() == 2 * 16);
+
+        // Resources are evicted until the usage fits in the budget
+        cache.setMemoryBudget(0);
+        CHECK(cache.getResourceCount() == 0);
+        CHECK(cache.getMemoryUsage() == 0);
+    }
+
+    SECTION("trim()")
+    {
+        Cache cache(
+            [](const std::filesystem::path& filename) -> std::optional<Picture>
+            {
+                Picture picture;
+                if (!picture.loadFromFile(filename))
+                    return std::nullopt;
+                return picture;
+            });
+
+        // Background loads that failed are evicted once unreferenced
+        Cache::Handle missing = cache.loadAsync("does/not/exist.txt");
+        CHECK(cache.load("does/not/exist.txt").getStatus() == Cache::Status::Failed);
+        CHECK(cache.contains("does/not/exist.txt"));
+        CHECK(cache.trim() == 0);
+
+        missing = {};
+        CHECK(cache.trim() == 1);
+        CHECK(cache.getResourceCount() == 0);
+    }
+
+    SECTION("clear()")
+    {
+        Cache               cache;
+        const Cache::Handle handle = cache.load(hello.getPath());
+        cache.clear();
+        CHECK(cache.getResourceCount() == 0);
+        CHECK(cache.getMemoryUsage() == 0);
+        CHECK(handle->contents == "Hello world");
+    }
+
+    SECTION("Default sizer")
+    {
+        sf::ResourceCache<Samples> cache;
+        const auto                 handle = cache.load(hello.getPath());
+        REQUIRE(handle.isReady());
+        CHECK(handle->getSampleCount() == 11);
+        CHECK(cache.getMemoryUsage() == 11 * 2);
+
+        // Resources without size information count as the size of their file
+        sf::ResourceCache<Document> documents;
+        CHECK(documents.load(hello.getPath()).isReady());
+        CHECK(documents.getMemoryUsage() == 11);
+        CHECK(documents.insert("document", Document{}).isReady());
+        CHECK(documents.getMemoryUsage() == 11);
+    }
+}
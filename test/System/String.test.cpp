@@ -5,6 +5,7 @@
 #include <GraphicsUtil.hpp>
 #include <array>
 #include <iomanip>
+#include <iterator>
 #include <sstream>
 #include <type_traits>
 
@@ -443,6 +444,22 @@ TEST_CASE("[System] sf::String")
         }
     }
 
+    SECTION("fromUtf8(U8StringView)")
+    {
+        // Long enough to go through the bulk conversion, with non-ASCII characters at chunk boundaries
+        const std::u32string utf32 = U"Hello, \u00E9t\u00E9! \u3053\u3093\u306B\u3061 \U0001F600 plain ASCII text";
+        sf::U8String         utf8;
+        sf::Utf32::toUtf8(utf32.begin(), utf32.end(), std::back_inserter(utf8));
+
+        CHECK(sf::String::fromUtf8(utf8).toUtf32() == utf32);
+        CHECK(sf::String::fromUtf8(utf8) == sf::String::fromUtf8(utf8.begin(), utf8.end()));
+        CHECK(sf::String::fromUtf8(sf::U8StringView()).isEmpty());
+
+        // Same output as the iterator version on malformed input
+        const sf::U8String malformed{'a', 0xC3, 'b', 0x80, 'c', 0xF0, 0x9F};
+        CHECK(sf::String::fromUtf8(malformed) == sf::String::fromUtf8(malformed.begin(), malformed.end()));
+    }
+
     SECTION("fromUtf16()")
     {
         constexpr std::array<char16_t, 4> characters{0xF1, 'x', 'y', 'z'};
@@ -459,6 +476,28 @@ TEST_CASE("[System] sf::String")
         CHECK(string.getData() != nullptr);
     }
 
+    SECTION("fromUtf16(std::u16string_view)")
+    {
+        const std::u16string utf16 = u"Hello, \u00E9t\u00E9! \u3053\u3093\U0001F600 plain ASCII text \U00010437";
+        CHECK(sf::String::fromUtf16(utf16) == sf::String::fromUtf16(utf16.begin(), utf16.end()));
+        CHECK(sf::String::fromUtf16(utf16).toUtf16() == utf16);
+        CHECK(sf::String::fromUtf16(std::u16string_view()).isEmpty());
+    }
+
+    SECTION("isValidUtf8()")
+    {
+        CHECK(sf::String::isValidUtf8(sf::U8StringView()));
+        CHECK(sf::String::isValidUtf8(sf::String(U"ASCII text, \u00E9\u3053\U0001F600 and more ASCII text").toUtf8()));
+        CHECK(sf::String::isValidUtf8(sf::U8String{0xF4, 0x8F, 0xBF, 0xBF}));     // U+10FFFF
+        CHECK(!sf::String::isValidUtf8(sf::U8String{0x80}));                      // Stray continuation byte
+        CHECK(!sf::String::isValidUtf8(sf::U8String{0xC0, 0xAF}));                // Overlong encoding
+        CHECK(!sf::String::isValidUtf8(sf::U8String{0xE0, 0x80, 0xAF}));          // Overlong encoding
+        CHECK(!sf::String::isValidUtf8(sf::U8String{0xED, 0xA0, 0x80}));          // Surrogate
+        CHECK(!sf::String::isValidUtf8(sf::U8String{0xF4, 0x90, 0x80, 0x80}));    // Above U+10FFFF
+        CHECK(!sf::String::isValidUtf8(sf::U8String{'a', 'b', 0xE3, 0x81}));      // Truncated
+        CHECK(!sf::String::isValidUtf8(sf::U8String{0xE3, 0x81, 'a'}));           // Missing continuation byte
+    }
+
     SECTION("fromUtf32()")
     {
         constexpr std::array<char32_t, 4> characters{'w', 0x104321, 'y', 'z'};
@@ -475,6 +514,29 @@ TEST_CASE("[System] sf::String")
         CHECK(string.getData() != nullptr);
     }
 
+    SECTION("Bulk conversions")
+    {
+        // Mix of ASCII runs and other characters, longer than the vector width of the bulk conversions
+        std::u32string utf32;
+        for (char32_t i = 0; i < 200; ++i)
+            utf32 += (i % 7 == 0) ? char32_t{0x4E00} + i : (i % 11 == 0) ? char32_t{0x1F300} + i : U'a' + (i % 26);
+
+        const sf::String string(utf32);
+        sf::U8String     utf8;
+        std::u16string   utf16;
+        sf::Utf32::toUtf8(utf32.begin(), utf32.end(), std::back_inserter(utf8));
+        sf::Utf32::toUtf16(utf32.begin(), utf32.end(), std::back_inserter(utf16));
+
+        CHECK(string.toUtf8() == utf8);
+        CHECK(string.toUtf16() == utf16);
+        CHECK(sf::String::fromUtf8(utf8) == string);
+        CHECK(sf::String::fromUtf16(utf16) == string);
+
+        const std::string ascii(100, 'x');
+        CHECK(sf::String(ascii).toAnsiString() == ascii);
+        CHECK(sf::String(ascii.c_str()).getSize() == 100);
+    }
+
     SECTION("clear()")
     {
         sf::String string("you'll never guess what happens when you call clear()");
@@ -0,0 +1,292 @@
+#include <SFML/System/TaskScheduler.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Err.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+TEST_CASE("[System] sf::TaskScheduler")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TaskScheduler>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TaskScheduler>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TaskScheduler::TaskGroup>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TaskScheduler::TaskGroup>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TaskScheduler scheduler(3);
+        CHECK(scheduler.getWorkerCount() == 3);
+        CHECK(scheduler.isMainThread());
+        CHECK(sf::TaskScheduler::getHardwareWorkerCount() >= 1);
+    }
+
+    SECTION("run()")
+    {
+        std::atomic<int> count{};
+        {
+            sf::TaskScheduler scheduler(2);
+            for (int i = 0; i < 100; ++i)
+                scheduler.run([&count] { ++count; });
+        }
+
+        // Pending tasks are finished before the scheduler is destroyed
+        CHECK(count == 100);
+    }
+
+    SECTION("TaskGroup")
+    {
+        sf::TaskScheduler scheduler(4);
+
+        SECTION("wait()")
+        {
+            std::atomic<int>             count{};
+            sf::TaskScheduler::TaskGroup group(scheduler);
+            for (int i = 0; i < 1000; ++i)
+                group.run([&count] { ++count; });
+
+            group.wait();
+            CHECK(group.isDone());
+            CHECK(count == 1000);
+        }
+
+        SECTION("Nested groups")
+        {
+            // Tasks waiting for their own tasks run them instead of blocking the workers
+            std::atomic<int>             count{};
+            sf::TaskScheduler::TaskGroup group(scheduler);
+            for (int i = 0; i < 16; ++i)
+            {
+                group.run(
+                    [&scheduler, &count]
+                    {
+                        sf::TaskScheduler::TaskGroup nested(scheduler);
+                        for (int j = 0; j < 16; ++j)
+                            nested.run([&count] { ++count; });
+                    });
+            }
+
+            group.wait();
+            CHECK(count == 16 * 16);
+        }
+
+        SECTION("runOnMainThread()")
+        {
+            const std::thread::id        mainThread = std::this_thread::get_id();
+            std::atomic<int>             onMainThread{};
+            sf::TaskScheduler::TaskGroup group(scheduler);
+            for (int i = 0; i < 10; ++i)
+            {
+                group.run(
+                    [&]
+                    {
+                        group.runOnMainThread(
+                            [&]
+                            {
+                                if (std::this_thread::get_id() == mainThread)
+                                    ++onMainThread;
+                            });
+                    });
+            }
+
+            group.wait();
+            CHECK(onMainThread == 10);
+        }
+
+        SECTION("Exceptions")
+        {
+            // The first exception is rethrown once all the tasks are finished
+            std::atomic<int>             count{};
+            sf::TaskScheduler::TaskGroup group(scheduler);
+            for (int i = 0; i < 100; ++i)
+            {
+                group.run(
+                    [&count, i]
+                    {
+                        ++count;
+                        if (i % 10 == 0)
+                            throw std::runtime_error("task failed");
+                    });
+            }
+
+            CHECK_THROWS_AS(group.wait(), std::runtime_error);
+            CHECK(group.isDone());
+            CHECK(count == 100);
+
+            // The group can be reused afterwards
+            group.run([&count] { ++count; });
+            CHECK_NOTHROW(group.wait());
+            CHECK(count == 101);
+        }
+    }
+
+    SECTION("runMainThreadTasks()")
+    {
+        sf::TaskScheduler scheduler(1);
+        int               count = 0;
+        scheduler.runOnMainThread([&count] { ++count; });
+        scheduler.runOnMainThread([&count] { ++count; });
+        CHECK(count == 0);
+
+        // Other threads can't run the tasks bound to the main thread
+        std::size_t runByWorker = 0;
+        std::thread([&] { runByWorker = scheduler.runMainThreadTasks(); }).join();
+        CHECK(runByWorker == 0);
+
+        CHECK(scheduler.runMainThreadTasks() == 2);
+        CHECK(count == 2);
+        CHECK(scheduler.runMainThreadTasks() == 0);
+    }
+
+    SECTION("setMainThread()")
+    {
+        sf::TaskScheduler scheduler(1);
+        int               count = 0;
+        scheduler.runOnMainThread([&count] { ++count; });
+
+        std::size_t runByOtherThread = 0;
+        std::thread(
+            [&]
+            {
+                scheduler.setMainThread();
+                runByOtherThread = scheduler.runMainThreadTasks();
+            })
+            .join();
+        CHECK(runByOtherThread == 1);
+        CHECK(count == 1);
+        CHECK(!scheduler.isMainThread());
+
+        scheduler.setMainThread();
+        CHECK(scheduler.isMainThread());
+    }
+
+    SECTION("Exceptions outside groups")
+    {
+        // Exceptions of tasks without a group are reported and don't stop the workers
+        std::atomic<int> count{};
+        {
+            sf::TaskScheduler scheduler(2);
+            for (int i = 0; i < 10; ++i)
+            {
+                scheduler.run(
+                    [&count]
+                    {
+                        ++count;
+                        throw std::runtime_error("task failed");
+                    });
+            }
+        }
+
+        CHECK(count == 10);
+    }
+
+    SECTION("Messages")
+    {
+        // What tasks write to sf::err() is reported by the thread waiting for them, or by the main thread
+        std::ostringstream    output;
+        std::streambuf* const previous = sf::err().rdbuf(output.rdbuf());
+
+        std::string expected;
+        for (int i = 0; i < 10; ++i)
+            expected += "task\n";
+
+        {
+            sf::TaskScheduler            scheduler(2);
+            sf::TaskScheduler::TaskGroup group(scheduler);
+            for (int i = 0; i < 10; ++i)
+                group.run([] { sf::err() << "task" << std::endl; });
+
+            group.wait();
+            CHECK(output.str() == expected);
+            output.str({});
+
+            for (int i = 0; i < 10; ++i)
+                scheduler.run([] { sf::err() << "task" << std::endl; });
+        }
+
+        // The messages left are reported when the scheduler is destroyed
+        CHECK(output.str() == expected);
+
+        sf::err().rdbuf(previous);
+    }
+
+    SECTION("parallelFor()")
+    {
+        sf::TaskScheduler scheduler(3);
+
+        std::vector<int> values(10'000);
+        scheduler.parallelFor(0,
+                              values.size(),
+                              [&values](std::size_t first, std::size_t last)
+                              {
+                                  for (std::size_t i = first; i < last; ++i)
+                                      values[i] = static_cast<int>(i);
+                              });
+        CHECK(std::accumulate(values.begin(), values.end(), 0LL) == 49'995'000);
+
+        // Each element is processed exactly once, whatever the grain size
+        std::vector<std::atomic<int>> visits(1000);
+        scheduler.parallelFor(
+            10,
+            1000,
+            [&visits](std::size_t first, std::size_t last)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                    ++visits[i];
+            },
+            7);
+        CHECK(std::all_of(visits.begin(), visits.begin() + 10, [](const auto& visit) { return visit == 0; }));
+        CHECK(std::all_of(visits.begin() + 10, visits.end(), [](const auto& visit) { return visit == 1; }));
+
+        // Empty ranges do nothing
+        bool called = false;
+        scheduler.parallelFor(5, 5, [&called](std::size_t, std::size_t) { called = true; });
+        CHECK(!called);
+    }
+
+    SECTION("No worker thread")
+    {
+        // Tasks run right away on the calling thread
+        sf::TaskScheduler scheduler(0);
+        CHECK(scheduler.getWorkerCount() == 0);
+
+        int count = 0;
+        scheduler.run([&count] { ++count; });
+        CHECK(count == 1);
+
+        sf::TaskScheduler::TaskGroup group(scheduler);
+        group.run([&count] { ++count; });
+        group.runOnMainThread([&count] { ++count; });
+        group.wait();
+        CHECK(count == 3);
+
+        group.run([] { throw std::runtime_error("task failed"); });
+        CHECK_THROWS_AS(group.wait(), std::runtime_error);
+
+        long long sum = 0;
+        scheduler.parallelFor(0, 100, [&sum](std::size_t first, std::size_t last)
+                              { sum += static_cast<long long>((first + last - 1) * (last - first) / 2); });
+        CHECK(sum == 4950);
+    }
+
+    SECTION("getDefault()")
+    {
+        sf::TaskScheduler& scheduler = sf::TaskScheduler::getDefault();
+        CHECK(&scheduler == &sf::TaskScheduler::getDefault());
+        CHECK(scheduler.getWorkerCount() == sf::TaskScheduler::getHardwareWorkerCount());
+    }
+}